@@ -0,0 +1,349 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "v200.h"
+#include "flash.h"
+
+struct flash_sector {
+    uint8_t *data;
+    int private;    // data was allocated for this sector and may be written
+    int dirty;      // programmed or erased since it was loaded
+};
+
+static struct flash_sector sectors[FLASH_SECTORS];
+static uint8_t erased[FLASH_SECTOR_SIZE];
+
+// Journal of program/erase operations made since the base image was last
+// written. Replaying a journal is idempotent, so a crash between writing a
+// new base image and truncating the journal loses nothing.
+#define JOURNAL_RECORD_SIZE 12
+#define JOURNAL_MAX_RECORDS 65536
+
+#define JOURNAL_PROGRAM 'P'
+#define JOURNAL_ERASE   'E'
+
+static char *base_path = NULL;
+static int journal_fd = -1;
+static int journal_records = 0;
+
+static uint8_t flash_phase = 0x50;
+static int flash_write = 0;
+static int flash_ff = 0;
+
+static void sector_erase(int n)
+{
+    if (sectors[n].private)
+        free(sectors[n].data);
+    sectors[n].data = erased;
+    sectors[n].private = 0;
+    sectors[n].dirty = 1;
+}
+
+static uint8_t *sector_writable(int n)
+{
+    if (!sectors[n].private) {
+        uint8_t *copy = malloc(FLASH_SECTOR_SIZE);
+        if (!copy) {
+            perror("flash");
+            exit(1);
+        }
+        memcpy(copy, sectors[n].data, FLASH_SECTOR_SIZE);
+        sectors[n].data = copy;
+        sectors[n].private = 1;
+    }
+    return sectors[n].data;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+// FNV-1a over the record body; catches records torn by a crash mid-write
+static uint32_t journal_checksum(const uint8_t *rec)
+{
+    uint32_t sum = 0x811c9dc5;
+    for (int i = 0; i < JOURNAL_RECORD_SIZE - 4; i++)
+        sum = (sum ^ rec[i]) * 0x01000193;
+    return sum;
+}
+
+static void journal_append(uint8_t op, uint32_t addr, uint16_t value)
+{
+    if (journal_fd < 0)
+        return;
+
+    uint8_t rec[JOURNAL_RECORD_SIZE] = { op, 0, value >> 8, value & 0xff };
+    put32(&rec[4], addr);
+    put32(&rec[8], journal_checksum(rec));
+
+    if (write(journal_fd, rec, sizeof(rec)) != sizeof(rec)) {
+        perror("flash journal");
+        exit(1);
+    }
+
+    if (++journal_records >= JOURNAL_MAX_RECORDS)
+        flash_compact();
+}
+
+static void sector_program(uint32_t addr, uint16_t value)
+{
+    uint8_t *p = sector_writable(addr / FLASH_SECTOR_SIZE) + addr % FLASH_SECTOR_SIZE;
+    p[0] &= value >> 8;
+    p[1] &= value & 0xff;
+    sectors[addr / FLASH_SECTOR_SIZE].dirty = 1;
+}
+
+void flash_init(void)
+{
+    memset(erased, 0xff, sizeof(erased));
+    for (int n = 0; n < FLASH_SECTORS; n++) {
+        sectors[n].private = 0;
+        sector_erase(n);
+        sectors[n].dirty = 0;
+    }
+    flash_phase = 0x50;
+    flash_write = 0;
+    flash_ff = 0;
+}
+
+// The caller keeps data alive and unchanged for as long as flash is in use
+void flash_load_sector(int n, const uint8_t *data)
+{
+    sector_erase(n);
+    sectors[n].dirty = 0;
+    for (int i = 0; i < FLASH_SECTOR_SIZE; i++) {
+        if (data[i] != 0xff) {
+            sectors[n].data = (uint8_t *) data;
+            break;
+        }
+    }
+}
+
+const uint8_t *flash_sector(int n)
+{
+    return sectors[n].data;
+}
+
+uint8_t flash_read8(uint32_t addr)
+{
+    if (flash_ff)
+        return 0xff;
+    addr = (addr - FLASH_BASE) & (FLASH_SIZE - 1);
+    return sectors[addr / FLASH_SECTOR_SIZE].data[addr % FLASH_SECTOR_SIZE];
+}
+
+uint16_t flash_read16(uint32_t addr)
+{
+    if (flash_ff)
+        return 0xffff;
+    addr = (addr - FLASH_BASE) & (FLASH_SIZE - 1);
+    uint8_t *p = sectors[addr / FLASH_SECTOR_SIZE].data + addr % FLASH_SECTOR_SIZE;
+    return (p[0] << 8) | p[1];
+}
+
+void flash_write16(uint16_t value, uint32_t addr)
+{
+    addr = (addr - FLASH_BASE) & (FLASH_SIZE - 1);
+
+    if (flash_write > 0) {
+        // Programming can only clear bits
+        sector_program(addr, value);
+        journal_append(JOURNAL_PROGRAM, addr, value);
+        flash_write = 0;
+        flash_ff = 1;
+    } else switch(value & 0xff) {
+        case 0x10:
+            if (flash_phase == 0x50) flash_write = 1;
+            break;
+        case 0x20:
+            if (flash_phase == 0x50) flash_phase = 0x20;
+            break;
+        case 0x50:
+            flash_phase = 0x50;
+            break;
+        case 0x90:
+            flash_phase = 0x90;
+            break;
+        case 0xd0:
+            if (flash_phase == 0x20) {
+                sector_erase(addr / FLASH_SECTOR_SIZE);
+                journal_append(JOURNAL_ERASE, addr & ~(FLASH_SECTOR_SIZE - 1), 0);
+                flash_phase = 0xd0;
+                flash_ff = 1;
+            }
+            break;
+        case 0xff:
+            if (flash_phase == 0x50) {
+                flash_ff = 0;
+            }
+            break;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void load_base(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        if (errno == ENOENT)
+            return; // first run; flash_open writes it out
+        perror(path);
+        exit(1);
+    }
+
+    // Like the OS image, this stays shared until sectors are modified
+    uint8_t *image = malloc(FLASH_SIZE);
+    if (!image) {
+        perror(path);
+        exit(1);
+    }
+    if (read(fd, image, FLASH_SIZE) != FLASH_SIZE) {
+        fprintf(stderr, "%s: not a %d byte flash image\n", path, FLASH_SIZE);
+        exit(1);
+    }
+    close(fd);
+
+    for (int n = 0; n < FLASH_SECTORS; n++)
+        flash_load_sector(n, image + n * FLASH_SECTOR_SIZE);
+}
+
+static void replay_journal(void)
+{
+    uint8_t rec[JOURNAL_RECORD_SIZE];
+    off_t valid = 0;
+
+    while (read(journal_fd, rec, sizeof(rec)) == sizeof(rec)) {
+        uint32_t addr = get32(&rec[4]);
+        if (get32(&rec[8]) != journal_checksum(rec) || addr >= FLASH_SIZE)
+            break;
+
+        if (rec[0] == JOURNAL_PROGRAM)
+            sector_program(addr, (rec[2] << 8) | rec[3]);
+        else if (rec[0] == JOURNAL_ERASE)
+            sector_erase(addr / FLASH_SECTOR_SIZE);
+        else
+            break;
+
+        valid += sizeof(rec);
+        journal_records++;
+    }
+
+    // Drop anything after the last good record so new appends follow it
+    if (ftruncate(journal_fd, valid) < 0 || lseek(journal_fd, valid, SEEK_SET) < 0) {
+        perror("flash journal");
+        exit(1);
+    }
+}
+
+void flash_open(const char *path)
+{
+    base_path = strdup(path);
+    load_base(path);
+
+    char journal_path[strlen(path) + sizeof(".journal")];
+    sprintf(journal_path, "%s.journal", path);
+
+    journal_fd = open(journal_path, O_RDWR | O_CREAT, 0644);
+    if (journal_fd < 0) {
+        perror(journal_path);
+        exit(1);
+    }
+
+    replay_journal();
+
+    if (access(path, F_OK) < 0 || journal_records > 0)
+        flash_compact();
+}
+
+void flash_compact(void)
+{
+    if (journal_fd < 0)
+        return;
+
+    char tmp_path[strlen(base_path) + sizeof(".tmp")];
+    sprintf(tmp_path, "%s.tmp", base_path);
+
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        perror(tmp_path);
+        exit(1);
+    }
+    for (int n = 0; n < FLASH_SECTORS; n++) {
+        if (write(fd, sectors[n].data, FLASH_SECTOR_SIZE) != FLASH_SECTOR_SIZE) {
+            perror(tmp_path);
+            exit(1);
+        }
+    }
+    if (fsync(fd) < 0 || close(fd) < 0 || rename(tmp_path, base_path) < 0) {
+        perror(base_path);
+        exit(1);
+    }
+
+    if (ftruncate(journal_fd, 0) < 0 || lseek(journal_fd, 0, SEEK_SET) < 0) {
+        perror("flash journal");
+        exit(1);
+    }
+    journal_records = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Only sectors changed since loading are saved; the rest are expected to
+// match what has been loaded when the state is restored.
+
+void flash_save(FILE *fh)
+{
+    uint8_t state[3] = { flash_phase, flash_write, flash_ff };
+    fwrite(state, sizeof(state), 1, fh);
+
+    for (int n = 0; n < FLASH_SECTORS; n++) {
+        uint8_t dirty = sectors[n].dirty;
+        fwrite(&dirty, 1, 1, fh);
+        if (dirty)
+            fwrite(sectors[n].data, FLASH_SECTOR_SIZE, 1, fh);
+    }
+}
+
+int flash_restore(FILE *fh)
+{
+    uint8_t state[3];
+    if (fread(state, sizeof(state), 1, fh) != 1)
+        return 0;
+    flash_phase = state[0];
+    flash_write = state[1];
+    flash_ff = state[2];
+
+    int restored = 0;
+    for (int n = 0; n < FLASH_SECTORS; n++) {
+        uint8_t dirty;
+        if (fread(&dirty, 1, 1, fh) != 1)
+            return 0;
+        if (!dirty)
+            continue;
+
+        sector_erase(n);
+        if (fread(sector_writable(n), FLASH_SECTOR_SIZE, 1, fh) != 1)
+            return 0;
+        restored = 1;
+    }
+
+    // These changes never went through the journal
+    if (restored)
+        flash_compact();
+    return 1;
+}
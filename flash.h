@@ -0,0 +1,31 @@
+#ifndef FLASH_H
+#define FLASH_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define FLASH_SECTOR_SIZE   0x10000
+#define FLASH_SECTORS       (FLASH_SIZE / FLASH_SECTOR_SIZE)
+
+// Flash is kept as an array of 64 KB sectors. Erased sectors all point at
+// one shared page of 0xff, and sectors loaded from the OS image point into
+// the image without copying it. A sector only gets memory of its own the
+// first time it is programmed.
+
+void flash_init(void);
+void flash_load_sector(int sector, const uint8_t *data);
+const uint8_t *flash_sector(int sector);
+
+// Keep flash in a base image at path, with program and erase operations
+// appended to path.journal between compactions
+void flash_open(const char *path);
+void flash_compact(void);
+
+void flash_save(FILE *fh);
+int flash_restore(FILE *fh);
+
+uint8_t flash_read8(uint32_t addr);
+uint16_t flash_read16(uint32_t addr);
+void flash_write16(uint16_t value, uint32_t addr);
+
+#endif
@@ -0,0 +1,228 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "m68k.h"
+#include "v200.h"
+#include "hle.h"
+
+// AMS keeps a pointer to the ROM call table in the vector area
+#define ROMCALL_TABLE_PTR   0xc8
+
+// Guest cycles charged per call, and per byte handled. This is in the
+// region of what the ROM's own unrolled loops take.
+#define HLE_CALL_CYCLES     40
+#define HLE_BYTE_CYCLES     4
+
+#define HLE_PAGE_SHIFT      12
+
+typedef int (*hle_handler)(void);
+
+struct hle_hook {
+    uint16_t romcall;
+    hle_handler handler;
+    uint32_t addr;
+};
+
+static uint8_t hle_pages[FLASH_SIZE >> HLE_PAGE_SHIFT];
+static int hle_resolved = 0;
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Arguments are passed on the stack, above the return address. Pointers
+// and size_t are 32 bits, int is 16 bits.
+
+static uint32_t hle_arg32(int offset)
+{
+    return m68k_read_memory_32(m68k_get_reg(NULL, M68K_REG_SP) + 4 + offset);
+}
+
+static uint16_t hle_arg16(int offset)
+{
+    return m68k_read_memory_16(m68k_get_reg(NULL, M68K_REG_SP) + 4 + offset);
+}
+
+// Returns a host pointer for a guest buffer, or NULL unless the whole
+// buffer lies in RAM. Anything else is left to the ROM's implementation.
+static uint8_t *hle_ram(uint32_t addr, uint32_t len)
+{
+    if (addr >= RAM_SIZE || len > RAM_SIZE - addr)
+        return NULL;
+    return (uint8_t *) ti_ram + addr;
+}
+
+// Same, for a NUL terminated string. The length excludes the NUL.
+static uint8_t *hle_ram_str(uint32_t addr, uint32_t *len)
+{
+    if (addr >= RAM_SIZE)
+        return NULL;
+    uint8_t *p = (uint8_t *) ti_ram + addr;
+    uint8_t *end = memchr(p, 0, RAM_SIZE - addr);
+    if (!end)
+        return NULL;
+    *len = end - p;
+    return p;
+}
+
+static int hle_overlaps(uint32_t a, uint32_t b, uint32_t len)
+{
+    return a < b + len && b < a + len;
+}
+
+static int hle_return(uint32_t d0, uint32_t a0, uint32_t bytes)
+{
+    uint32_t sp = m68k_get_reg(NULL, M68K_REG_SP);
+    m68k_set_reg(M68K_REG_D0, d0);
+    m68k_set_reg(M68K_REG_A0, a0);
+    m68k_set_reg(M68K_REG_SP, sp + 4);
+    m68k_set_reg(M68K_REG_PC, m68k_read_memory_32(sp));
+    m68k_use_cycles(HLE_CALL_CYCLES + bytes * HLE_BYTE_CYCLES);
+    return 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// void *memcpy(void *dst, const void *src, size_t len)
+static int hle_memcpy(void)
+{
+    uint32_t dst = hle_arg32(0), src = hle_arg32(4), len = hle_arg32(8);
+    uint8_t *d = hle_ram(dst, len), *s = hle_ram(src, len);
+    if (!d || !s || hle_overlaps(dst, src, len))
+        return 0;
+    memcpy(d, s, len);
+    return hle_return(dst, dst, len);
+}
+
+// void *memmove(void *dst, const void *src, size_t len)
+static int hle_memmove(void)
+{
+    uint32_t dst = hle_arg32(0), src = hle_arg32(4), len = hle_arg32(8);
+    uint8_t *d = hle_ram(dst, len), *s = hle_ram(src, len);
+    if (!d || !s)
+        return 0;
+    memmove(d, s, len);
+    return hle_return(dst, dst, len);
+}
+
+// char *strcpy(char *dst, const char *src)
+static int hle_strcpy(void)
+{
+    uint32_t dst = hle_arg32(0), src = hle_arg32(4), len;
+    uint8_t *s = hle_ram_str(src, &len);
+    if (!s)
+        return 0;
+    uint8_t *d = hle_ram(dst, len + 1);
+    if (!d || hle_overlaps(dst, src, len + 1))
+        return 0;
+    memcpy(d, s, len + 1);
+    return hle_return(dst, dst, len + 1);
+}
+
+// short memcmp(const void *a, const void *b, size_t len)
+static int hle_memcmp(void)
+{
+    uint32_t a = hle_arg32(0), b = hle_arg32(4), len = hle_arg32(8);
+    uint8_t *pa = hle_ram(a, len), *pb = hle_ram(b, len);
+    if (!pa || !pb)
+        return 0;
+    uint32_t i = 0;
+    while (i < len && pa[i] == pb[i])
+        i++;
+    int result = i < len ? pa[i] - pb[i] : 0;
+    return hle_return((uint16_t) result, a, i);
+}
+
+// short strcmp(const char *a, const char *b)
+static int hle_strcmp(void)
+{
+    uint32_t a = hle_arg32(0), b = hle_arg32(4), len_a, len_b;
+    uint8_t *pa = hle_ram_str(a, &len_a), *pb = hle_ram_str(b, &len_b);
+    if (!pa || !pb)
+        return 0;
+    uint32_t i = 0;
+    while (pa[i] && pa[i] == pb[i])
+        i++;
+    return hle_return((uint16_t) (pa[i] - pb[i]), a, i);
+}
+
+// void *memset(void *dst, short c, size_t len)
+static int hle_memset(void)
+{
+    uint32_t dst = hle_arg32(0), len = hle_arg32(6);
+    uint8_t c = hle_arg16(4);
+    uint8_t *d = hle_ram(dst, len);
+    if (!d)
+        return 0;
+    memset(d, c, len);
+    return hle_return(dst, dst, len);
+}
+
+// size_t strlen(const char *s)
+static int hle_strlen(void)
+{
+    uint32_t s = hle_arg32(0), len;
+    if (!hle_ram_str(s, &len))
+        return 0;
+    return hle_return(len, s, len);
+}
+
+static struct hle_hook hle_hooks[] = {
+    { 0x26a, hle_memcpy },
+    { 0x26b, hle_memmove },
+    { 0x26c, hle_strcpy },
+    { 0x270, hle_memcmp },
+    { 0x271, hle_strcmp },
+    { 0x27c, hle_memset },
+    { 0x27e, hle_strlen },
+};
+
+#define HLE_HOOK_COUNT (sizeof(hle_hooks) / sizeof(hle_hooks[0]))
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void hle_pc_changed(unsigned int pc)
+{
+    uint32_t offset = pc - FLASH_BASE;
+    if (offset >= FLASH_SIZE || !hle_pages[offset >> HLE_PAGE_SHIFT])
+        return;
+
+    for (int i = 0; i < HLE_HOOK_COUNT; i++) {
+        if (hle_hooks[i].addr == pc) {
+            hle_hooks[i].handler();
+            return;
+        }
+    }
+}
+
+void hle_init(void)
+{
+    memset(hle_pages, 0, sizeof(hle_pages));
+    hle_resolved = 0;
+    m68k_set_pc_changed_callback(hle_pc_changed);
+}
+
+int hle_resolve(void)
+{
+    if (hle_resolved)
+        return 1;
+
+    uint32_t table = m68k_read_memory_32(ROMCALL_TABLE_PTR);
+    if (table - FLASH_BASE >= FLASH_SIZE)
+        return 0;
+
+    // The entry count is stored just before the table
+    uint32_t count = m68k_read_memory_32(table - 4);
+    for (int i = 0; i < HLE_HOOK_COUNT; i++) {
+        if (hle_hooks[i].romcall >= count)
+            return 0;
+        uint32_t addr = m68k_read_memory_32(table + 4 * hle_hooks[i].romcall);
+        if (addr - FLASH_BASE >= FLASH_SIZE)
+            return 0;
+        hle_hooks[i].addr = addr;
+    }
+
+    for (int i = 0; i < HLE_HOOK_COUNT; i++)
+        hle_pages[(hle_hooks[i].addr - FLASH_BASE) >> HLE_PAGE_SHIFT] = 1;
+    hle_resolved = 1;
+    return 1;
+}
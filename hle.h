@@ -0,0 +1,11 @@
+#ifndef HLE_H
+#define HLE_H
+
+// Native implementations of hot AMS ROM calls. hle_init() hooks the CPU;
+// hle_resolve() looks the entry points up in the ROM call table, and
+// should be called periodically until AMS has set the table up.
+
+void hle_init(void);
+int hle_resolve(void);
+
+#endif
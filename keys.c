@@ -0,0 +1,143 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "v200.h"
+#include "keys.h"
+
+#define NUM_KEYS            81
+#define KEY_QUEUE_SIZE      64
+#define KEY_POST_SIZE       64
+
+// Shortest hold and release that AMS's keyboard scan reliably sees
+#define KEY_HOLD_CYCLES     (50 * CYCLES_PER_TICK)
+#define KEY_RELEASE_CYCLES  (50 * CYCLES_PER_TICK)
+
+struct key_event {
+    uint64_t when;
+    uint8_t key;
+    uint8_t down;
+    uint8_t scripted;
+};
+
+static struct key_event queue[KEY_QUEUE_SIZE];
+static int queued = 0;
+
+// Earliest time the next event for each key, or any press, can happen
+static uint64_t key_ready[NUM_KEYS];
+static uint64_t press_ready = 0;
+
+// Events from the window thread, not yet scheduled. One writer and one
+// reader, each owning one end of the ring.
+static struct {
+    uint8_t key;
+    uint8_t down;
+} posted[KEY_POST_SIZE];
+static atomic_uint post_head = 0, post_tail = 0;
+
+static int *script = NULL;
+static int script_len = 0, script_pos = 0;
+static int script_queued = 0;
+
+static void schedule(int key, int down, uint64_t when, int scripted)
+{
+    if (key < 0 || key >= NUM_KEYS || queued == KEY_QUEUE_SIZE)
+        return;
+
+    if (when < key_ready[key])
+        when = key_ready[key];
+    if (down && when < press_ready)
+        when = press_ready;
+
+    if (down) {
+        key_ready[key] = when + KEY_HOLD_CYCLES;
+    } else {
+        key_ready[key] = when + KEY_RELEASE_CYCLES;
+        press_ready = when + KEY_RELEASE_CYCLES;
+    }
+
+    // Keep the queue in time order; events at the same time stay in the
+    // order they were made
+    int i = queued++;
+    while (i > 0 && queue[i - 1].when > when) {
+        queue[i] = queue[i - 1];
+        i--;
+    }
+    queue[i] = (struct key_event) {
+        .when = when,
+        .key = key,
+        .down = down,
+        .scripted = scripted,
+    };
+    if (scripted)
+        script_queued++;
+}
+
+int keys_event(int key, int down)
+{
+    unsigned tail = atomic_load_explicit(&post_tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&post_head, memory_order_acquire);
+    if (tail - head == KEY_POST_SIZE)
+        return 0;
+
+    posted[tail % KEY_POST_SIZE].key = key;
+    posted[tail % KEY_POST_SIZE].down = down;
+    atomic_store_explicit(&post_tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+static void take_posted(uint64_t now)
+{
+    unsigned head = atomic_load_explicit(&post_head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&post_tail, memory_order_acquire);
+
+    for (; head != tail; head++)
+        schedule(posted[head % KEY_POST_SIZE].key,
+                 posted[head % KEY_POST_SIZE].down, now, 0);
+
+    atomic_store_explicit(&post_head, head, memory_order_release);
+}
+
+// Types keys one after another, as fast as the holds allow
+void keys_script(const int *keys, int len)
+{
+    free(script);
+    script = malloc(len * sizeof(int));
+    if (!script)
+        len = 0;
+    else
+        memcpy(script, keys, len * sizeof(int));
+    script_len = len;
+    script_pos = 0;
+}
+
+uint64_t keys_apply(uint64_t now)
+{
+    take_posted(now);
+
+    for (;;) {
+        // Only one scripted key is in flight at a time
+        if (script_queued == 0 && script_pos < script_len) {
+            int key = script[script_pos++];
+            schedule(key, 1, now, 1);
+            schedule(key, 0, now, 1);
+            continue;
+        }
+
+        if (queued == 0 || queue[0].when > now)
+            break;
+
+        keyboard_state[queue[0].key] = queue[0].down;
+        if (queue[0].scripted)
+            script_queued--;
+        memmove(queue, queue + 1, --queued * sizeof(queue[0]));
+    }
+
+    return queued ? queue[0].when - now : UINT64_MAX;
+}
+
+int keys_scripted(void)
+{
+    return script_queued > 0 || script_pos < script_len;
+}
@@ -0,0 +1,23 @@
+#ifndef KEYS_H
+#define KEYS_H
+
+#include <stdint.h>
+
+// Key presses and releases, queued up and applied to keyboard_state at
+// given points in emulated time. AMS debounces the keyboard in software,
+// so each key is held down, and all keys are left up, for at least as
+// long as it takes to notice.
+
+// Window thread. Presses and releases are passed to the emulation thread
+// without locking, and land at whatever cycle it's reached when it next
+// looks. Returns 0 if the handoff is full and the event was dropped.
+int keys_event(int key, int down);
+
+// Everything else runs on the emulation thread.
+void keys_script(const int *keys, int len);
+
+// Applies events due by now. Returns the cycles until the next one.
+uint64_t keys_apply(uint64_t now);
+int keys_scripted(void);
+
+#endif
@@ -0,0 +1,36 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "lcd.h"
+
+// Set in the middle index when it holds a frame the window hasn't taken
+#define LCD_FRESH   4
+
+static uint8_t buffers[3][LCD_BYTES];
+
+static int back = 0;                // filled by the emulation thread
+static atomic_int middle = 1;       // swapped by both
+static int front = 2;               // shown by the window
+
+int lcd_publish(const uint8_t *frame)
+{
+    memcpy(buffers[back], frame, LCD_BYTES);
+
+    int old = atomic_exchange_explicit(&middle, back | LCD_FRESH,
+                                       memory_order_acq_rel);
+    back = old & ~LCD_FRESH;
+    return !(old & LCD_FRESH);
+}
+
+const uint8_t *lcd_latest(void)
+{
+    // Only the emulation thread sets LCD_FRESH, so once it's seen here the
+    // exchange is sure to pick up a new frame
+    if (!(atomic_load_explicit(&middle, memory_order_relaxed) & LCD_FRESH))
+        return NULL;
+
+    int old = atomic_exchange_explicit(&middle, front, memory_order_acq_rel);
+    front = old & ~LCD_FRESH;
+    return buffers[front];
+}
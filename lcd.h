@@ -0,0 +1,23 @@
+#ifndef LCD_H
+#define LCD_H
+
+#include <stdint.h>
+
+#define LCD_WIDTH   240
+#define LCD_HEIGHT  128
+#define LCD_BYTES   (LCD_WIDTH / 8 * LCD_HEIGHT)
+
+// Finished LCD frames, handed from the emulation thread to the window
+// through a triple buffer. Neither side ever waits for the other: the
+// emulation thread always has a spare buffer to fill, and the window always
+// picks up the newest frame, skipping any it was too slow to see.
+
+// Emulation thread. Returns 1 if the window has taken the previous frame,
+// i.e. isn't already due to wake up for a new one.
+int lcd_publish(const uint8_t *frame);
+
+// Window thread. Returns the newest frame, or NULL if nothing's been
+// published since the last call. Valid until the next call.
+const uint8_t *lcd_latest(void);
+
+#endif
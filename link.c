@@ -0,0 +1,205 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "v200.h"
+#include "link.h"
+
+#define LINK_IRQ            4
+
+// 0x60000c: interrupt enables
+#define LINK_CTRL_ERROR     0x08
+#define LINK_CTRL_ACTIVITY  0x04
+#define LINK_CTRL_TX        0x02
+#define LINK_CTRL_RX        0x01
+
+// 0x60000d: status
+#define LINK_STATUS_ERROR   0x80
+#define LINK_STATUS_TX      0x40    // transmit buffer empty
+#define LINK_STATUS_RX      0x20    // receive buffer full
+#define LINK_STATUS_ACTIVITY 0x08
+
+#define LINK_BUFFER_SIZE    4096
+
+// Frames to keep running flat out after the last byte moved
+#define LINK_BUSY_FRAMES    40
+
+// Queued bytes run from head up to tail
+struct link_queue {
+    uint8_t data[LINK_BUFFER_SIZE];
+    int head, tail;
+};
+
+static int listen_fd = -1;
+static int peer_fd = -1;
+
+static struct link_queue rx_queue, tx_queue;
+static int rx_full = 0;
+static uint8_t rx_byte = 0;
+static uint8_t status = 0;
+static int busy_frames = 0;
+
+static void link_update_irq(void)
+{
+    uint8_t ctrl = io[0x0c];
+    int active = ((ctrl & LINK_CTRL_RX) && rx_full) ||
+        ((ctrl & LINK_CTRL_TX) && tx_queue.tail < LINK_BUFFER_SIZE) ||
+        ((ctrl & LINK_CTRL_ACTIVITY) && (status & LINK_STATUS_ACTIVITY)) ||
+        ((ctrl & LINK_CTRL_ERROR) && (status & LINK_STATUS_ERROR));
+    irq_set(LINK_IRQ, active);
+}
+
+// Move the next received byte into the data register
+static void link_fill(void)
+{
+    if (rx_full || rx_queue.head == rx_queue.tail)
+        return;
+    rx_byte = rx_queue.data[rx_queue.head++];
+    rx_full = 1;
+    status |= LINK_STATUS_ACTIVITY;
+    busy_frames = LINK_BUSY_FRAMES;
+}
+
+static void link_disconnect(void)
+{
+    close(peer_fd);
+    peer_fd = -1;
+    rx_queue.head = rx_queue.tail = 0;
+    tx_queue.tail = 0;
+}
+
+// Send what we can of the transmit queue. Returns 0 if the peer went away.
+static int link_flush(void)
+{
+    if (tx_queue.tail == 0)
+        return 1;
+
+    ssize_t n = write(peer_fd, tx_queue.data, tx_queue.tail);
+    if (n < 0 && errno != EAGAIN) {
+        link_disconnect();
+        return 0;
+    }
+    if (n > 0) {
+        memmove(tx_queue.data, tx_queue.data + n, tx_queue.tail - n);
+        tx_queue.tail -= n;
+        busy_frames = LINK_BUSY_FRAMES;
+    }
+    return 1;
+}
+
+void link_open(const char *path)
+{
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "%s: socket path too long\n", path);
+        exit(1);
+    }
+    strcpy(addr.sun_path, path);
+
+    listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        perror("socket");
+        exit(1);
+    }
+
+    unlink(path);
+    if (bind(listen_fd, (struct sockaddr *) &addr, sizeof(addr)) < 0 ||
+            listen(listen_fd, 1) < 0) {
+        perror(path);
+        exit(1);
+    }
+    fcntl(listen_fd, F_SETFL, O_NONBLOCK);
+}
+
+void link_poll(void)
+{
+    if (listen_fd < 0)
+        return;
+
+    if (peer_fd < 0) {
+        peer_fd = accept(listen_fd, NULL, NULL);
+        if (peer_fd < 0)
+            return;
+        fcntl(peer_fd, F_SETFL, O_NONBLOCK);
+    }
+
+    if (!link_flush())
+        return;
+
+    if (rx_queue.head == rx_queue.tail) {
+        ssize_t n = read(peer_fd, rx_queue.data, LINK_BUFFER_SIZE);
+        if (n == 0 || (n < 0 && errno != EAGAIN)) {
+            link_disconnect();
+            return;
+        }
+        if (n > 0) {
+            rx_queue.head = 0;
+            rx_queue.tail = n;
+        }
+    }
+
+    link_fill();
+    link_update_irq();
+
+    if (busy_frames > 0)
+        busy_frames--;
+}
+
+// True while a transfer is in progress, so the emulator can stop pacing
+// itself to real time
+int link_busy(void)
+{
+    return busy_frames > 0;
+}
+
+uint8_t link_read8(uint32_t addr)
+{
+    uint8_t val = 0;
+    switch (addr) {
+        case 0x0c:
+            val = io[0x0c];
+            break;
+        case 0x0d:
+            val = status;
+            if (tx_queue.tail < LINK_BUFFER_SIZE)
+                val |= LINK_STATUS_TX;
+            if (rx_full)
+                val |= LINK_STATUS_RX;
+            // Reading the status acknowledges errors and activity
+            status = 0;
+            link_update_irq();
+            break;
+        case 0x0f:
+            val = rx_byte;
+            rx_full = 0;
+            link_fill();
+            link_update_irq();
+            break;
+    }
+    return val;
+}
+
+void link_write8(uint32_t addr, uint8_t val)
+{
+    switch (addr) {
+        case 0x0c:
+            link_update_irq();
+            break;
+        case 0x0f:
+            // With nothing plugged in, bytes go nowhere
+            if (peer_fd < 0)
+                break;
+            if (tx_queue.tail == LINK_BUFFER_SIZE && !link_flush())
+                break;
+            if (tx_queue.tail < LINK_BUFFER_SIZE)
+                tx_queue.data[tx_queue.tail++] = val;
+            link_update_irq();
+            break;
+    }
+}
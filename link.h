@@ -0,0 +1,17 @@
+#ifndef LINK_H
+#define LINK_H
+
+#include <stdint.h>
+
+// The link port, with the other end of the cable on a Unix-domain socket.
+// One client at a time can connect to the socket and talk the TI link
+// protocol to the calculator, a byte at a time in each direction.
+
+void link_open(const char *path);
+void link_poll(void);
+int link_busy(void);
+
+uint8_t link_read8(uint32_t addr);
+void link_write8(uint32_t addr, uint8_t val);
+
+#endif
@@ -132,6 +132,148 @@ typedef enum
 	M68K_REG_CPU_TYPE	/* Type of CPU being run */
 } m68k_register_t;
 
+/* Mnemonics returned in m68k_dasm_info.mnemonic */
+enum
+{
+	M68K_MN_INVALID,	/* Not a 68000 instruction */
+	M68K_MN_ABCD,
+	M68K_MN_ADD,
+	M68K_MN_ADDA,
+	M68K_MN_ADDI,
+	M68K_MN_ADDQ,
+	M68K_MN_ADDX,
+	M68K_MN_AND,
+	M68K_MN_ANDI,
+	M68K_MN_ASL,
+	M68K_MN_ASR,
+	M68K_MN_BCC,		/* Condition in m68k_dasm_info.cond */
+	M68K_MN_BCHG,
+	M68K_MN_BCLR,
+	M68K_MN_BRA,
+	M68K_MN_BSET,
+	M68K_MN_BSR,
+	M68K_MN_BTST,
+	M68K_MN_CHK,
+	M68K_MN_CLR,
+	M68K_MN_CMP,
+	M68K_MN_CMPA,
+	M68K_MN_CMPI,
+	M68K_MN_CMPM,
+	M68K_MN_DBCC,		/* Condition in m68k_dasm_info.cond (dbra = dbf) */
+	M68K_MN_DIVS,
+	M68K_MN_DIVU,
+	M68K_MN_EOR,
+	M68K_MN_EORI,
+	M68K_MN_EXG,
+	M68K_MN_EXT,
+	M68K_MN_ILLEGAL,
+	M68K_MN_JMP,
+	M68K_MN_JSR,
+	M68K_MN_LEA,
+	M68K_MN_LINK,
+	M68K_MN_LSL,
+	M68K_MN_LSR,
+	M68K_MN_MOVE,
+	M68K_MN_MOVEA,
+	M68K_MN_MOVEM,
+	M68K_MN_MOVEP,
+	M68K_MN_MOVEQ,
+	M68K_MN_MULS,
+	M68K_MN_MULU,
+	M68K_MN_NBCD,
+	M68K_MN_NEG,
+	M68K_MN_NEGX,
+	M68K_MN_NOP,
+	M68K_MN_NOT,
+	M68K_MN_OR,
+	M68K_MN_ORI,
+	M68K_MN_PEA,
+	M68K_MN_RESET,
+	M68K_MN_ROL,
+	M68K_MN_ROR,
+	M68K_MN_ROXL,
+	M68K_MN_ROXR,
+	M68K_MN_RTE,
+	M68K_MN_RTR,
+	M68K_MN_RTS,
+	M68K_MN_SBCD,
+	M68K_MN_SCC,		/* Condition in m68k_dasm_info.cond */
+	M68K_MN_STOP,
+	M68K_MN_SUB,
+	M68K_MN_SUBA,
+	M68K_MN_SUBI,
+	M68K_MN_SUBQ,
+	M68K_MN_SUBX,
+	M68K_MN_SWAP,
+	M68K_MN_TAS,
+	M68K_MN_TRAP,
+	M68K_MN_TRAPV,
+	M68K_MN_TST,
+	M68K_MN_UNLK,
+	M68K_MN_LINE_A,		/* Unimplemented 1010 opcode */
+	M68K_MN_LINE_F,		/* Unimplemented 1111 opcode */
+	M68K_MN_COUNT
+};
+
+/* Operand types returned in m68k_dasm_operand.type */
+enum
+{
+	M68K_OPER_NONE,
+	M68K_OPER_D,		/* Dn */
+	M68K_OPER_A,		/* An */
+	M68K_OPER_AI,		/* (An) */
+	M68K_OPER_PI,		/* (An)+ */
+	M68K_OPER_PD,		/* -(An) */
+	M68K_OPER_DI,		/* (d16,An): disp */
+	M68K_OPER_IX,		/* (d8,An,Xn): disp, index */
+	M68K_OPER_AW,		/* (xxx).w: value is the sign extended address */
+	M68K_OPER_AL,		/* (xxx).l: value */
+	M68K_OPER_PCDI,		/* (d16,PC): disp, value is the resolved address */
+	M68K_OPER_PCIX,		/* (d8,PC,Xn): disp, index, value is the base PC */
+	M68K_OPER_IMM,		/* #value, including quick and implied data */
+	M68K_OPER_REGLIST,	/* movem list: bit 0 = D0 .. bit 15 = A7 */
+	M68K_OPER_LABEL,	/* branch target: value */
+	M68K_OPER_CCR,
+	M68K_OPER_SR,
+	M68K_OPER_USP
+};
+
+/* Flags returned in m68k_dasm_info.flags */
+#define M68K_DASM_INVALID     0x01	/* Not a valid 68000 instruction */
+#define M68K_DASM_BRANCH      0x02	/* Transfers control (bcc, dbcc, bra, bsr, jmp, jsr) */
+#define M68K_DASM_CONDITIONAL 0x04	/* Branch may fall through (bcc, dbcc) */
+#define M68K_DASM_CALL        0x08	/* Subroutine call (bsr, jsr) */
+#define M68K_DASM_RETURN      0x10	/* rts, rtr, rte */
+#define M68K_DASM_TRAP        0x20	/* Unconditional exception (trap, illegal, line a/f) */
+#define M68K_DASM_TARGET      0x40	/* target holds a statically known destination */
+#define M68K_DASM_TRUNCATED   0x80	/* Instruction runs past the end of the buffer */
+
+/* A decoded operand */
+typedef struct
+{
+	unsigned char type;			/* M68K_OPER_* */
+	unsigned char reg;			/* Register number (0-7) for register based modes */
+	unsigned char index_reg;	/* Index register for _IX modes: 0-7 = D0-D7, 8-15 = A0-A7 */
+	unsigned char index_size;	/* Index size for _IX modes: 2 or 4 */
+	int           disp;			/* Sign extended displacement */
+	unsigned int  value;		/* Immediate, absolute address or register list */
+} m68k_dasm_operand;
+
+/* A decoded instruction, filled by the structured disassembler */
+typedef struct
+{
+	unsigned int      pc;				/* Address of the instruction */
+	unsigned int      target;			/* Branch target if M68K_DASM_TARGET is set */
+	unsigned short    opcode;			/* First instruction word */
+	unsigned char     mnemonic;			/* M68K_MN_* */
+	unsigned char     size;				/* Operation size in bytes, 0 if unsized */
+	unsigned char     cond;				/* Condition for bcc, dbcc and scc */
+	unsigned char     length;			/* Instruction length in bytes */
+	unsigned char     flags;			/* M68K_DASM_* */
+	unsigned char     num_operands;
+	m68k_dasm_operand operands[2];		/* Source first, as written in assembly */
+} m68k_dasm_info;
+
 /* ======================================================================== */
 /* ====================== FUNCTIONS CALLED BY THE CPU ===================== */
 /* ======================================================================== */
@@ -261,6 +403,16 @@ void m68k_set_fc_callback(void  (*callback)(unsigned int new_fc));
 void m68k_set_instr_hook_callback(void  (*callback)(void));
 
 
+/* Set the callback used to get direct access to memory.
+ * You must enable M68K_FAST_LOOPS in m68kconf.h.
+ * The CPU calls this callback with an address and a size in bytes when it
+ * wants to run a copy or fill loop natively.  Return a pointer to the memory
+ * (in 68000 byte order) if the whole range is plain RAM, or NULL otherwise.
+ * Default behavior: return NULL.
+ */
+void m68k_set_memory_pointer_callback(unsigned char* (*callback)(unsigned int address, unsigned int size));
+
+
 
 /* ======================================================================== */
 /* ====================== FUNCTIONS TO ACCESS THE CPU ===================== */
@@ -297,6 +449,7 @@ int m68k_cycles_run(void);              /* Number of cycles run so far */
 int m68k_cycles_remaining(void);        /* Number of cycles left */
 void m68k_modify_timeslice(int cycles); /* Modify cycles left */
 void m68k_end_timeslice(void);          /* End timeslice now */
+void m68k_use_cycles(int cycles);       /* Consume cycles as if an instruction ran */
 
 /* Set the IPL0-IPL2 pins on the CPU (IRQ).
  * A transition from < 7 to 7 will cause a non-maskable interrupt (NMI).
@@ -309,6 +462,13 @@ void m68k_set_irq(unsigned int int_level);
 void m68k_pulse_halt(void);
 
 
+/* Write the most frequent pairs of adjacent opcode handlers to filename,
+ * one "first second count" line each, for m68kmake -fuse.  Returns -1 if
+ * M68K_PROFILE_PAIRS is off or the file can't be written.
+ */
+int m68k_write_pair_profile(const char* filename);
+
+
 /* Context switching to allow multiple CPUs */
 
 /* Get the size of the cpu context in bytes */
@@ -341,6 +501,28 @@ unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cp
  */
 unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_type);
 
+/* Decode 1 68000 instruction at pc into info without any string formatting.
+ * Reads through m68k_read_disassembler_16() and returns the size of the
+ * instruction in bytes.  Safe to call from several threads at once.
+ */
+unsigned int m68k_disassemble_info(m68k_dasm_info* info, unsigned int pc);
+
+/* As above, but read from buf, which holds length bytes of memory starting
+ * at address base.  Reads past the end of buf return 0 and set
+ * M68K_DASM_TRUNCATED.
+ */
+unsigned int m68k_disassemble_info_buffer(m68k_dasm_info* info, unsigned int pc, const unsigned char* buf, unsigned int base, unsigned int length);
+
+/* Disassemble all of buf by linear sweep from base, splitting the work
+ * across num_threads threads.  The result is identical to calling
+ * m68k_disassemble_info_buffer() on each instruction in turn.  out must
+ * have room for (length+1)/2 entries.  Returns the number of instructions.
+ */
+unsigned int m68k_disassemble_bulk(m68k_dasm_info* out, const unsigned char* buf, unsigned int base, unsigned int length, unsigned int num_threads);
+
+/* Get the lowercase name of a M68K_MN_* mnemonic */
+const char* m68k_mnemonic_name(unsigned int mnemonic);
+
 
 /* ======================================================================== */
 /* ============================== MAME STUFF ============================== */
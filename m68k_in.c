@@ -108,12 +108,28 @@ M68KMAKE_PROTOTYPE_HEADER
 XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_PROTOTYPE_FOOTER
 
+#if M68K_OPS_000_ONLY
+#define NUM_CPU_TYPES 1
+#else
+#define NUM_CPU_TYPES 3
+#endif
+
+/* An opcode handler and the base cycles each cpu type takes to run it.
+ * Fused handlers (see m68kfuse.txt) may run the next instruction too.
+ */
+typedef struct
+{
+	void (*handler)(void);
+	unsigned char cycles[NUM_CPU_TYPES];
+	unsigned char fused;
+} m68ki_opcode_entry;
 
-/* Build the opcode handler table */
-void m68ki_build_opcode_table(void);
+/* Every opcode word indexes one of the (few) distinct entries */
+extern const m68ki_opcode_entry m68ki_opcode_entries[];
+extern const unsigned short m68ki_opcode_index[0x10000];
 
-extern void (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
-extern unsigned char m68ki_cycles[][0x10000];
+/* Handler names for each entry (only with M68K_PROFILE_PAIRS) */
+extern const char* const m68ki_opcode_names[];
 
 
 /* ======================================================================== */
@@ -128,147 +144,17 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_TABLE_HEADER
 
 /* ======================================================================== */
-/* ========================= OPCODE TABLE BUILDER ========================= */
+/* ============================= OPCODE TABLE ============================= */
 /* ======================================================================== */
 
+#include "m68k.h"
 #include "m68kops.h"
 
-#define NUM_CPU_TYPES 3
-
-void  (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
-unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000]; /* Cycles used by CPU type */
-
-/* This is used to generate the opcode handler jump table */
-typedef struct
-{
-	void (*opcode_handler)(void);        /* handler function */
-	unsigned int  mask;                  /* mask on opcode */
-	unsigned int  match;                 /* what to match after masking */
-	unsigned char cycles[NUM_CPU_TYPES]; /* cycles each cpu type takes */
-} opcode_handler_struct;
-
-
-/* Opcode handler table */
-static opcode_handler_struct m68k_opcode_handler_table[] =
-{
-/*   function                      mask    match    000  010  020 */
-
 
 
 XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_TABLE_FOOTER
 
-	{0, 0, 0, {0, 0, 0}}
-};
-
-
-/* Build the opcode handler jump table */
-void m68ki_build_opcode_table(void)
-{
-	opcode_handler_struct *ostruct;
-	int cycle_cost;
-	int instr;
-	int i;
-	int j;
-	int k;
-
-	for(i = 0; i < 0x10000; i++)
-	{
-		/* default to illegal */
-		m68ki_instruction_jump_table[i] = m68k_op_illegal;
-		for(k=0;k<NUM_CPU_TYPES;k++)
-			m68ki_cycles[k][i] = 0;
-	}
-
-	ostruct = m68k_opcode_handler_table;
-	while(ostruct->mask != 0xff00)
-	{
-		for(i = 0;i < 0x10000;i++)
-		{
-			if((i & ostruct->mask) == ostruct->match)
-			{
-				m68ki_instruction_jump_table[i] = ostruct->opcode_handler;
-				for(k=0;k<NUM_CPU_TYPES;k++)
-					m68ki_cycles[k][i] = ostruct->cycles[k];
-			}
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xff00)
-	{
-		for(i = 0;i <= 0xff;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xf1f8)
-	{
-		for(i = 0;i < 8;i++)
-		{
-			for(j = 0;j < 8;j++)
-			{
-				instr = ostruct->match | (i << 9) | j;
-				m68ki_instruction_jump_table[instr] = ostruct->opcode_handler;
-				for(k=0;k<NUM_CPU_TYPES;k++)
-					m68ki_cycles[k][instr] = ostruct->cycles[k];
-				// For all shift operations with known shift distance (encoded in instruction word)
-				if((instr & 0xf000) == 0xe000 && (!(instr & 0x20)))
-				{
-					// On the 68000 and 68010 shift distance affect execution time.
-					// Add the cycle cost of shifting; 2 times the shift distance
-					cycle_cost = ((((i-1)&7)+1)<<1);
-					m68ki_cycles[0][instr] += cycle_cost;
-					m68ki_cycles[1][instr] += cycle_cost;
-					// On the 68020 shift distance does not affect execution time
-					m68ki_cycles[2][instr] += 0;
-				}
-			}
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xfff0)
-	{
-		for(i = 0;i <= 0x0f;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xf1ff)
-	{
-		for(i = 0;i <= 0x07;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | (i << 9)] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | (i << 9)] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xfff8)
-	{
-		for(i = 0;i <= 0x07;i++)
-		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
-		}
-		ostruct++;
-	}
-	while(ostruct->mask == 0xffff)
-	{
-		m68ki_instruction_jump_table[ostruct->match] = ostruct->opcode_handler;
-		for(k=0;k<NUM_CPU_TYPES;k++)
-			m68ki_cycles[k][ostruct->match] = ostruct->cycles[k];
-		ostruct++;
-	}
-}
-
-
 /* ======================================================================== */
 /* ============================== END OF FILE ============================= */
 /* ======================================================================== */
@@ -1121,8 +1007,7 @@ M68KMAKE_OP(add, 32, er, d)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -1137,8 +1022,7 @@ M68KMAKE_OP(add, 32, er, a)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -1153,8 +1037,7 @@ M68KMAKE_OP(add, 32, er, .)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -1201,8 +1084,7 @@ M68KMAKE_OP(add, 32, re, .)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1331,8 +1213,7 @@ M68KMAKE_OP(addi, 32, ., d)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -1347,8 +1228,7 @@ M68KMAKE_OP(addi, 32, ., .)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1435,8 +1315,7 @@ M68KMAKE_OP(addq, 32, ., d)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -1460,8 +1339,7 @@ M68KMAKE_OP(addq, 32, ., .)
 
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1512,8 +1390,7 @@ M68KMAKE_OP(addx, 32, rr, .)
 	uint res = src + dst + XFLAG_AS_1();
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 
 	res = MASK_OUT_ABOVE_32(res);
 	FLAG_Z |= res;
@@ -1620,8 +1497,7 @@ M68KMAKE_OP(addx, 32, mm, .)
 	uint res = src + dst + XFLAG_AS_1();
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 
 	res = MASK_OUT_ABOVE_32(res);
 	FLAG_Z |= res;
@@ -3935,8 +3811,7 @@ M68KMAKE_OP(cmp, 32, ., d)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -3948,8 +3823,7 @@ M68KMAKE_OP(cmp, 32, ., a)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -3961,8 +3835,7 @@ M68KMAKE_OP(cmp, 32, ., .)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -3974,8 +3847,7 @@ M68KMAKE_OP(cmpa, 16, ., d)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -3987,8 +3859,7 @@ M68KMAKE_OP(cmpa, 16, ., a)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -4000,8 +3871,7 @@ M68KMAKE_OP(cmpa, 16, ., .)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -4013,8 +3883,7 @@ M68KMAKE_OP(cmpa, 32, ., d)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -4026,8 +3895,7 @@ M68KMAKE_OP(cmpa, 32, ., a)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -4039,8 +3907,7 @@ M68KMAKE_OP(cmpa, 32, ., .)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -4176,8 +4043,7 @@ M68KMAKE_OP(cmpi, 32, ., d)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -4189,8 +4055,7 @@ M68KMAKE_OP(cmpi, 32, ., .)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -4204,8 +4069,7 @@ M68KMAKE_OP(cmpi, 32, ., pcdi)
 
 		FLAG_N = NFLAG_32(res);
 		FLAG_Z = MASK_OUT_ABOVE_32(res);
-		FLAG_V = VFLAG_SUB_32(src, dst, res);
-		FLAG_C = CFLAG_SUB_32(src, dst, res);
+		m68ki_lazy_cmp_32(src, dst, res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -4222,8 +4086,7 @@ M68KMAKE_OP(cmpi, 32, ., pcix)
 
 		FLAG_N = NFLAG_32(res);
 		FLAG_Z = MASK_OUT_ABOVE_32(res);
-		FLAG_V = VFLAG_SUB_32(src, dst, res);
-		FLAG_C = CFLAG_SUB_32(src, dst, res);
+		m68ki_lazy_cmp_32(src, dst, res);
 		return;
 	}
 	m68ki_exception_illegal();
@@ -4303,8 +4166,7 @@ M68KMAKE_OP(cmpm, 32, ., .)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
-	FLAG_C = CFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_cmp_32(src, dst, res);
 }
 
 
@@ -4392,6 +4254,8 @@ M68KMAKE_OP(dbf, 16, ., .)
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		m68ki_branch_16(offset);
 		USE_CYCLES(CYC_DBCC_F_NOEXP);
+		if(offset == 0xfffc)
+			m68ki_fast_loop(r_dst);
 		return;
 	}
 	REG_PC += 2;
@@ -8616,7 +8480,7 @@ M68KMAKE_OP(roxr, 8, r, .)
 		return;
 	}
 
-	FLAG_C = FLAG_X;
+	FLAG_C = GET_FLAG_X();
 	FLAG_N = NFLAG_8(*r_dst);
 	FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
 	FLAG_V = VFLAG_CLEAR;
@@ -8646,7 +8510,7 @@ M68KMAKE_OP(roxr, 16, r, .)
 		return;
 	}
 
-	FLAG_C = FLAG_X;
+	FLAG_C = GET_FLAG_X();
 	FLAG_N = NFLAG_16(*r_dst);
 	FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
 	FLAG_V = VFLAG_CLEAR;
@@ -8680,7 +8544,7 @@ M68KMAKE_OP(roxr, 32, r, .)
 		return;
 	}
 
-	FLAG_C = FLAG_X;
+	FLAG_C = GET_FLAG_X();
 	FLAG_N = NFLAG_32(*r_dst);
 	FLAG_Z = *r_dst;
 	FLAG_V = VFLAG_CLEAR;
@@ -8704,7 +8568,7 @@ M68KMAKE_OP(roxr, 32, r, .)
 	}
 	else
 		res = src;
-	FLAG_C = FLAG_X;
+	FLAG_C = GET_FLAG_X();
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
 	FLAG_V = VFLAG_CLEAR;
@@ -8829,7 +8693,7 @@ M68KMAKE_OP(roxl, 8, r, .)
 		return;
 	}
 
-	FLAG_C = FLAG_X;
+	FLAG_C = GET_FLAG_X();
 	FLAG_N = NFLAG_8(*r_dst);
 	FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
 	FLAG_V = VFLAG_CLEAR;
@@ -8859,7 +8723,7 @@ M68KMAKE_OP(roxl, 16, r, .)
 		return;
 	}
 
-	FLAG_C = FLAG_X;
+	FLAG_C = GET_FLAG_X();
 	FLAG_N = NFLAG_16(*r_dst);
 	FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
 	FLAG_V = VFLAG_CLEAR;
@@ -8893,7 +8757,7 @@ M68KMAKE_OP(roxl, 32, r, .)
 		return;
 	}
 
-	FLAG_C = FLAG_X;
+	FLAG_C = GET_FLAG_X();
 	FLAG_N = NFLAG_32(*r_dst);
 	FLAG_Z = *r_dst;
 	FLAG_V = VFLAG_CLEAR;
@@ -8917,7 +8781,7 @@ M68KMAKE_OP(roxl, 32, r, .)
 	}
 	else
 		res = src;
-	FLAG_C = FLAG_X;
+	FLAG_C = GET_FLAG_X();
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
 	FLAG_V = VFLAG_CLEAR;
@@ -9252,8 +9116,8 @@ M68KMAKE_OP(stop, 0, ., .)
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		CPU_STOPPED |= STOP_LEVEL_STOP;
 		m68ki_set_sr(new_sr);
-		if(m68ki_remaining_cycles >= CYC_INSTRUCTION[REG_IR])
-			m68ki_remaining_cycles = CYC_INSTRUCTION[REG_IR];
+		if(m68ki_remaining_cycles >= CYC_INSTRUCTION(REG_IR))
+			m68ki_remaining_cycles = CYC_INSTRUCTION(REG_IR);
 		else
 			USE_ALL_CYCLES();
 		return;
@@ -9350,8 +9214,7 @@ M68KMAKE_OP(sub, 32, er, d)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -9366,8 +9229,7 @@ M68KMAKE_OP(sub, 32, er, a)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -9382,8 +9244,7 @@ M68KMAKE_OP(sub, 32, er, .)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -9431,8 +9292,7 @@ M68KMAKE_OP(sub, 32, re, .)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -9561,8 +9421,7 @@ M68KMAKE_OP(subi, 32, ., d)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	*r_dst = FLAG_Z;
 }
@@ -9577,8 +9436,7 @@ M68KMAKE_OP(subi, 32, ., .)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -9665,8 +9523,7 @@ M68KMAKE_OP(subq, 32, ., d)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	*r_dst = FLAG_Z;
 }
@@ -9689,8 +9546,7 @@ M68KMAKE_OP(subq, 32, ., .)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -9740,8 +9596,7 @@ M68KMAKE_OP(subx, 32, rr, .)
 	uint res = dst - src - XFLAG_AS_1();
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	res = MASK_OUT_ABOVE_32(res);
 	FLAG_Z |= res;
@@ -9848,8 +9703,7 @@ M68KMAKE_OP(subx, 32, mm, .)
 	uint res = dst - src - XFLAG_AS_1();
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	res = MASK_OUT_ABOVE_32(res);
 	FLAG_Z |= res;
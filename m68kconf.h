@@ -87,7 +87,7 @@
  * If off, all interrupts will be autovectored and all interrupt requests will
  * auto-clear when the interrupt is serviced.
  */
-#define M68K_EMULATE_INT_ACK        OPT_OFF
+#define M68K_EMULATE_INT_ACK        OPT_ON
 #define M68K_INT_ACK_CALLBACK(A)    your_int_ack_handler_function(A)
 
 
@@ -124,7 +124,7 @@
  * large value.  This allows host programs to be nicer when it comes to
  * fetching immediate data and instructions on a banked memory system.
  */
-#define M68K_MONITOR_PC             OPT_OFF
+#define M68K_MONITOR_PC             OPT_ON
 #define M68K_SET_PC_CALLBACK(A)     your_pc_changed_handler_function(A)
 
 
@@ -135,6 +135,24 @@
 #define M68K_INSTRUCTION_CALLBACK() your_instruction_hook_function()
 
 
+/* If ON, the CPU will run copy and fill loops (a move to (Ax)+ from (Ay)+ or
+ * Dy, followed by a dbf back to the move) natively instead of one
+ * instruction at a time.  The memory pointer callback must return a pointer
+ * to the memory in 68000 byte order, or NULL if it isn't plain RAM.
+ * Loops run this way skip the instruction hook.
+ */
+#define M68K_FAST_LOOPS             OPT_ON
+#define M68K_MEMORY_POINTER_CALLBACK(A, S) your_memory_pointer_function(A, S)
+
+
+/* If ON, m68k_execute() counts how often each pair of adjacent opcode
+ * handlers runs, and m68k_write_pair_profile() writes the most frequent
+ * pairs in the format m68kmake -fuse reads.  Fused handlers don't fuse
+ * while this is on, so the counts are of the real instruction stream.
+ */
+#define M68K_PROFILE_PAIRS          OPT_OFF
+
+
 /* If ON, the CPU will emulate the 4-byte prefetch queue of a real 68000 */
 #define M68K_EMULATE_PREFETCH       OPT_OFF
 
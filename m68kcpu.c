@@ -38,6 +38,7 @@
 /* ================================ INCLUDES ============================== */
 /* ======================================================================== */
 
+#include <stdlib.h>
 #include "m68kops.h"
 #include "m68kcpu.h"
 
@@ -46,7 +47,6 @@
 /* ======================================================================== */
 
 int  m68ki_initial_cycles;
-int  m68ki_remaining_cycles = 0;                     /* Number of clocks remaining */
 uint m68ki_tracing = 0;
 uint m68ki_address_space;
 
@@ -65,8 +65,12 @@ char* m68ki_cpu_names[9] =
 };
 #endif /* M68K_LOG_ENABLE */
 
-/* The CPU core */
+/* The CPU core, with its hot state starting on a cache line */
+#ifdef __GNUC__
+m68ki_cpu_core m68ki_cpu __attribute__((aligned(64))) = {0};
+#else
 m68ki_cpu_core m68ki_cpu = {0};
+#endif
 
 #if M68K_EMULATE_ADDRESS_ERROR
 jmp_buf m68ki_aerr_trap;
@@ -397,6 +401,12 @@ static void default_pc_changed_callback(unsigned int new_pc)
 	default_pc_changed_callback_data = new_pc;
 }
 
+/* Called to get direct access to memory for fast loops */
+static unsigned char* default_memory_pointer_callback(unsigned int address, unsigned int size)
+{
+	return NULL;
+}
+
 /* Called every time there's bus activity (read/write to/from memory */
 static unsigned int default_set_fc_callback_data;
 static void default_set_fc_callback(unsigned int new_fc)
@@ -449,11 +459,11 @@ unsigned int m68k_get_reg(void* context, m68k_register_t regnum)
 									(cpu->s_flag << 11)					|
 									(cpu->m_flag << 11)					|
 									cpu->int_mask						|
-									((cpu->x_flag & XFLAG_SET) >> 4)	|
+									((m68ki_flag_x(cpu) & XFLAG_SET) >> 4)	|
 									((cpu->n_flag & NFLAG_SET) >> 4)	|
 									((!cpu->not_z_flag) << 2)			|
-									((cpu->v_flag & VFLAG_SET) >> 6)	|
-									((cpu->c_flag & CFLAG_SET) >> 8);
+									((m68ki_flag_v(cpu) & VFLAG_SET) >> 6)	|
+									((m68ki_flag_c(cpu) & CFLAG_SET) >> 8);
 		case M68K_REG_SP:	return cpu->dar[15];
 		case M68K_REG_USP:	return cpu->s_flag ? cpu->sp[0] : cpu->dar[15];
 		case M68K_REG_ISP:	return cpu->s_flag && !cpu->m_flag ? cpu->dar[15] : cpu->sp[4];
@@ -562,17 +572,29 @@ void m68k_set_instr_hook_callback(void  (*callback)(void))
 	CALLBACK_INSTR_HOOK = callback ? callback : default_instr_hook_callback;
 }
 
+void m68k_set_memory_pointer_callback(unsigned char* (*callback)(unsigned int address, unsigned int size))
+{
+	CALLBACK_MEMORY_POINTER = callback ? callback : default_memory_pointer_callback;
+}
+
 #include <stdio.h>
 /* Set the CPU type. */
 void m68k_set_cpu_type(unsigned int cpu_type)
 {
+#if M68K_OPS_000_ONLY
+	/* Nothing else was generated, and the timings are compiled in */
+	(void)cpu_type;
+	CPU_TYPE         = CPU_TYPE_000;
+	CPU_ADDRESS_MASK = 0x00ffffff;
+	CPU_SR_MASK      = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
+#else
 	switch(cpu_type)
 	{
 		case M68K_CPU_TYPE_68000:
 			CPU_TYPE         = CPU_TYPE_000;
 			CPU_ADDRESS_MASK = 0x00ffffff;
 			CPU_SR_MASK      = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-			CYC_INSTRUCTION  = m68ki_cycles[0];
+			CYC_COLUMN       = 0;
 			CYC_EXCEPTION    = m68ki_exception_cycle_table[0];
 			CYC_BCC_NOTAKE_B = -2;
 			CYC_BCC_NOTAKE_W = 2;
@@ -588,7 +610,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			CPU_TYPE         = CPU_TYPE_010;
 			CPU_ADDRESS_MASK = 0x00ffffff;
 			CPU_SR_MASK      = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-			CYC_INSTRUCTION  = m68ki_cycles[1];
+			CYC_COLUMN       = 1;
 			CYC_EXCEPTION    = m68ki_exception_cycle_table[1];
 			CYC_BCC_NOTAKE_B = -4;
 			CYC_BCC_NOTAKE_W = 0;
@@ -604,7 +626,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			CPU_TYPE         = CPU_TYPE_EC020;
 			CPU_ADDRESS_MASK = 0x00ffffff;
 			CPU_SR_MASK      = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-			CYC_INSTRUCTION  = m68ki_cycles[2];
+			CYC_COLUMN       = 2;
 			CYC_EXCEPTION    = m68ki_exception_cycle_table[2];
 			CYC_BCC_NOTAKE_B = -2;
 			CYC_BCC_NOTAKE_W = 0;
@@ -620,7 +642,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			CPU_TYPE         = CPU_TYPE_020;
 			CPU_ADDRESS_MASK = 0xffffffff;
 			CPU_SR_MASK      = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
-			CYC_INSTRUCTION  = m68ki_cycles[2];
+			CYC_COLUMN       = 2;
 			CYC_EXCEPTION    = m68ki_exception_cycle_table[2];
 			CYC_BCC_NOTAKE_B = -2;
 			CYC_BCC_NOTAKE_W = 0;
@@ -633,12 +655,106 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			CYC_RESET        = 518;
 			return;
 	}
+#endif
+}
+
+#if M68K_PROFILE_PAIRS
+#define PAIR_PROFILE_LENGTH 64
+
+/* How often each entry ran right after each other entry */
+static unsigned int* m68ki_pair_counts;
+static int m68ki_pair_prev = -1;
+
+static void m68ki_profile_pair(const m68ki_opcode_entry* op)
+{
+	int cur = op - m68ki_opcode_entries;
+
+	if(m68ki_pair_counts == NULL)
+		m68ki_pair_counts = calloc(M68K_NUM_OPCODE_ENTRIES * M68K_NUM_OPCODE_ENTRIES, sizeof(*m68ki_pair_counts));
+	if(m68ki_pair_counts != NULL && m68ki_pair_prev >= 0)
+		m68ki_pair_counts[m68ki_pair_prev * M68K_NUM_OPCODE_ENTRIES + cur]++;
+	m68ki_pair_prev = cur;
+}
+
+typedef struct
+{
+	int first;
+	int second;
+	unsigned int count;
+} m68ki_pair;
+
+static int m68ki_compare_pairs(const void* aptr, const void* bptr)
+{
+	const m68ki_pair *a = aptr, *b = bptr;
+	if(a->count != b->count)
+		return a->count < b->count ? 1 : -1;
+	if(a->first != b->first)
+		return a->first - b->first;
+	return a->second - b->second;
+}
+#endif /* M68K_PROFILE_PAIRS */
+
+int m68k_write_pair_profile(const char* filename)
+{
+#if M68K_PROFILE_PAIRS
+	static int name_of[M68K_NUM_OPCODE_ENTRIES];
+	m68ki_pair top[PAIR_PROFILE_LENGTH];
+	int num_top = 0;
+	unsigned int count;
+	FILE* file;
+	int i;
+	int j;
+
+	if(m68ki_pair_counts == NULL)
+		return -1;
+
+	/* Entries that only differ in cycles (immediate shifts) share a name,
+	 * so fold their counts into the first entry with that name.
+	 */
+	for(i = 0; i < M68K_NUM_OPCODE_ENTRIES; i++)
+		for(name_of[i] = 0; name_of[i] < i; name_of[i]++)
+			if(strcmp(m68ki_opcode_names[name_of[i]], m68ki_opcode_names[i]) == 0)
+				break;
+	for(i = 0; i < M68K_NUM_OPCODE_ENTRIES; i++)
+		for(j = 0; j < M68K_NUM_OPCODE_ENTRIES; j++)
+			if(name_of[i] != i || name_of[j] != j)
+			{
+				m68ki_pair_counts[name_of[i] * M68K_NUM_OPCODE_ENTRIES + name_of[j]] += m68ki_pair_counts[i * M68K_NUM_OPCODE_ENTRIES + j];
+				m68ki_pair_counts[i * M68K_NUM_OPCODE_ENTRIES + j] = 0;
+			}
+
+	/* Keep the most frequent pairs, sorted */
+	for(i = 0; i < M68K_NUM_OPCODE_ENTRIES; i++)
+		for(j = 0; j < M68K_NUM_OPCODE_ENTRIES; j++)
+		{
+			count = m68ki_pair_counts[i * M68K_NUM_OPCODE_ENTRIES + j];
+			if(count == 0 || (num_top == PAIR_PROFILE_LENGTH && count <= top[num_top-1].count))
+				continue;
+			if(num_top < PAIR_PROFILE_LENGTH)
+				num_top++;
+			top[num_top-1].first = i;
+			top[num_top-1].second = j;
+			top[num_top-1].count = count;
+			qsort(top, num_top, sizeof(top[0]), m68ki_compare_pairs);
+		}
+
+	if((file = fopen(filename, "w")) == NULL)
+		return -1;
+	for(i = 0; i < num_top; i++)
+		fprintf(file, "%s %s %u\n", m68ki_opcode_names[top[i].first], m68ki_opcode_names[top[i].second], top[i].count);
+	return fclose(file) == 0 ? 0 : -1;
+#else
+	(void)filename;
+	return -1;
+#endif /* M68K_PROFILE_PAIRS */
 }
 
 /* Execute some instructions until we use up num_cycles clock cycles */
 /* ASG: removed per-instruction interrupt checks */
 int m68k_execute(int num_cycles)
 {
+	const m68ki_opcode_entry* op;
+
 	/* Make sure we're not stopped */
 	if(!CPU_STOPPED)
 	{
@@ -670,8 +786,12 @@ int m68k_execute(int num_cycles)
 
 			/* Read an instruction and call its handler */
 			REG_IR = m68ki_read_imm_16();
-			m68ki_instruction_jump_table[REG_IR]();
-			USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+			op = OPCODE_ENTRY(REG_IR);
+#if M68K_PROFILE_PAIRS
+			m68ki_profile_pair(op);
+#endif /* M68K_PROFILE_PAIRS */
+			op->handler();
+			USE_CYCLES(op->cycles[CYC_COLUMN]);
 
 			/* Trace m68k_exception, if necessary */
 			m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
@@ -716,11 +836,18 @@ void m68k_modify_timeslice(int cycles)
 
 void m68k_end_timeslice(void)
 {
-	m68ki_initial_cycles = GET_CYCLES();
+	/* Leave m68k_execute() reporting only the cycles actually run */
+	m68ki_initial_cycles -= GET_CYCLES();
 	SET_CYCLES(0);
 }
 
 
+void m68k_use_cycles(int cycles)
+{
+	USE_CYCLES(cycles);
+}
+
+
 /* ASG: rewrote so that the int_level is a mask of the IPL0/IPL1/IPL2 bits */
 /* KS: Modified so that IPL* bits match with mask positions in the SR
  *     and cleaned out remenants of the interrupt controller.
@@ -740,21 +867,13 @@ void m68k_set_irq(unsigned int int_level)
 
 void m68k_init(void)
 {
-	static uint emulation_initialized = 0;
-
-	/* The first call to this function initializes the opcode handler jump table */
-	if(!emulation_initialized)
-		{
-		m68ki_build_opcode_table();
-		emulation_initialized = 1;
-	}
-
 	m68k_set_int_ack_callback(NULL);
 	m68k_set_bkpt_ack_callback(NULL);
 	m68k_set_reset_instr_callback(NULL);
 	m68k_set_pc_changed_callback(NULL);
 	m68k_set_fc_callback(NULL);
 	m68k_set_instr_hook_callback(NULL);
+	m68k_set_memory_pointer_callback(NULL);
 }
 
 /* Pulse the RESET line on the CPU */
@@ -814,7 +933,13 @@ unsigned int m68k_get_context(void* dst)
 
 void m68k_set_context(void* src)
 {
-	if(src) m68ki_cpu = *(m68ki_cpu_core*)src;
+	/* The cycle count belongs to the running timeslice, not the context */
+	if(src)
+	{
+		sint remaining_cycles = GET_CYCLES();
+		m68ki_cpu = *(m68ki_cpu_core*)src;
+		SET_CYCLES(remaining_cycles);
+	}
 }
 
 
@@ -34,7 +34,9 @@
 #define M68KCPU__HEADER
 
 #include "m68k.h"
+#include "m68kops.h"
 #include <limits.h>
+#include <string.h>
 
 #if M68K_EMULATE_ADDRESS_ERROR
 #include <setjmp.h>
@@ -325,11 +327,19 @@
 #define FLAG_T0          m68ki_cpu.t0_flag
 #define FLAG_S           m68ki_cpu.s_flag
 #define FLAG_M           m68ki_cpu.m_flag
-#define FLAG_X           m68ki_cpu.x_flag
 #define FLAG_N           m68ki_cpu.n_flag
 #define FLAG_Z           m68ki_cpu.not_z_flag
-#define FLAG_V           m68ki_cpu.v_flag
-#define FLAG_C           m68ki_cpu.c_flag
+
+/* X, V and C may still be pending from a 32-bit ADD/SUB/CMP.  Using them
+ * through these macros drops that (so assign away), but read them with
+ * GET_FLAG_X() and friends.
+ */
+#define FLAG_X           (*(m68ki_cpu.x_lazy = 0, &m68ki_cpu.x_flag))
+#define FLAG_V           (*(m68ki_cpu.v_lazy = 0, &m68ki_cpu.v_flag))
+#define FLAG_C           (*(m68ki_cpu.c_lazy = 0, &m68ki_cpu.c_flag))
+#define GET_FLAG_X()     m68ki_flag_x(&m68ki_cpu)
+#define GET_FLAG_V()     m68ki_flag_v(&m68ki_cpu)
+#define GET_FLAG_C()     m68ki_flag_c(&m68ki_cpu)
 #define FLAG_INT_MASK    m68ki_cpu.int_mask
 
 #define CPU_INT_LEVEL    m68ki_cpu.int_level /* ASG: changed from CPU_INTS_PENDING */
@@ -342,7 +352,25 @@
 #define CPU_INSTR_MODE   m68ki_cpu.instr_mode
 #define CPU_RUN_MODE     m68ki_cpu.run_mode
 
-#define CYC_INSTRUCTION  m68ki_cpu.cyc_instruction
+#if M68K_OPS_000_ONLY && (M68K_EMULATE_010 == OPT_ON || M68K_EMULATE_EC020 == OPT_ON || M68K_EMULATE_020 == OPT_ON)
+#error "The opcode handlers were generated for the 68000 only (m68kmake -000)"
+#endif
+
+#if M68K_OPS_000_ONLY
+/* The generated core only knows the 68000, so its timings are constants */
+#define CYC_COLUMN       0
+#define CYC_EXCEPTION    m68ki_exception_cycle_table[0]
+#define CYC_BCC_NOTAKE_B -2
+#define CYC_BCC_NOTAKE_W 2
+#define CYC_DBCC_F_NOEXP -2
+#define CYC_DBCC_F_EXP   2
+#define CYC_SCC_R_TRUE   2
+#define CYC_MOVEM_W      2
+#define CYC_MOVEM_L      3
+#define CYC_SHIFT        1
+#define CYC_RESET        132
+#else
+#define CYC_COLUMN       m68ki_cpu.cyc_column
 #define CYC_EXCEPTION    m68ki_cpu.cyc_exception
 #define CYC_BCC_NOTAKE_B m68ki_cpu.cyc_bcc_notake_b
 #define CYC_BCC_NOTAKE_W m68ki_cpu.cyc_bcc_notake_w
@@ -353,6 +381,11 @@
 #define CYC_MOVEM_L      m68ki_cpu.cyc_movem_l
 #define CYC_SHIFT        m68ki_cpu.cyc_shift
 #define CYC_RESET        m68ki_cpu.cyc_reset
+#endif
+
+/* Handler table entry for an opcode word, and the base cycles it takes */
+#define OPCODE_ENTRY(A)     (&m68ki_opcode_entries[m68ki_opcode_index[A]])
+#define CYC_INSTRUCTION(A)  (OPCODE_ENTRY(A)->cycles[CYC_COLUMN])
 
 
 #define CALLBACK_INT_ACK     m68ki_cpu.int_ack_callback
@@ -361,6 +394,7 @@
 #define CALLBACK_PC_CHANGED  m68ki_cpu.pc_changed_callback
 #define CALLBACK_SET_FC      m68ki_cpu.set_fc_callback
 #define CALLBACK_INSTR_HOOK  m68ki_cpu.instr_hook_callback
+#define CALLBACK_MEMORY_POINTER m68ki_cpu.memory_pointer_callback
 
 
 
@@ -470,6 +504,17 @@
 	#define m68ki_pc_changed(A)
 #endif /* M68K_MONITOR_PC */
 
+#if M68K_FAST_LOOPS
+	#if M68K_FAST_LOOPS == OPT_SPECIFY_HANDLER
+		#define m68ki_memory_pointer(A, S) M68K_MEMORY_POINTER_CALLBACK(A, S)
+	#else
+		#define m68ki_memory_pointer(A, S) CALLBACK_MEMORY_POINTER(A, S)
+	#endif
+	#define m68ki_fast_loop(R) m68ki_dbf_fast_loop(R)
+#else
+	#define m68ki_fast_loop(R)
+#endif /* M68K_FAST_LOOPS */
+
 
 /* Enable or disable function code emulation */
 #if M68K_EMULATE_FC
@@ -685,23 +730,23 @@
 #define MFLAG_CLEAR 0
 
 /* Turn flag values into 1 or 0 */
-#define XFLAG_AS_1() ((FLAG_X>>8)&1)
+#define XFLAG_AS_1() ((GET_FLAG_X()>>8)&1)
 #define NFLAG_AS_1() ((FLAG_N>>7)&1)
-#define VFLAG_AS_1() ((FLAG_V>>7)&1)
+#define VFLAG_AS_1() ((GET_FLAG_V()>>7)&1)
 #define ZFLAG_AS_1() (!FLAG_Z)
-#define CFLAG_AS_1() ((FLAG_C>>8)&1)
+#define CFLAG_AS_1() ((GET_FLAG_C()>>8)&1)
 
 
 /* Conditions */
-#define COND_CS() (FLAG_C&0x100)
+#define COND_CS() (GET_FLAG_C()&0x100)
 #define COND_CC() (!COND_CS())
-#define COND_VS() (FLAG_V&0x80)
+#define COND_VS() (GET_FLAG_V()&0x80)
 #define COND_VC() (!COND_VS())
 #define COND_NE() FLAG_Z
 #define COND_EQ() (!COND_NE())
 #define COND_MI() (FLAG_N&0x80)
 #define COND_PL() (!COND_MI())
-#define COND_LT() ((FLAG_N^FLAG_V)&0x80)
+#define COND_LT() ((FLAG_N^GET_FLAG_V())&0x80)
 #define COND_GE() (!COND_LT())
 #define COND_HI() (COND_CC() && COND_NE())
 #define COND_LS() (COND_CS() || COND_EQ())
@@ -725,7 +770,7 @@
 #define COND_NOT_LE() COND_GT()
 
 /* Not real conditions, but here for convenience */
-#define COND_XS() (FLAG_X&0x100)
+#define COND_XS() (GET_FLAG_X()&0x100)
 #define COND_XC() (!COND_XS)
 
 
@@ -748,11 +793,14 @@
 
 /* ---------------------------- Cycle Counting ---------------------------- */
 
+/* Kept in the core next to PC, under its old name */
+#define m68ki_remaining_cycles m68ki_cpu.remaining_cycles
+
 #define ADD_CYCLES(A)    m68ki_remaining_cycles += (A)
 #define USE_CYCLES(A)    m68ki_remaining_cycles -= (A)
 #define SET_CYCLES(A)    m68ki_remaining_cycles = A
 #define GET_CYCLES()     m68ki_remaining_cycles
-#define USE_ALL_CYCLES() m68ki_remaining_cycles %= CYC_INSTRUCTION[REG_IR]
+#define USE_ALL_CYCLES() m68ki_remaining_cycles %= CYC_INSTRUCTION(REG_IR)
 
 
 
@@ -800,34 +848,48 @@
 
 typedef struct
 {
-	uint cpu_type;     /* CPU Type: 68000, 68010, 68EC020, or 68020 */
+	/* Touched by nearly every instruction: the registers fill the first
+	 * cache line, and PC, the flags and the cycle count the second.
+	 */
 	uint dar[16];      /* Data and Address Registers */
-	uint ppc;		   /* Previous program counter */
 	uint pc;           /* Program Counter */
-	uint sp[7];        /* User, Interrupt, and Master Stack Pointers */
-	uint vbr;          /* Vector Base Register (m68010+) */
-	uint sfc;          /* Source Function Code Register (m68010+) */
-	uint dfc;          /* Destination Function Code Register (m68010+) */
-	uint cacr;         /* Cache Control Register (m68020, unemulated) */
-	uint caar;         /* Cache Address Register (m68020, unemulated) */
+	uint ppc;		   /* Previous program counter */
 	uint ir;           /* Instruction Register */
-	uint t1_flag;      /* Trace 1 */
-	uint t0_flag;      /* Trace 0 */
-	uint s_flag;       /* Supervisor */
-	uint m_flag;       /* Master/Interrupt state */
+	sint remaining_cycles; /* Number of clocks left in this timeslice */
 	uint x_flag;       /* Extend */
 	uint n_flag;       /* Negative */
 	uint not_z_flag;   /* Zero, inverted for speedups */
 	uint v_flag;       /* Overflow */
 	uint c_flag;       /* Carry */
+	uint x_lazy;       /* X, V and C pending from a 32-bit ADD/SUB/CMP */
+	uint v_lazy;
+	uint c_lazy;
+	uint lazy_src;     /* ...and the operands and result to get them from */
+	uint lazy_dst;
+	uint lazy_res;
+	uint address_mask; /* Available address pins */
+
+	/* The rest of the status register and the run state */
+	uint s_flag;       /* Supervisor */
 	uint int_mask;     /* I0-I2 */
+	uint sr_mask;      /* Implemented status register bits */
+	uint stopped;      /* Stopped state */
 	uint int_level;    /* State of interrupt pins IPL0-IPL2 -- ASG: changed from ints_pending */
 	uint int_cycles;   /* ASG: extra cycles from generated interrupts */
-	uint stopped;      /* Stopped state */
+	uint cyc_column;   /* of m68ki_opcode_entries[].cycles */
+	uint t1_flag;      /* Trace 1 */
+	uint t0_flag;      /* Trace 0 */
+	uint m_flag;       /* Master/Interrupt state */
+
+	uint cpu_type;     /* CPU Type: 68000, 68010, 68EC020, or 68020 */
+	uint sp[7];        /* User, Interrupt, and Master Stack Pointers */
+	uint vbr;          /* Vector Base Register (m68010+) */
+	uint sfc;          /* Source Function Code Register (m68010+) */
+	uint dfc;          /* Destination Function Code Register (m68010+) */
+	uint cacr;         /* Cache Control Register (m68020, unemulated) */
+	uint caar;         /* Cache Address Register (m68020, unemulated) */
 	uint pref_addr;    /* Last prefetch address */
 	uint pref_data;    /* Data in the prefetch queue */
-	uint address_mask; /* Available address pins */
-	uint sr_mask;      /* Implemented status register bits */
 	uint instr_mode;   /* Stores whether we are in instruction mode or group 0/1 exception mode */
 	uint run_mode;     /* Stores whether we are processing a reset, bus error, address error, or something else */
 
@@ -841,7 +903,6 @@ typedef struct
 	uint cyc_movem_l;
 	uint cyc_shift;
 	uint cyc_reset;
-	uint8* cyc_instruction;
 	uint8* cyc_exception;
 
 	/* Callbacks to host */
@@ -851,12 +912,12 @@ typedef struct
 	void (*pc_changed_callback)(unsigned int new_pc); /* Called when the PC changes by a large amount */
 	void (*set_fc_callback)(unsigned int new_fc);     /* Called when the CPU function code changes */
 	void (*instr_hook_callback)(void);                /* Called every instruction cycle prior to execution */
+	unsigned char* (*memory_pointer_callback)(unsigned int address, unsigned int size); /* Direct access to plain RAM */
 
 } m68ki_cpu_core;
 
 
 extern m68ki_cpu_core m68ki_cpu;
-extern sint           m68ki_remaining_cycles;
 extern uint           m68ki_tracing;
 extern uint8          m68ki_shift_8_table[];
 extern uint16         m68ki_shift_16_table[];
@@ -1381,6 +1442,156 @@ INLINE void m68ki_branch_32(uint offset)
 }
 
 
+#if M68K_FAST_LOOPS
+/* Called by dbf after it has branched back over a single instruction.  If
+ * that instruction is a move to (Ax)+ from (Ay)+ or Dy, run as many more
+ * iterations natively as the timeslice has room for.  The last iteration
+ * and the loop exit are always left to the interpreter, so registers, flags,
+ * PC and cycles end up exactly where instruction-at-a-time execution would
+ * leave them at the same point.
+ */
+INLINE void m68ki_dbf_fast_loop(uint* r_counter)
+{
+	uint ir = m68ki_read_program_16(REG_PC);
+	uint size;
+	uint* r_src = NULL;
+	uint* r_dst = &REG_A[(ir>>9)&7];
+	uint src = 0;
+	uint dst = *r_dst;
+	uint count = MASK_OUT_ABOVE_16(*r_counter);
+	sint avail = GET_CYCLES() - CYC_INSTRUCTION(REG_IR);
+	uint cost;
+	uint len;
+	uint i;
+	uint value = 0;
+	unsigned char* p_dst;
+	unsigned char* p_src = NULL;
+
+#if M68K_EMULATE_TRACE
+	if(FLAG_T1)
+		return;
+#endif /* M68K_EMULATE_TRACE */
+
+	/* move with a postincrement destination */
+	if((ir & 0xc1c0) != 0x00c0)
+		return;
+	switch(ir & 0x3000)
+	{
+		case 0x1000: size = 1; break;
+		case 0x3000: size = 2; break;
+		case 0x2000: size = 4; break;
+		default: return;
+	}
+	switch(ir & 0x38)
+	{
+		case 0x00:	/* Dy */
+			if(&REG_D[ir&7] == r_counter)
+				return;
+			value = REG_D[ir&7];
+			break;
+		case 0x18:	/* (Ay)+ */
+			r_src = &REG_A[ir&7];
+			if(r_src == r_dst || (size == 1 && (ir&7) == 7))
+				return;
+			src = *r_src;
+			break;
+		default:
+			return;
+	}
+	if(size == 1 && r_dst == &REG_A[7])
+		return;
+	if(size > 1 && ((dst | src) & 1))
+		return;
+
+	cost = CYC_INSTRUCTION(ir) + CYC_INSTRUCTION(REG_IR) + CYC_DBCC_F_NOEXP;
+	if(avail <= (sint)cost)
+		return;
+	if(count > (uint)(avail - 1) / cost)
+		count = (uint)(avail - 1) / cost;
+	if(count < 2)
+		return;
+
+	len = count * size;
+	p_dst = m68ki_memory_pointer(ADDRESS_68K(dst), len);
+	if(p_dst == NULL)
+		return;
+	if(r_src != NULL)
+	{
+		/* Overlapping forward copies repeat a pattern, leave those alone */
+		if(ADDRESS_68K(dst) > ADDRESS_68K(src) && ADDRESS_68K(dst) - ADDRESS_68K(src) < len)
+			return;
+		p_src = m68ki_memory_pointer(ADDRESS_68K(src), len);
+		if(p_src == NULL)
+			return;
+		memmove(p_dst, p_src, len);
+		for(i = 0; i < size; i++)
+			value = (value << 8) | p_dst[len - size + i];
+		*r_src = MASK_OUT_ABOVE_32(src + len);
+	}
+	else
+	{
+		for(i = 0; i < size; i++)
+			p_dst[i] = value >> ((size - 1 - i) * 8);
+		for(i = size; i < len; i++)
+			p_dst[i] = p_dst[i - size];
+	}
+
+	*r_dst = MASK_OUT_ABOVE_32(dst + len);
+	*r_counter = MASK_OUT_BELOW_16(*r_counter) | (MASK_OUT_ABOVE_16(*r_counter) - count);
+
+	switch(size)
+	{
+		case 1: value = MASK_OUT_ABOVE_8(value);  FLAG_N = NFLAG_8(value);  break;
+		case 2: value = MASK_OUT_ABOVE_16(value); FLAG_N = NFLAG_16(value); break;
+		default: value = MASK_OUT_ABOVE_32(value); FLAG_N = NFLAG_32(value); break;
+	}
+	FLAG_Z = value;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	USE_CYCLES(count * cost);
+}
+#endif /* M68K_FAST_LOOPS */
+
+
+/* Used by the fused handlers m68kmake generates for the pairs listed in
+ * m68kfuse.txt.  Peek at the next opcode word, unless the main loop wouldn't
+ * run it in this timeslice after the current instruction (which costs
+ * cycles) or has to see it itself.
+ */
+INLINE int m68ki_fused_peek(uint cycles, uint* word)
+{
+#if M68K_EMULATE_TRACE || M68K_INSTRUCTION_HOOK || M68K_EMULATE_PREFETCH || M68K_PROFILE_PAIRS
+	return 0;
+#else
+	if(GET_CYCLES() <= (sint)cycles)
+		return 0;
+	*word = m68k_read_immediate_16(ADDRESS_68K(REG_PC));
+	return 1;
+#endif
+}
+
+/* Run the peeked instruction between these as the main loop would.  The
+ * current instruction is charged while it runs, so the handler sees the same
+ * cycle count, and then refunded since the main loop charges it when the
+ * fused handler returns.
+ */
+INLINE void m68ki_fused_start(uint cycles, uint word)
+{
+	USE_CYCLES(cycles);
+	m68ki_use_data_space(); /* auto-disable (see m68kcpu.h) */
+	REG_PPC = REG_PC;
+	REG_PC += 2;
+	REG_IR = word;
+}
+
+INLINE void m68ki_fused_end(uint cycles, uint word)
+{
+	USE_CYCLES(CYC_INSTRUCTION(word));
+	ADD_CYCLES(cycles);
+}
+
+
 
 /* ---------------------------- Status Register --------------------------- */
 
@@ -1420,6 +1631,78 @@ INLINE void m68ki_set_sm_flag_nosp(uint value)
 }
 
 
+/* Work out flags a 32-bit ADD/SUB/CMP left pending */
+#define LAZY_ADD_32 1
+#define LAZY_SUB_32 2
+
+INLINE uint m68ki_lazy_carry(const m68ki_cpu_core* cpu, uint kind)
+{
+	uint src = cpu->lazy_src;
+	uint dst = cpu->lazy_dst;
+	uint res = cpu->lazy_res;
+
+	if(kind == LAZY_ADD_32)
+		return CFLAG_ADD_32(src, dst, res);
+	return CFLAG_SUB_32(src, dst, res);
+}
+
+INLINE uint m68ki_lazy_overflow(const m68ki_cpu_core* cpu, uint kind)
+{
+	uint src = cpu->lazy_src;
+	uint dst = cpu->lazy_dst;
+	uint res = cpu->lazy_res;
+
+	if(kind == LAZY_ADD_32)
+		return VFLAG_ADD_32(src, dst, res);
+	return VFLAG_SUB_32(src, dst, res);
+}
+
+INLINE uint m68ki_flag_x(const m68ki_cpu_core* cpu)
+{
+	return cpu->x_lazy ? m68ki_lazy_carry(cpu, cpu->x_lazy) : cpu->x_flag;
+}
+
+INLINE uint m68ki_flag_v(const m68ki_cpu_core* cpu)
+{
+	return cpu->v_lazy ? m68ki_lazy_overflow(cpu, cpu->v_lazy) : cpu->v_flag;
+}
+
+INLINE uint m68ki_flag_c(const m68ki_cpu_core* cpu)
+{
+	return cpu->c_lazy ? m68ki_lazy_carry(cpu, cpu->c_lazy) : cpu->c_flag;
+}
+
+/* Leave V, C and (unless it's a compare) X for whoever reads them */
+INLINE void m68ki_lazy_add_32(uint src, uint dst, uint res)
+{
+	m68ki_cpu.lazy_src = src;
+	m68ki_cpu.lazy_dst = dst;
+	m68ki_cpu.lazy_res = res;
+	m68ki_cpu.x_lazy = m68ki_cpu.v_lazy = m68ki_cpu.c_lazy = LAZY_ADD_32;
+}
+
+INLINE void m68ki_lazy_sub_32(uint src, uint dst, uint res)
+{
+	m68ki_cpu.lazy_src = src;
+	m68ki_cpu.lazy_dst = dst;
+	m68ki_cpu.lazy_res = res;
+	m68ki_cpu.x_lazy = m68ki_cpu.v_lazy = m68ki_cpu.c_lazy = LAZY_SUB_32;
+}
+
+INLINE void m68ki_lazy_cmp_32(uint src, uint dst, uint res)
+{
+	/* A pending X needs the operands we're about to replace */
+	if(m68ki_cpu.x_lazy)
+	{
+		m68ki_cpu.x_flag = m68ki_lazy_carry(&m68ki_cpu, m68ki_cpu.x_lazy);
+		m68ki_cpu.x_lazy = 0;
+	}
+	m68ki_cpu.lazy_src = src;
+	m68ki_cpu.lazy_dst = dst;
+	m68ki_cpu.lazy_res = res;
+	m68ki_cpu.v_lazy = m68ki_cpu.c_lazy = LAZY_SUB_32;
+}
+
 /* Set the condition code register */
 INLINE void m68ki_set_ccr(uint value)
 {
@@ -1733,7 +2016,7 @@ INLINE void m68ki_exception_trap(uint vector)
 	m68ki_jump_vector(vector);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	USE_CYCLES(CYC_EXCEPTION[vector] - CYC_INSTRUCTION[REG_IR]);
+	USE_CYCLES(CYC_EXCEPTION[vector] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Trap#n stacks a 0 frame but behaves like group2 otherwise */
@@ -1744,7 +2027,7 @@ INLINE void m68ki_exception_trapN(uint vector)
 	m68ki_jump_vector(vector);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	USE_CYCLES(CYC_EXCEPTION[vector] - CYC_INSTRUCTION[REG_IR]);
+	USE_CYCLES(CYC_EXCEPTION[vector] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Exception for trace mode */
@@ -1790,7 +2073,7 @@ INLINE void m68ki_exception_privilege_violation(void)
 	m68ki_jump_vector(EXCEPTION_PRIVILEGE_VIOLATION);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_PRIVILEGE_VIOLATION] - CYC_INSTRUCTION[REG_IR]);
+	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_PRIVILEGE_VIOLATION] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Exception for A-Line instructions */
@@ -1808,7 +2091,7 @@ INLINE void m68ki_exception_1010(void)
 	m68ki_jump_vector(EXCEPTION_1010);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_1010] - CYC_INSTRUCTION[REG_IR]);
+	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_1010] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Exception for F-Line instructions */
@@ -1827,7 +2110,7 @@ INLINE void m68ki_exception_1111(void)
 	m68ki_jump_vector(EXCEPTION_1111);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_1111] - CYC_INSTRUCTION[REG_IR]);
+	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_1111] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Exception for illegal instructions */
@@ -1852,7 +2135,7 @@ INLINE void m68ki_exception_illegal(void)
 	m68ki_jump_vector(EXCEPTION_ILLEGAL_INSTRUCTION);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_ILLEGAL_INSTRUCTION] - CYC_INSTRUCTION[REG_IR]);
+	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_ILLEGAL_INSTRUCTION] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Exception for format errror in RTE */
@@ -1863,7 +2146,7 @@ INLINE void m68ki_exception_format_error(void)
 	m68ki_jump_vector(EXCEPTION_FORMAT_ERROR);
 
 	/* Use up some clock cycles and undo the instruction's cycles */
-	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_FORMAT_ERROR] - CYC_INSTRUCTION[REG_IR]);
+	USE_CYCLES(CYC_EXCEPTION[EXCEPTION_FORMAT_ERROR] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Exception for address error */
@@ -36,6 +36,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <pthread.h>
 #include "m68k.h"
 
 #ifndef DECL_SPEC
@@ -3472,6 +3473,837 @@ unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cp
 
 
 
+/* ======================================================================== */
+/* ======================== STRUCTURED DISASSEMBLY ======================== */
+/* ======================================================================== */
+/* The structured disassembler decodes 68000 instructions into an
+ * m68k_dasm_info instead of a string.  It keeps no state between calls, so
+ * any number of threads may decode at once.  Opcode validity comes from the
+ * same table as m68k_disassemble(); each 68000 handler there is mapped to
+ * an operand layout below.  Only the brief index extension word format is
+ * decoded, since that is all the 68000 understands.
+ */
+
+/* Operand layouts */
+enum
+{
+	INFO_NONE,		/* no operands */
+	INFO_EA,		/* <ea> */
+	INFO_EA_D,		/* <ea>, Dx */
+	INFO_D_EA,		/* Dx, <ea> */
+	INFO_EA_A,		/* <ea>, Ax */
+	INFO_IMM_EA,	/* #<data>, <ea> */
+	INFO_QUICK_EA,	/* #<1-8>, <ea> */
+	INFO_BIT_S,		/* #<bit>, <ea> */
+	INFO_IMM_CCR,	/* #<data>, CCR */
+	INFO_IMM_SR,	/* #<data>, SR */
+	INFO_DD,		/* Dy, Dx */
+	INFO_PD_PD,		/* -(Ay), -(Ax) */
+	INFO_PI_PI,		/* (Ay)+, (Ax)+ */
+	INFO_SHIFT_S,	/* #<1-8>, Dy */
+	INFO_SHIFT_R,	/* Dx, Dy */
+	INFO_BRANCH_8,	/* <label> */
+	INFO_BRANCH_16,	/* <label> */
+	INFO_DBCC,		/* Dy, <label> */
+	INFO_MOVE,		/* <ea>, <ea> */
+	INFO_MOVEQ,		/* #<data>, Dx */
+	INFO_EA_CCR,	/* <ea>, CCR */
+	INFO_EA_SR,		/* <ea>, SR */
+	INFO_SR_EA,		/* SR, <ea> */
+	INFO_USP_A,		/* USP, Ay */
+	INFO_A_USP,		/* Ay, USP */
+	INFO_MOVEM_RE,	/* <list>, <ea> */
+	INFO_MOVEM_PD,	/* <list>, -(Ay) */
+	INFO_MOVEM_ER,	/* <ea>, <list> */
+	INFO_MOVEP_ER,	/* (d16,Ay), Dx */
+	INFO_MOVEP_RE,	/* Dx, (d16,Ay) */
+	INFO_EXG_DD,	/* Dx, Dy */
+	INFO_EXG_AA,	/* Ax, Ay */
+	INFO_EXG_DA,	/* Dx, Ay */
+	INFO_D,			/* Dy */
+	INFO_A,			/* Ay */
+	INFO_LINK,		/* Ay, #<disp> */
+	INFO_TRAP,		/* #<vector> */
+	INFO_STOP		/* #<data> */
+};
+
+/* used to map disassembler handlers to operand layouts */
+typedef struct
+{
+	void (*opcode_handler)(void); /* handler in g_instruction_table */
+	unsigned char mnemonic;       /* M68K_MN_* */
+	unsigned char size;           /* operation size in bytes */
+	unsigned char layout;         /* INFO_* */
+} info_struct;
+
+/* Where the structured disassembler gets its instruction words from */
+typedef struct
+{
+	uint pc;                  /* address of the next word */
+	const unsigned char* buf; /* memory image, or NULL to use the callbacks */
+	uint base;                /* address of buf[0] */
+	uint length;              /* size of buf */
+	uint truncated;           /* set when reading past the end of buf */
+} info_reader;
+
+/* Entry 0 is used for anything that isn't a 68000 instruction */
+static info_struct g_info_opcode[] =
+{
+/*  opcode handler        mnemonic         size layout */
+	{0                   , M68K_MN_INVALID , 0, INFO_NONE     },
+	{d68000_1010         , M68K_MN_LINE_A  , 0, INFO_NONE     },
+	{d68000_1111         , M68K_MN_LINE_F  , 0, INFO_NONE     },
+	{d68000_abcd_rr      , M68K_MN_ABCD    , 1, INFO_DD       },
+	{d68000_abcd_mm      , M68K_MN_ABCD    , 1, INFO_PD_PD    },
+	{d68000_add_er_8     , M68K_MN_ADD     , 1, INFO_EA_D     },
+	{d68000_add_er_16    , M68K_MN_ADD     , 2, INFO_EA_D     },
+	{d68000_add_er_32    , M68K_MN_ADD     , 4, INFO_EA_D     },
+	{d68000_add_re_8     , M68K_MN_ADD     , 1, INFO_D_EA     },
+	{d68000_add_re_16    , M68K_MN_ADD     , 2, INFO_D_EA     },
+	{d68000_add_re_32    , M68K_MN_ADD     , 4, INFO_D_EA     },
+	{d68000_adda_16      , M68K_MN_ADDA    , 2, INFO_EA_A     },
+	{d68000_adda_32      , M68K_MN_ADDA    , 4, INFO_EA_A     },
+	{d68000_addi_8       , M68K_MN_ADDI    , 1, INFO_IMM_EA   },
+	{d68000_addi_16      , M68K_MN_ADDI    , 2, INFO_IMM_EA   },
+	{d68000_addi_32      , M68K_MN_ADDI    , 4, INFO_IMM_EA   },
+	{d68000_addq_8       , M68K_MN_ADDQ    , 1, INFO_QUICK_EA },
+	{d68000_addq_16      , M68K_MN_ADDQ    , 2, INFO_QUICK_EA },
+	{d68000_addq_32      , M68K_MN_ADDQ    , 4, INFO_QUICK_EA },
+	{d68000_addx_rr_8    , M68K_MN_ADDX    , 1, INFO_DD       },
+	{d68000_addx_rr_16   , M68K_MN_ADDX    , 2, INFO_DD       },
+	{d68000_addx_rr_32   , M68K_MN_ADDX    , 4, INFO_DD       },
+	{d68000_addx_mm_8    , M68K_MN_ADDX    , 1, INFO_PD_PD    },
+	{d68000_addx_mm_16   , M68K_MN_ADDX    , 2, INFO_PD_PD    },
+	{d68000_addx_mm_32   , M68K_MN_ADDX    , 4, INFO_PD_PD    },
+	{d68000_and_er_8     , M68K_MN_AND     , 1, INFO_EA_D     },
+	{d68000_and_er_16    , M68K_MN_AND     , 2, INFO_EA_D     },
+	{d68000_and_er_32    , M68K_MN_AND     , 4, INFO_EA_D     },
+	{d68000_and_re_8     , M68K_MN_AND     , 1, INFO_D_EA     },
+	{d68000_and_re_16    , M68K_MN_AND     , 2, INFO_D_EA     },
+	{d68000_and_re_32    , M68K_MN_AND     , 4, INFO_D_EA     },
+	{d68000_andi_to_ccr  , M68K_MN_ANDI    , 1, INFO_IMM_CCR  },
+	{d68000_andi_to_sr   , M68K_MN_ANDI    , 2, INFO_IMM_SR   },
+	{d68000_andi_8       , M68K_MN_ANDI    , 1, INFO_IMM_EA   },
+	{d68000_andi_16      , M68K_MN_ANDI    , 2, INFO_IMM_EA   },
+	{d68000_andi_32      , M68K_MN_ANDI    , 4, INFO_IMM_EA   },
+	{d68000_asr_s_8      , M68K_MN_ASR     , 1, INFO_SHIFT_S  },
+	{d68000_asr_s_16     , M68K_MN_ASR     , 2, INFO_SHIFT_S  },
+	{d68000_asr_s_32     , M68K_MN_ASR     , 4, INFO_SHIFT_S  },
+	{d68000_asr_r_8      , M68K_MN_ASR     , 1, INFO_SHIFT_R  },
+	{d68000_asr_r_16     , M68K_MN_ASR     , 2, INFO_SHIFT_R  },
+	{d68000_asr_r_32     , M68K_MN_ASR     , 4, INFO_SHIFT_R  },
+	{d68000_asr_ea       , M68K_MN_ASR     , 2, INFO_EA       },
+	{d68000_asl_s_8      , M68K_MN_ASL     , 1, INFO_SHIFT_S  },
+	{d68000_asl_s_16     , M68K_MN_ASL     , 2, INFO_SHIFT_S  },
+	{d68000_asl_s_32     , M68K_MN_ASL     , 4, INFO_SHIFT_S  },
+	{d68000_asl_r_8      , M68K_MN_ASL     , 1, INFO_SHIFT_R  },
+	{d68000_asl_r_16     , M68K_MN_ASL     , 2, INFO_SHIFT_R  },
+	{d68000_asl_r_32     , M68K_MN_ASL     , 4, INFO_SHIFT_R  },
+	{d68000_asl_ea       , M68K_MN_ASL     , 2, INFO_EA       },
+	{d68000_bcc_8        , M68K_MN_BCC     , 0, INFO_BRANCH_8 },
+	{d68000_bcc_16       , M68K_MN_BCC     , 0, INFO_BRANCH_16},
+	{d68000_bchg_r       , M68K_MN_BCHG    , 1, INFO_D_EA     },
+	{d68000_bchg_s       , M68K_MN_BCHG    , 1, INFO_BIT_S    },
+	{d68000_bclr_r       , M68K_MN_BCLR    , 1, INFO_D_EA     },
+	{d68000_bclr_s       , M68K_MN_BCLR    , 1, INFO_BIT_S    },
+	{d68000_bra_8        , M68K_MN_BRA     , 0, INFO_BRANCH_8 },
+	{d68000_bra_16       , M68K_MN_BRA     , 0, INFO_BRANCH_16},
+	{d68000_bset_r       , M68K_MN_BSET    , 1, INFO_D_EA     },
+	{d68000_bset_s       , M68K_MN_BSET    , 1, INFO_BIT_S    },
+	{d68000_bsr_8        , M68K_MN_BSR     , 0, INFO_BRANCH_8 },
+	{d68000_bsr_16       , M68K_MN_BSR     , 0, INFO_BRANCH_16},
+	{d68000_btst_r       , M68K_MN_BTST    , 1, INFO_D_EA     },
+	{d68000_btst_s       , M68K_MN_BTST    , 1, INFO_BIT_S    },
+	{d68000_chk_16       , M68K_MN_CHK     , 2, INFO_EA_D     },
+	{d68000_clr_8        , M68K_MN_CLR     , 1, INFO_EA       },
+	{d68000_clr_16       , M68K_MN_CLR     , 2, INFO_EA       },
+	{d68000_clr_32       , M68K_MN_CLR     , 4, INFO_EA       },
+	{d68000_cmp_8        , M68K_MN_CMP     , 1, INFO_EA_D     },
+	{d68000_cmp_16       , M68K_MN_CMP     , 2, INFO_EA_D     },
+	{d68000_cmp_32       , M68K_MN_CMP     , 4, INFO_EA_D     },
+	{d68000_cmpa_16      , M68K_MN_CMPA    , 2, INFO_EA_A     },
+	{d68000_cmpa_32      , M68K_MN_CMPA    , 4, INFO_EA_A     },
+	{d68000_cmpi_8       , M68K_MN_CMPI    , 1, INFO_IMM_EA   },
+	{d68000_cmpi_16      , M68K_MN_CMPI    , 2, INFO_IMM_EA   },
+	{d68000_cmpi_32      , M68K_MN_CMPI    , 4, INFO_IMM_EA   },
+	{d68000_cmpm_8       , M68K_MN_CMPM    , 1, INFO_PI_PI    },
+	{d68000_cmpm_16      , M68K_MN_CMPM    , 2, INFO_PI_PI    },
+	{d68000_cmpm_32      , M68K_MN_CMPM    , 4, INFO_PI_PI    },
+	{d68000_dbcc         , M68K_MN_DBCC    , 2, INFO_DBCC     },
+	{d68000_dbra         , M68K_MN_DBCC    , 2, INFO_DBCC     },
+	{d68000_divs         , M68K_MN_DIVS    , 2, INFO_EA_D     },
+	{d68000_divu         , M68K_MN_DIVU    , 2, INFO_EA_D     },
+	{d68000_eor_8        , M68K_MN_EOR     , 1, INFO_D_EA     },
+	{d68000_eor_16       , M68K_MN_EOR     , 2, INFO_D_EA     },
+	{d68000_eor_32       , M68K_MN_EOR     , 4, INFO_D_EA     },
+	{d68000_eori_to_ccr  , M68K_MN_EORI    , 1, INFO_IMM_CCR  },
+	{d68000_eori_to_sr   , M68K_MN_EORI    , 2, INFO_IMM_SR   },
+	{d68000_eori_8       , M68K_MN_EORI    , 1, INFO_IMM_EA   },
+	{d68000_eori_16      , M68K_MN_EORI    , 2, INFO_IMM_EA   },
+	{d68000_eori_32      , M68K_MN_EORI    , 4, INFO_IMM_EA   },
+	{d68000_exg_dd       , M68K_MN_EXG     , 4, INFO_EXG_DD   },
+	{d68000_exg_aa       , M68K_MN_EXG     , 4, INFO_EXG_AA   },
+	{d68000_exg_da       , M68K_MN_EXG     , 4, INFO_EXG_DA   },
+	{d68000_ext_16       , M68K_MN_EXT     , 2, INFO_D        },
+	{d68000_ext_32       , M68K_MN_EXT     , 4, INFO_D        },
+	{d68000_illegal      , M68K_MN_ILLEGAL , 0, INFO_NONE     },
+	{d68000_jmp          , M68K_MN_JMP     , 0, INFO_EA       },
+	{d68000_jsr          , M68K_MN_JSR     , 0, INFO_EA       },
+	{d68000_lea          , M68K_MN_LEA     , 4, INFO_EA_A     },
+	{d68000_link_16      , M68K_MN_LINK    , 2, INFO_LINK     },
+	{d68000_lsr_s_8      , M68K_MN_LSR     , 1, INFO_SHIFT_S  },
+	{d68000_lsr_s_16     , M68K_MN_LSR     , 2, INFO_SHIFT_S  },
+	{d68000_lsr_s_32     , M68K_MN_LSR     , 4, INFO_SHIFT_S  },
+	{d68000_lsr_r_8      , M68K_MN_LSR     , 1, INFO_SHIFT_R  },
+	{d68000_lsr_r_16     , M68K_MN_LSR     , 2, INFO_SHIFT_R  },
+	{d68000_lsr_r_32     , M68K_MN_LSR     , 4, INFO_SHIFT_R  },
+	{d68000_lsr_ea       , M68K_MN_LSR     , 2, INFO_EA       },
+	{d68000_lsl_s_8      , M68K_MN_LSL     , 1, INFO_SHIFT_S  },
+	{d68000_lsl_s_16     , M68K_MN_LSL     , 2, INFO_SHIFT_S  },
+	{d68000_lsl_s_32     , M68K_MN_LSL     , 4, INFO_SHIFT_S  },
+	{d68000_lsl_r_8      , M68K_MN_LSL     , 1, INFO_SHIFT_R  },
+	{d68000_lsl_r_16     , M68K_MN_LSL     , 2, INFO_SHIFT_R  },
+	{d68000_lsl_r_32     , M68K_MN_LSL     , 4, INFO_SHIFT_R  },
+	{d68000_lsl_ea       , M68K_MN_LSL     , 2, INFO_EA       },
+	{d68000_move_8       , M68K_MN_MOVE    , 1, INFO_MOVE     },
+	{d68000_move_16      , M68K_MN_MOVE    , 2, INFO_MOVE     },
+	{d68000_move_32      , M68K_MN_MOVE    , 4, INFO_MOVE     },
+	{d68000_movea_16     , M68K_MN_MOVEA   , 2, INFO_EA_A     },
+	{d68000_movea_32     , M68K_MN_MOVEA   , 4, INFO_EA_A     },
+	{d68000_move_to_ccr  , M68K_MN_MOVE    , 2, INFO_EA_CCR   },
+	{d68000_move_to_sr   , M68K_MN_MOVE    , 2, INFO_EA_SR    },
+	{d68000_move_fr_sr   , M68K_MN_MOVE    , 2, INFO_SR_EA    },
+	{d68000_move_to_usp  , M68K_MN_MOVE    , 4, INFO_A_USP    },
+	{d68000_move_fr_usp  , M68K_MN_MOVE    , 4, INFO_USP_A    },
+	{d68000_movem_pd_16  , M68K_MN_MOVEM   , 2, INFO_MOVEM_PD },
+	{d68000_movem_pd_32  , M68K_MN_MOVEM   , 4, INFO_MOVEM_PD },
+	{d68000_movem_re_16  , M68K_MN_MOVEM   , 2, INFO_MOVEM_RE },
+	{d68000_movem_re_32  , M68K_MN_MOVEM   , 4, INFO_MOVEM_RE },
+	{d68000_movem_er_16  , M68K_MN_MOVEM   , 2, INFO_MOVEM_ER },
+	{d68000_movem_er_32  , M68K_MN_MOVEM   , 4, INFO_MOVEM_ER },
+	{d68000_movep_er_16  , M68K_MN_MOVEP   , 2, INFO_MOVEP_ER },
+	{d68000_movep_er_32  , M68K_MN_MOVEP   , 4, INFO_MOVEP_ER },
+	{d68000_movep_re_16  , M68K_MN_MOVEP   , 2, INFO_MOVEP_RE },
+	{d68000_movep_re_32  , M68K_MN_MOVEP   , 4, INFO_MOVEP_RE },
+	{d68000_moveq        , M68K_MN_MOVEQ   , 4, INFO_MOVEQ    },
+	{d68000_muls         , M68K_MN_MULS    , 2, INFO_EA_D     },
+	{d68000_mulu         , M68K_MN_MULU    , 2, INFO_EA_D     },
+	{d68000_nbcd         , M68K_MN_NBCD    , 1, INFO_EA       },
+	{d68000_neg_8        , M68K_MN_NEG     , 1, INFO_EA       },
+	{d68000_neg_16       , M68K_MN_NEG     , 2, INFO_EA       },
+	{d68000_neg_32       , M68K_MN_NEG     , 4, INFO_EA       },
+	{d68000_negx_8       , M68K_MN_NEGX    , 1, INFO_EA       },
+	{d68000_negx_16      , M68K_MN_NEGX    , 2, INFO_EA       },
+	{d68000_negx_32      , M68K_MN_NEGX    , 4, INFO_EA       },
+	{d68000_nop          , M68K_MN_NOP     , 0, INFO_NONE     },
+	{d68000_not_8        , M68K_MN_NOT     , 1, INFO_EA       },
+	{d68000_not_16       , M68K_MN_NOT     , 2, INFO_EA       },
+	{d68000_not_32       , M68K_MN_NOT     , 4, INFO_EA       },
+	{d68000_or_er_8      , M68K_MN_OR      , 1, INFO_EA_D     },
+	{d68000_or_er_16     , M68K_MN_OR      , 2, INFO_EA_D     },
+	{d68000_or_er_32     , M68K_MN_OR      , 4, INFO_EA_D     },
+	{d68000_or_re_8      , M68K_MN_OR      , 1, INFO_D_EA     },
+	{d68000_or_re_16     , M68K_MN_OR      , 2, INFO_D_EA     },
+	{d68000_or_re_32     , M68K_MN_OR      , 4, INFO_D_EA     },
+	{d68000_ori_to_ccr   , M68K_MN_ORI     , 1, INFO_IMM_CCR  },
+	{d68000_ori_to_sr    , M68K_MN_ORI     , 2, INFO_IMM_SR   },
+	{d68000_ori_8        , M68K_MN_ORI     , 1, INFO_IMM_EA   },
+	{d68000_ori_16       , M68K_MN_ORI     , 2, INFO_IMM_EA   },
+	{d68000_ori_32       , M68K_MN_ORI     , 4, INFO_IMM_EA   },
+	{d68000_pea          , M68K_MN_PEA     , 4, INFO_EA       },
+	{d68000_reset        , M68K_MN_RESET   , 0, INFO_NONE     },
+	{d68000_ror_s_8      , M68K_MN_ROR     , 1, INFO_SHIFT_S  },
+	{d68000_ror_s_16     , M68K_MN_ROR     , 2, INFO_SHIFT_S  },
+	{d68000_ror_s_32     , M68K_MN_ROR     , 4, INFO_SHIFT_S  },
+	{d68000_ror_r_8      , M68K_MN_ROR     , 1, INFO_SHIFT_R  },
+	{d68000_ror_r_16     , M68K_MN_ROR     , 2, INFO_SHIFT_R  },
+	{d68000_ror_r_32     , M68K_MN_ROR     , 4, INFO_SHIFT_R  },
+	{d68000_ror_ea       , M68K_MN_ROR     , 2, INFO_EA       },
+	{d68000_rol_s_8      , M68K_MN_ROL     , 1, INFO_SHIFT_S  },
+	{d68000_rol_s_16     , M68K_MN_ROL     , 2, INFO_SHIFT_S  },
+	{d68000_rol_s_32     , M68K_MN_ROL     , 4, INFO_SHIFT_S  },
+	{d68000_rol_r_8      , M68K_MN_ROL     , 1, INFO_SHIFT_R  },
+	{d68000_rol_r_16     , M68K_MN_ROL     , 2, INFO_SHIFT_R  },
+	{d68000_rol_r_32     , M68K_MN_ROL     , 4, INFO_SHIFT_R  },
+	{d68000_rol_ea       , M68K_MN_ROL     , 2, INFO_EA       },
+	{d68000_roxr_s_8     , M68K_MN_ROXR    , 1, INFO_SHIFT_S  },
+	{d68000_roxr_s_16    , M68K_MN_ROXR    , 2, INFO_SHIFT_S  },
+	{d68000_roxr_s_32    , M68K_MN_ROXR    , 4, INFO_SHIFT_S  },
+	{d68000_roxr_r_8     , M68K_MN_ROXR    , 1, INFO_SHIFT_R  },
+	{d68000_roxr_r_16    , M68K_MN_ROXR    , 2, INFO_SHIFT_R  },
+	{d68000_roxr_r_32    , M68K_MN_ROXR    , 4, INFO_SHIFT_R  },
+	{d68000_roxr_ea      , M68K_MN_ROXR    , 2, INFO_EA       },
+	{d68000_roxl_s_8     , M68K_MN_ROXL    , 1, INFO_SHIFT_S  },
+	{d68000_roxl_s_16    , M68K_MN_ROXL    , 2, INFO_SHIFT_S  },
+	{d68000_roxl_s_32    , M68K_MN_ROXL    , 4, INFO_SHIFT_S  },
+	{d68000_roxl_r_8     , M68K_MN_ROXL    , 1, INFO_SHIFT_R  },
+	{d68000_roxl_r_16    , M68K_MN_ROXL    , 2, INFO_SHIFT_R  },
+	{d68000_roxl_r_32    , M68K_MN_ROXL    , 4, INFO_SHIFT_R  },
+	{d68000_roxl_ea      , M68K_MN_ROXL    , 2, INFO_EA       },
+	{d68000_rte          , M68K_MN_RTE     , 0, INFO_NONE     },
+	{d68000_rtr          , M68K_MN_RTR     , 0, INFO_NONE     },
+	{d68000_rts          , M68K_MN_RTS     , 0, INFO_NONE     },
+	{d68000_sbcd_rr      , M68K_MN_SBCD    , 1, INFO_DD       },
+	{d68000_sbcd_mm      , M68K_MN_SBCD    , 1, INFO_PD_PD    },
+	{d68000_scc          , M68K_MN_SCC     , 1, INFO_EA       },
+	{d68000_stop         , M68K_MN_STOP    , 0, INFO_STOP     },
+	{d68000_sub_er_8     , M68K_MN_SUB     , 1, INFO_EA_D     },
+	{d68000_sub_er_16    , M68K_MN_SUB     , 2, INFO_EA_D     },
+	{d68000_sub_er_32    , M68K_MN_SUB     , 4, INFO_EA_D     },
+	{d68000_sub_re_8     , M68K_MN_SUB     , 1, INFO_D_EA     },
+	{d68000_sub_re_16    , M68K_MN_SUB     , 2, INFO_D_EA     },
+	{d68000_sub_re_32    , M68K_MN_SUB     , 4, INFO_D_EA     },
+	{d68000_suba_16      , M68K_MN_SUBA    , 2, INFO_EA_A     },
+	{d68000_suba_32      , M68K_MN_SUBA    , 4, INFO_EA_A     },
+	{d68000_subi_8       , M68K_MN_SUBI    , 1, INFO_IMM_EA   },
+	{d68000_subi_16      , M68K_MN_SUBI    , 2, INFO_IMM_EA   },
+	{d68000_subi_32      , M68K_MN_SUBI    , 4, INFO_IMM_EA   },
+	{d68000_subq_8       , M68K_MN_SUBQ    , 1, INFO_QUICK_EA },
+	{d68000_subq_16      , M68K_MN_SUBQ    , 2, INFO_QUICK_EA },
+	{d68000_subq_32      , M68K_MN_SUBQ    , 4, INFO_QUICK_EA },
+	{d68000_subx_rr_8    , M68K_MN_SUBX    , 1, INFO_DD       },
+	{d68000_subx_rr_16   , M68K_MN_SUBX    , 2, INFO_DD       },
+	{d68000_subx_rr_32   , M68K_MN_SUBX    , 4, INFO_DD       },
+	{d68000_subx_mm_8    , M68K_MN_SUBX    , 1, INFO_PD_PD    },
+	{d68000_subx_mm_16   , M68K_MN_SUBX    , 2, INFO_PD_PD    },
+	{d68000_subx_mm_32   , M68K_MN_SUBX    , 4, INFO_PD_PD    },
+	{d68000_swap         , M68K_MN_SWAP    , 4, INFO_D        },
+	{d68000_tas          , M68K_MN_TAS     , 1, INFO_EA       },
+	{d68000_trap         , M68K_MN_TRAP    , 0, INFO_TRAP     },
+	{d68000_trapv        , M68K_MN_TRAPV   , 0, INFO_NONE     },
+	{d68000_tst_8        , M68K_MN_TST     , 1, INFO_EA       },
+	{d68000_tst_16       , M68K_MN_TST     , 2, INFO_EA       },
+	{d68000_tst_32       , M68K_MN_TST     , 4, INFO_EA       },
+	{d68000_unlk         , M68K_MN_UNLK    , 0, INFO_A        },
+	{0, 0, 0, 0}
+};
+
+/* Index into g_info_opcode for every opcode */
+static unsigned char g_info_table[0x10000];
+static pthread_once_t g_info_once = PTHREAD_ONCE_INIT;
+
+static const char* g_mnemonic_names[M68K_MN_COUNT] =
+{
+	"invalid", "abcd", "add", "adda", "addi", "addq", "addx", "and", "andi",
+	"asl", "asr", "bcc", "bchg", "bclr", "bra", "bset", "bsr", "btst", "chk",
+	"clr", "cmp", "cmpa", "cmpi", "cmpm", "dbcc", "divs", "divu", "eor",
+	"eori", "exg", "ext", "illegal", "jmp", "jsr", "lea", "link", "lsl", "lsr",
+	"move", "movea", "movem", "movep", "moveq", "muls", "mulu", "nbcd", "neg",
+	"negx", "nop", "not", "or", "ori", "pea", "reset", "rol", "ror", "roxl",
+	"roxr", "rte", "rtr", "rts", "sbcd", "scc", "stop", "sub", "suba", "subi",
+	"subq", "subx", "swap", "tas", "trap", "trapv", "tst", "unlk", "line_a",
+	"line_f"
+};
+
+/* Map every opcode to its entry in g_info_opcode */
+static void build_info_table(void)
+{
+	uint i;
+	uint index;
+
+	if(!g_initialized)
+	{
+		build_opcode_table();
+		g_initialized = 1;
+	}
+
+	for(i=0;i<0x10000;i++)
+	{
+		g_info_table[i] = 0;
+		/* d68000_illegal is also the default for unmatched opcodes */
+		if(g_instruction_table[i] == d68000_illegal && i != 0x4afc)
+			continue;
+		for(index=1;g_info_opcode[index].opcode_handler != 0;index++)
+		{
+			if(g_info_opcode[index].opcode_handler == g_instruction_table[i])
+			{
+				g_info_table[i] = index;
+				break;
+			}
+		}
+	}
+}
+
+static uint info_read_16(info_reader* reader)
+{
+	uint address = reader->pc;
+	uint offset = address - reader->base;
+
+	reader->pc += 2;
+	if(reader->buf == NULL)
+		return m68k_read_disassembler_16(address & 0x00ffffff) & 0xffff;
+	if(offset >= reader->length || reader->length - offset < 2)
+	{
+		reader->truncated = 1;
+		return 0;
+	}
+	return (reader->buf[offset] << 8) | reader->buf[offset+1];
+}
+
+static uint info_read_32(info_reader* reader)
+{
+	uint high = info_read_16(reader);
+	return (high << 16) | info_read_16(reader);
+}
+
+static void info_set_reg(m68k_dasm_operand* oper, uint type, uint reg)
+{
+	oper->type = type;
+	oper->reg = reg;
+}
+
+static void info_set_imm(m68k_dasm_operand* oper, uint value)
+{
+	oper->type = M68K_OPER_IMM;
+	oper->value = value;
+}
+
+/* Decode a brief format index extension word */
+static void info_set_index(m68k_dasm_operand* oper, uint extension)
+{
+	oper->index_reg = (extension>>12)&0xf;
+	oper->index_size = EXT_INDEX_LONG(extension) ? 4 : 2;
+	oper->disp = make_int_8(EXT_8BIT_DISPLACEMENT(extension));
+}
+
+/* Decode the effective address in the low 6 bits of mode_reg */
+static void info_get_ea(info_reader* reader, m68k_dasm_operand* oper, uint mode_reg, uint size)
+{
+	uint reg = mode_reg&7;
+
+	switch((mode_reg>>3)&7)
+	{
+		case 0:
+			info_set_reg(oper, M68K_OPER_D, reg);
+			break;
+		case 1:
+			info_set_reg(oper, M68K_OPER_A, reg);
+			break;
+		case 2:
+			info_set_reg(oper, M68K_OPER_AI, reg);
+			break;
+		case 3:
+			info_set_reg(oper, M68K_OPER_PI, reg);
+			break;
+		case 4:
+			info_set_reg(oper, M68K_OPER_PD, reg);
+			break;
+		case 5:
+			info_set_reg(oper, M68K_OPER_DI, reg);
+			oper->disp = make_int_16(info_read_16(reader));
+			break;
+		case 6:
+			info_set_reg(oper, M68K_OPER_IX, reg);
+			info_set_index(oper, info_read_16(reader));
+			break;
+		default:
+			switch(reg)
+			{
+				case 0:
+					oper->type = M68K_OPER_AW;
+					oper->value = make_int_16(info_read_16(reader));
+					break;
+				case 1:
+					oper->type = M68K_OPER_AL;
+					oper->value = info_read_32(reader);
+					break;
+				case 2:
+					oper->type = M68K_OPER_PCDI;
+					oper->value = reader->pc;
+					oper->disp = make_int_16(info_read_16(reader));
+					oper->value += oper->disp;
+					break;
+				case 3:
+					oper->type = M68K_OPER_PCIX;
+					oper->value = reader->pc;
+					info_set_index(oper, info_read_16(reader));
+					break;
+				default:
+					if(size == 4)
+						info_set_imm(oper, info_read_32(reader));
+					else if(size == 2)
+						info_set_imm(oper, info_read_16(reader));
+					else
+						info_set_imm(oper, info_read_16(reader) & 0xff);
+			}
+	}
+}
+
+/* Set a branch target operand relative to base */
+static void info_set_label(m68k_dasm_info* info, m68k_dasm_operand* oper, uint base, int disp)
+{
+	oper->type = M68K_OPER_LABEL;
+	oper->disp = disp;
+	oper->value = base + disp;
+	info->target = oper->value;
+	info->flags |= M68K_DASM_TARGET;
+}
+
+/* Reverse the bits of a predecrement movem register mask */
+static uint info_reverse_16(uint mask)
+{
+	uint result = 0;
+	uint i;
+
+	for(i=0;i<16;i++)
+		if(mask & (1<<i))
+			result |= 0x8000 >> i;
+	return result;
+}
+
+static uint info_decode(m68k_dasm_info* info, info_reader* reader)
+{
+	const info_struct* istruct;
+	m68k_dasm_operand* oper = info->operands;
+	uint ir;
+	uint temp;
+
+	pthread_once(&g_info_once, build_info_table);
+
+	memset(info, 0, sizeof(*info));
+	info->pc = reader->pc;
+	ir = info_read_16(reader);
+	istruct = g_info_opcode + g_info_table[ir];
+	info->opcode = ir;
+	info->mnemonic = istruct->mnemonic;
+	info->size = istruct->size;
+	info->num_operands = 2;
+
+	switch(istruct->layout)
+	{
+		case INFO_NONE:
+			info->num_operands = 0;
+			break;
+		case INFO_EA:
+			info_get_ea(reader, oper, ir, info->size);
+			info->num_operands = 1;
+			break;
+		case INFO_EA_D:
+			info_get_ea(reader, oper, ir, info->size);
+			info_set_reg(oper+1, M68K_OPER_D, (ir>>9)&7);
+			break;
+		case INFO_D_EA:
+			info_set_reg(oper, M68K_OPER_D, (ir>>9)&7);
+			info_get_ea(reader, oper+1, ir, info->size);
+			break;
+		case INFO_EA_A:
+			info_get_ea(reader, oper, ir, info->size);
+			info_set_reg(oper+1, M68K_OPER_A, (ir>>9)&7);
+			break;
+		case INFO_IMM_EA:
+			info_get_ea(reader, oper, 0x3c, info->size);
+			info_get_ea(reader, oper+1, ir, info->size);
+			break;
+		case INFO_QUICK_EA:
+			info_set_imm(oper, g_3bit_qdata_table[(ir>>9)&7]);
+			info_get_ea(reader, oper+1, ir, info->size);
+			break;
+		case INFO_BIT_S:
+			info_set_imm(oper, info_read_16(reader) & 0xff);
+			info_get_ea(reader, oper+1, ir, info->size);
+			break;
+		case INFO_IMM_CCR:
+			info_get_ea(reader, oper, 0x3c, info->size);
+			oper[1].type = M68K_OPER_CCR;
+			break;
+		case INFO_IMM_SR:
+			info_get_ea(reader, oper, 0x3c, info->size);
+			oper[1].type = M68K_OPER_SR;
+			break;
+		case INFO_DD:
+			info_set_reg(oper, M68K_OPER_D, ir&7);
+			info_set_reg(oper+1, M68K_OPER_D, (ir>>9)&7);
+			break;
+		case INFO_PD_PD:
+			info_set_reg(oper, M68K_OPER_PD, ir&7);
+			info_set_reg(oper+1, M68K_OPER_PD, (ir>>9)&7);
+			break;
+		case INFO_PI_PI:
+			info_set_reg(oper, M68K_OPER_PI, ir&7);
+			info_set_reg(oper+1, M68K_OPER_PI, (ir>>9)&7);
+			break;
+		case INFO_SHIFT_S:
+			info_set_imm(oper, g_3bit_qdata_table[(ir>>9)&7]);
+			info_set_reg(oper+1, M68K_OPER_D, ir&7);
+			break;
+		case INFO_SHIFT_R:
+			info_set_reg(oper, M68K_OPER_D, (ir>>9)&7);
+			info_set_reg(oper+1, M68K_OPER_D, ir&7);
+			break;
+		case INFO_BRANCH_8:
+			info_set_label(info, oper, reader->pc, make_int_8(ir));
+			info->num_operands = 1;
+			break;
+		case INFO_BRANCH_16:
+			temp = reader->pc;
+			info_set_label(info, oper, temp, make_int_16(info_read_16(reader)));
+			info->num_operands = 1;
+			break;
+		case INFO_DBCC:
+			info_set_reg(oper, M68K_OPER_D, ir&7);
+			temp = reader->pc;
+			info_set_label(info, oper+1, temp, make_int_16(info_read_16(reader)));
+			break;
+		case INFO_MOVE:
+			info_get_ea(reader, oper, ir, info->size);
+			info_get_ea(reader, oper+1, ((ir>>9)&7) | ((ir>>3)&0x38), info->size);
+			break;
+		case INFO_MOVEQ:
+			info_set_imm(oper, make_int_8(ir));
+			info_set_reg(oper+1, M68K_OPER_D, (ir>>9)&7);
+			break;
+		case INFO_EA_CCR:
+			info_get_ea(reader, oper, ir, info->size);
+			oper[1].type = M68K_OPER_CCR;
+			break;
+		case INFO_EA_SR:
+			info_get_ea(reader, oper, ir, info->size);
+			oper[1].type = M68K_OPER_SR;
+			break;
+		case INFO_SR_EA:
+			oper->type = M68K_OPER_SR;
+			info_get_ea(reader, oper+1, ir, info->size);
+			break;
+		case INFO_USP_A:
+			oper->type = M68K_OPER_USP;
+			info_set_reg(oper+1, M68K_OPER_A, ir&7);
+			break;
+		case INFO_A_USP:
+			info_set_reg(oper, M68K_OPER_A, ir&7);
+			oper[1].type = M68K_OPER_USP;
+			break;
+		case INFO_MOVEM_RE:
+			oper->type = M68K_OPER_REGLIST;
+			oper->value = info_read_16(reader);
+			info_get_ea(reader, oper+1, ir, info->size);
+			break;
+		case INFO_MOVEM_PD:
+			oper->type = M68K_OPER_REGLIST;
+			oper->value = info_reverse_16(info_read_16(reader));
+			info_get_ea(reader, oper+1, ir, info->size);
+			break;
+		case INFO_MOVEM_ER:
+			oper[1].type = M68K_OPER_REGLIST;
+			oper[1].value = info_read_16(reader);
+			info_get_ea(reader, oper, ir, info->size);
+			break;
+		case INFO_MOVEP_ER:
+			info_set_reg(oper, M68K_OPER_DI, ir&7);
+			oper->disp = make_int_16(info_read_16(reader));
+			info_set_reg(oper+1, M68K_OPER_D, (ir>>9)&7);
+			break;
+		case INFO_MOVEP_RE:
+			info_set_reg(oper, M68K_OPER_D, (ir>>9)&7);
+			info_set_reg(oper+1, M68K_OPER_DI, ir&7);
+			oper[1].disp = make_int_16(info_read_16(reader));
+			break;
+		case INFO_EXG_DD:
+			info_set_reg(oper, M68K_OPER_D, (ir>>9)&7);
+			info_set_reg(oper+1, M68K_OPER_D, ir&7);
+			break;
+		case INFO_EXG_AA:
+			info_set_reg(oper, M68K_OPER_A, (ir>>9)&7);
+			info_set_reg(oper+1, M68K_OPER_A, ir&7);
+			break;
+		case INFO_EXG_DA:
+			info_set_reg(oper, M68K_OPER_D, (ir>>9)&7);
+			info_set_reg(oper+1, M68K_OPER_A, ir&7);
+			break;
+		case INFO_D:
+			info_set_reg(oper, M68K_OPER_D, ir&7);
+			info->num_operands = 1;
+			break;
+		case INFO_A:
+			info_set_reg(oper, M68K_OPER_A, ir&7);
+			info->num_operands = 1;
+			break;
+		case INFO_LINK:
+			info_set_reg(oper, M68K_OPER_A, ir&7);
+			info_set_imm(oper+1, make_int_16(info_read_16(reader)));
+			break;
+		case INFO_TRAP:
+			info_set_imm(oper, ir&0xf);
+			info->num_operands = 1;
+			break;
+		case INFO_STOP:
+			info_set_imm(oper, info_read_16(reader));
+			info->num_operands = 1;
+			break;
+	}
+
+	switch(info->mnemonic)
+	{
+		case M68K_MN_INVALID:
+			info->flags |= M68K_DASM_INVALID;
+			break;
+		case M68K_MN_BCC:
+		case M68K_MN_DBCC:
+			info->flags |= M68K_DASM_BRANCH | M68K_DASM_CONDITIONAL;
+			info->cond = (ir>>8)&0xf;
+			break;
+		case M68K_MN_SCC:
+			info->cond = (ir>>8)&0xf;
+			break;
+		case M68K_MN_BRA:
+			info->flags |= M68K_DASM_BRANCH;
+			break;
+		case M68K_MN_BSR:
+			info->flags |= M68K_DASM_BRANCH | M68K_DASM_CALL;
+			break;
+		case M68K_MN_JSR:
+			info->flags |= M68K_DASM_CALL;
+			/* fall through */
+		case M68K_MN_JMP:
+			info->flags |= M68K_DASM_BRANCH;
+			if(oper->type == M68K_OPER_AW || oper->type == M68K_OPER_AL || oper->type == M68K_OPER_PCDI)
+			{
+				info->target = oper->value;
+				info->flags |= M68K_DASM_TARGET;
+			}
+			break;
+		case M68K_MN_RTE:
+		case M68K_MN_RTR:
+		case M68K_MN_RTS:
+			info->flags |= M68K_DASM_RETURN;
+			break;
+		case M68K_MN_TRAP:
+		case M68K_MN_ILLEGAL:
+		case M68K_MN_LINE_A:
+		case M68K_MN_LINE_F:
+			info->flags |= M68K_DASM_TRAP;
+			break;
+		case M68K_MN_BCHG:
+		case M68K_MN_BCLR:
+		case M68K_MN_BSET:
+		case M68K_MN_BTST:
+			/* bit operations on data registers are long */
+			if(oper[1].type == M68K_OPER_D)
+				info->size = 4;
+			break;
+	}
+
+	if(reader->truncated)
+		info->flags |= M68K_DASM_TRUNCATED;
+	info->length = reader->pc - info->pc;
+	return info->length;
+}
+
+/* A slice of the buffer swept by one thread of m68k_disassemble_bulk() */
+typedef struct
+{
+	const unsigned char* buf;
+	uint base;
+	uint length;
+	uint start;            /* first address to sweep */
+	uint end;              /* sweep stops at the first instruction at or past this */
+	m68k_dasm_info* out;
+	uint count;
+} info_bulk_job;
+
+static void* info_bulk_sweep(void* arg)
+{
+	info_bulk_job* job = (info_bulk_job*)arg;
+	uint pc = job->start;
+
+	while(pc < job->end)
+		pc += m68k_disassemble_info_buffer(job->out + job->count++, pc, job->buf, job->base, job->length);
+	return NULL;
+}
+
+
+
+/* ======================================================================== */
+/* ============================ STRUCTURED API ============================ */
+/* ======================================================================== */
+
+unsigned int m68k_disassemble_info(m68k_dasm_info* info, unsigned int pc)
+{
+	info_reader reader = {pc, NULL, 0, 0, 0};
+	return info_decode(info, &reader);
+}
+
+unsigned int m68k_disassemble_info_buffer(m68k_dasm_info* info, unsigned int pc, const unsigned char* buf, unsigned int base, unsigned int length)
+{
+	info_reader reader = {pc, buf, base, length, 0};
+	return info_decode(info, &reader);
+}
+
+unsigned int m68k_disassemble_bulk(m68k_dasm_info* out, const unsigned char* buf, unsigned int base, unsigned int length, unsigned int num_threads)
+{
+	info_bulk_job* jobs;
+	pthread_t* threads;
+	uint chunk;
+	uint pos = base;
+	uint count = 0;
+	uint i;
+	uint k;
+
+	pthread_once(&g_info_once, build_info_table);
+
+	if(num_threads < 1)
+		num_threads = 1;
+	chunk = ((length / num_threads) + 1) & ~1;
+	if(num_threads == 1 || chunk < 0x1000)
+	{
+		while(pos - base < length)
+			pos += m68k_disassemble_info_buffer(out + count++, pos, buf, base, length);
+		return count;
+	}
+
+	jobs = calloc(num_threads, sizeof(*jobs));
+	threads = calloc(num_threads, sizeof(*threads));
+	for(k=0;k<num_threads;k++)
+	{
+		jobs[k].buf = buf;
+		jobs[k].base = base;
+		jobs[k].length = length;
+		jobs[k].start = base + k*chunk;
+		jobs[k].end = k == num_threads-1 ? base + length : jobs[k].start + chunk;
+		jobs[k].out = malloc(((jobs[k].end - jobs[k].start)/2 + 1) * sizeof(m68k_dasm_info));
+		pthread_create(&threads[k], NULL, info_bulk_sweep, &jobs[k]);
+	}
+
+	/* Each thread guessed that an instruction starts at its first address.
+	 * Where the previous chunk's last instruction ends somewhere else, keep
+	 * sweeping from there until we land on an instruction the thread also
+	 * found; from then on both sweeps are identical.
+	 */
+	for(k=0;k<num_threads;k++)
+	{
+		info_bulk_job* job = &jobs[k];
+
+		pthread_join(threads[k], NULL);
+		i = 0;
+		while(pos - base < length && pos < job->end)
+		{
+			while(i < job->count && job->out[i].pc < pos)
+				i++;
+			if(i < job->count && job->out[i].pc == pos)
+			{
+				memcpy(out + count, job->out + i, (job->count - i) * sizeof(m68k_dasm_info));
+				count += job->count - i;
+				pos = out[count-1].pc + out[count-1].length;
+				break;
+			}
+			pos += m68k_disassemble_info_buffer(out + count++, pos, buf, base, length);
+		}
+		free(job->out);
+	}
+
+	free(threads);
+	free(jobs);
+	return count;
+}
+
+const char* m68k_mnemonic_name(unsigned int mnemonic)
+{
+	if(mnemonic >= M68K_MN_COUNT)
+		return g_mnemonic_names[M68K_MN_INVALID];
+	return g_mnemonic_names[mnemonic];
+}
+
+
+
 /* ======================================================================== */
 /* ============================== END OF FILE ============================= */
 /* ======================================================================== */
@@ -82,12 +82,13 @@ char* g_version = "3.3";
 #define MAX_BODY_LENGTH                 300	/* Number of lines in 1 function */
 #define MAX_REPLACE_LENGTH               30	/* Max number of replace strings */
 #define MAX_INSERT_LENGTH              5000	/* Max size of insert piece */
-#define MAX_NAME_LENGTH                  30	/* Max length of ophandler name */
+#define MAX_NAME_LENGTH                  40	/* Max length of ophandler name */
 #define MAX_SPEC_PROC_LENGTH              4	/* Max length of special processing str */
 #define MAX_SPEC_EA_LENGTH                5	/* Max length of specified EA str */
 #define EA_ALLOWED_LENGTH                11	/* Max length of ea allowed str */
 #define MAX_OPCODE_INPUT_TABLE_LENGTH  1000	/* Max length of opcode handler tbl */
 #define MAX_OPCODE_OUTPUT_TABLE_LENGTH 3000	/* Max length of opcode handler tbl */
+#define MAX_FUSE_TABLE_LENGTH           200	/* Max number of fused opcode pairs */
 
 /* Default filenames */
 #define FILENAME_INPUT      "m68k_in.c"
@@ -215,6 +216,17 @@ typedef struct
 } replace_struct;
 
 
+/* A pair of adjacent opcode handlers to fuse */
+typedef struct
+{
+	char first[MAX_NAME_LENGTH];  /* handler that gets a fused variant */
+	char second[MAX_NAME_LENGTH]; /* handler it is followed by */
+	char* first_body;             /* generated bodies of both handlers */
+	char* second_body;
+	FILE* filep;                  /* file the first handler went to */
+} fuse_struct;
+
+
 /* Function Prototypes */
 void error_exit(char* fmt, ...);
 void perror_exit(char* fmt, ...);
@@ -236,7 +248,7 @@ void write_function_name(FILE* filep, char* base_name);
 void add_opcode_output_table_entry(opcode_struct* op, char* name);
 static int DECL_SPEC compare_nof_true_bits(const void* aptr, const void* bptr);
 void print_opcode_output_table(FILE* filep);
-void write_table_entry(FILE* filep, opcode_struct* op);
+void write_table_entry(FILE* filep, char* name, unsigned char* cycles);
 void set_opcode_struct(opcode_struct* src, opcode_struct* dst, int ea_mode);
 void generate_opcode_handler(FILE* filep, body_struct* body, replace_struct* replace, opcode_struct* opinfo, int ea_mode);
 void generate_opcode_ea_variants(FILE* filep, body_struct* body, replace_struct* replace, opcode_struct* op);
@@ -244,6 +256,12 @@ void generate_opcode_cc_variants(FILE* filep, body_struct* body, replace_struct*
 void process_opcode_handlers(void);
 void populate_table(void);
 void read_insert(char* insert);
+void read_fuse_file(char* filename);
+int is_fuse_first(char* name);
+char* get_body_text(body_struct* body, replace_struct* replace);
+void add_fuse_body(FILE* filep, char* name, body_struct* body, replace_struct* replace);
+void write_fused_inline(FILE* filep, char* name, char* body_text);
+void write_fused_handlers(void);
 
 
 
@@ -262,6 +280,9 @@ FILE* g_ops_ac_file = NULL;
 FILE* g_ops_dm_file = NULL;
 FILE* g_ops_nz_file = NULL;
 
+int g_cpu_000_only = 0;   /* Only generate what the 68000 can execute */
+fuse_struct g_fuse_table[MAX_FUSE_TABLE_LENGTH]; /* Opcode pairs to fuse */
+int g_fuse_table_length = 0;
 int g_num_functions = 0;  /* Number of functions processed */
 int g_num_primitives = 0; /* Number of function primitives read */
 int g_line_number = 1;    /* Current line number */
@@ -811,29 +832,101 @@ static int DECL_SPEC compare_nof_true_bits(const void* aptr, const void* bptr)
 
 void print_opcode_output_table(FILE* filep)
 {
+	static char* handler[0x10000];
+	static unsigned char cycles[0x10000][NUM_CPUS];
+	static unsigned short index[0x10000];
+	static char* entry_handler[0x10000];
+	static unsigned char entry_cycles[0x10000][NUM_CPUS];
+	int num_entries = 0;
+	int num_cpus = g_cpu_000_only ? 1 : NUM_CPUS;
+	opcode_struct* op;
 	int i;
+	int j;
+	int k;
+
 	qsort((void *)g_opcode_output_table, g_opcode_output_table_length, sizeof(g_opcode_output_table[0]), compare_nof_true_bits);
 
-	for(i=0;i<g_opcode_output_table_length;i++)
-		write_table_entry(filep, g_opcode_output_table+i);
+	/* Resolve every opcode word.  The table is sorted by the number of
+	 * significant bits, so the more specific entries override the others.
+	 */
+	for(i=0;i<0x10000;i++)
+	{
+		handler[i] = "m68k_op_illegal";
+		memset(cycles[i], 0, NUM_CPUS);
+	}
+	for(j=0;j<g_opcode_output_table_length;j++)
+	{
+		op = g_opcode_output_table + j;
+		for(i=0;i<0x10000;i++)
+		{
+			if((i & op->op_mask) != op->op_match)
+				continue;
+			handler[i] = op->name;
+			memcpy(cycles[i], op->cycles, NUM_CPUS);
+			/* On the 68000 and 68010, shifting by an immediate count
+			 * costs 2 cycles per bit shifted.
+			 */
+			if(op->op_mask == 0xf1f8 && (i & 0xf000) == 0xe000 && !(i & 0x20))
+				for(k=0;k<2;k++)
+					cycles[i][k] += ((((i >> 9) - 1) & 7) + 1) << 1;
+		}
+	}
+
+	/* Give each distinct handler and cycle count combination one entry */
+	for(i=0;i<0x10000;i++)
+	{
+		for(j=0;j<num_entries;j++)
+			if(strcmp(entry_handler[j], handler[i]) == 0 && memcmp(entry_cycles[j], cycles[i], num_cpus) == 0)
+				break;
+		if(j == num_entries)
+		{
+			entry_handler[j] = handler[i];
+			memcpy(entry_cycles[j], cycles[i], NUM_CPUS);
+			num_entries++;
+		}
+		index[i] = j;
+	}
+
+	fprintf(filep, "const m68ki_opcode_entry m68ki_opcode_entries[%d] =\n{\n", num_entries);
+	for(j=0;j<num_entries;j++)
+		write_table_entry(filep, entry_handler[j], entry_cycles[j]);
+	fprintf(filep, "};\n\n");
+
+	fprintf(filep, "const unsigned short m68ki_opcode_index[0x10000] =\n{");
+	for(i=0;i<0x10000;i++)
+		fprintf(filep, "%s%4d,", (i & 15) ? " " : "\n\t", index[i]);
+	fprintf(filep, "\n};\n\n");
+
+	/* Names for the pair profiler, which counts fused pairs by their parts */
+	fprintf(filep, "#if M68K_PROFILE_PAIRS\n");
+	fprintf(filep, "const char* const m68ki_opcode_names[%d] =\n{\n", num_entries);
+	for(j=0;j<num_entries;j++)
+	{
+		k = strlen(entry_handler[j]);
+		if(k > 6 && strcmp(entry_handler[j] + k - 6, "_fused") == 0)
+			k -= 6;
+		fprintf(filep, "\t\"%.*s\",\n", k - 8, entry_handler[j] + 8);
+	}
+	fprintf(filep, "};\n#endif /* M68K_PROFILE_PAIRS */\n\n");
+
+	fprintf(g_prototype_file, "#define M68K_NUM_OPCODE_ENTRIES %d\n\n", num_entries);
 }
 
 /* Write an entry in the opcode handler table */
-void write_table_entry(FILE* filep, opcode_struct* op)
+void write_table_entry(FILE* filep, char* name, unsigned char* cycles)
 {
 	int i;
 
-	fprintf(filep, "\t{%-28s, 0x%04x, 0x%04x, {",
-		op->name, op->op_mask, op->op_match);
+	fprintf(filep, "\t{%-28s, {", name);
 
-	for(i=0;i<NUM_CPUS;i++)
+	for(i=0;i<(g_cpu_000_only ? 1 : NUM_CPUS);i++)
 	{
-		fprintf(filep, "%3d", op->cycles[i]);
-		if(i < NUM_CPUS-1)
+		if(i > 0)
 			fprintf(filep, ", ");
+		fprintf(filep, "%3d", cycles[i]);
 	}
 
-	fprintf(filep, "}},\n");
+	fprintf(filep, "}, %d},\n", strstr(name, "_fused") != NULL);
 }
 
 /* Fill out an opcode struct with a specific addressing mode of the source opcode struct */
@@ -855,15 +948,37 @@ void set_opcode_struct(opcode_struct* src, opcode_struct* dst, int ea_mode)
 /* Generate a final opcode handler from the provided data */
 void generate_opcode_handler(FILE* filep, body_struct* body, replace_struct* replace, opcode_struct* opinfo, int ea_mode)
 {
+	char name[MAX_NAME_LENGTH];
 	char str[MAX_LINE_LENGTH+1];
 	opcode_struct* op = malloc(sizeof(opcode_struct));
 
 	/* Set the opcode structure and write the tables, prototypes, etc */
 	set_opcode_struct(opinfo, op, ea_mode);
 	get_base_name(str, op);
+
+	/* The 68000 traps on opcodes only later CPUs implement (line 1111 for
+	 * the coprocessor ones), so keep them out of any broader 68000 pattern
+	 * but don't generate a handler for them.
+	 */
+	if(g_cpu_000_only && opinfo->cpus[0] == UNSPECIFIED_CH)
+	{
+		if((op->op_match & 0xf000) == 0xf000)
+			add_opcode_output_table_entry(op, "m68k_op_1111");
+		else
+			add_opcode_output_table_entry(op, "m68k_op_illegal");
+		free(op);
+		return;
+	}
+
 	write_prototype(g_prototype_file, str);
+	if(is_fuse_first(str))
+	{
+		strcat(str, "_fused");
+		write_prototype(g_prototype_file, str);
+	}
 	add_opcode_output_table_entry(op, str);
-	write_function_name(filep, str);
+	get_base_name(name, op);
+	write_function_name(filep, name);
 
 	/* Add any replace strings needed */
 	if(ea_mode != EA_MODE_NONE)
@@ -884,6 +999,7 @@ void generate_opcode_handler(FILE* filep, body_struct* body, replace_struct* rep
 
 	/* Now write the function body with the selected replace strings */
 	write_body(filep, body, replace);
+	add_fuse_body(filep, name, body, replace);
 	g_num_functions++;
 	free(op);
 }
@@ -1213,6 +1329,190 @@ void read_insert(char* insert)
 
 
 
+/* Read the opcode pairs to fuse.  Each line names two handlers without the
+ * m68k_op_ prefix, optionally followed by how often the pair was seen.
+ * Blank lines and lines starting with # are ignored.
+ */
+void read_fuse_file(char* filename)
+{
+	FILE* filep;
+	char line[MAX_LINE_LENGTH+1];
+	char first[MAX_LINE_LENGTH+1];
+	char second[MAX_LINE_LENGTH+1];
+	fuse_struct* fuse;
+	int line_number = 0;
+	int fields;
+
+	if((filep = fopen(filename, "rt")) == NULL)
+		perror_exit("can't open %s for input", filename);
+
+	while(fgets(line, MAX_LINE_LENGTH, filep) != NULL)
+	{
+		line_number++;
+		fields = sscanf(line, "%s %s", first, second);
+		if(fields < 1 || first[0] == '#')
+			continue;
+		if(fields != 2)
+			error_exit("%s:%d: expected a pair of opcode handlers", filename, line_number);
+		if(strlen(first) + 14 >= MAX_NAME_LENGTH || strlen(second) + 14 >= MAX_NAME_LENGTH)
+			error_exit("%s:%d: opcode handler name too long", filename, line_number);
+		if(g_fuse_table_length >= MAX_FUSE_TABLE_LENGTH)
+			error_exit("%s:%d: too many fused pairs", filename, line_number);
+
+		fuse = g_fuse_table + g_fuse_table_length++;
+		strcpy(fuse->first, "m68k_op_");
+		strcat(fuse->first, first);
+		strcpy(fuse->second, "m68k_op_");
+		strcat(fuse->second, second);
+		fuse->first_body = NULL;
+		fuse->second_body = NULL;
+		fuse->filep = NULL;
+	}
+
+	fclose(filep);
+}
+
+/* Check if a handler starts any fused pair */
+int is_fuse_first(char* name)
+{
+	int i;
+
+	for(i=0;i<g_fuse_table_length;i++)
+		if(strcmp(g_fuse_table[i].first, name) == 0)
+			return 1;
+	return 0;
+}
+
+/* Get a function body, with the selected replace strings, as text */
+char* get_body_text(body_struct* body, replace_struct* replace)
+{
+	FILE* filep;
+	char* text;
+	long length;
+
+	if((filep = tmpfile()) == NULL)
+		perror_exit("Unable to create temporary file");
+	write_body(filep, body, replace);
+	length = ftell(filep);
+	rewind(filep);
+	if((text = malloc(length + 1)) == NULL)
+		error_exit("Out of memory");
+	if(fread(text, 1, length, filep) != (size_t)length)
+		perror_exit("Unable to read temporary file");
+	text[length] = 0;
+	fclose(filep);
+	return text;
+}
+
+/* Keep the body of a handler that is part of any fused pair */
+void add_fuse_body(FILE* filep, char* name, body_struct* body, replace_struct* replace)
+{
+	char* text = NULL;
+	fuse_struct* fuse;
+	int i;
+
+	for(i=0;i<g_fuse_table_length;i++)
+	{
+		fuse = g_fuse_table + i;
+		if(strcmp(fuse->first, name) != 0 && strcmp(fuse->second, name) != 0)
+			continue;
+		if(text == NULL)
+			text = get_body_text(body, replace);
+		if(strcmp(fuse->first, name) == 0)
+		{
+			fuse->first_body = text;
+			fuse->filep = filep;
+		}
+		if(strcmp(fuse->second, name) == 0)
+			fuse->second_body = text;
+	}
+}
+
+/* Write a copy of a handler the compiler can inline into a fused handler,
+ * unless this file already has one.
+ */
+void write_fused_inline(FILE* filep, char* name, char* body_text)
+{
+	static FILE* written_file[MAX_FUSE_TABLE_LENGTH*2];
+	static char* written_name[MAX_FUSE_TABLE_LENGTH*2];
+	static int num_written = 0;
+	int i;
+
+	for(i=0;i<num_written;i++)
+		if(written_file[i] == filep && strcmp(written_name[i], name) == 0)
+			return;
+	written_file[num_written] = filep;
+	written_name[num_written++] = name;
+
+	fprintf(filep, "INLINE void m68ki_fused_%s(void)\n%s", name + 8, body_text);
+}
+
+/* Write the fused variant of each handler that starts a pair, after all the
+ * handlers it is made of.  It runs the handler, then runs the next
+ * instruction right away if it is one of the handler's partners, skipping a
+ * trip through the main loop.  Anything else is run through the opcode table
+ * unless it has a fused variant itself, so a fused handler never runs more
+ * than two instructions.
+ */
+void write_fused_handlers(void)
+{
+	char str[MAX_LINE_LENGTH+1];
+	fuse_struct* fuse;
+	fuse_struct* partner;
+	FILE* filep;
+	int i;
+	int j;
+
+	for(i=0;i<g_fuse_table_length;i++)
+	{
+		fuse = g_fuse_table + i;
+		if(fuse->first_body == NULL)
+			error_exit("Fused pair starts with unknown opcode handler %s", fuse->first);
+		if(fuse->second_body == NULL)
+			error_exit("Fused pair ends with unknown opcode handler %s", fuse->second);
+	}
+
+	for(i=0;i<g_fuse_table_length;i++)
+	{
+		fuse = g_fuse_table + i;
+		for(j=0;j<i;j++)
+			if(strcmp(g_fuse_table[j].first, fuse->first) == 0)
+				break;
+		if(j < i)
+			continue;
+
+		filep = fuse->filep;
+		write_fused_inline(filep, fuse->first, fuse->first_body);
+		for(j=i;j<g_fuse_table_length;j++)
+			if(strcmp(g_fuse_table[j].first, fuse->first) == 0)
+				write_fused_inline(filep, g_fuse_table[j].second, g_fuse_table[j].second_body);
+
+		sprintf(str, "%s_fused", fuse->first);
+		write_function_name(filep, str);
+		fprintf(filep, "{\n\tuint cycles = CYC_INSTRUCTION(REG_IR);\n\tuint word;\n\tconst m68ki_opcode_entry* next;\n\n");
+		fprintf(filep, "\tm68ki_fused_%s();\n", fuse->first + 8);
+		fprintf(filep, "\tif(!m68ki_fused_peek(cycles, &word))\n\t\treturn;\n");
+		fprintf(filep, "\tnext = OPCODE_ENTRY(word);\n");
+		for(j=i;j<g_fuse_table_length;j++)
+		{
+			partner = g_fuse_table + j;
+			if(strcmp(partner->first, fuse->first) != 0)
+				continue;
+			sprintf(str, is_fuse_first(partner->second) ? "%s_fused" : "%s", partner->second);
+			fprintf(filep, "\t%sif(next->handler == %s)\n", j > i ? "else " : "", str);
+			fprintf(filep, "\t{\n\t\tm68ki_fused_start(cycles, word);\n");
+			fprintf(filep, "\t\tm68ki_fused_%s();\n", partner->second + 8);
+			fprintf(filep, "\t\tm68ki_fused_end(cycles, word);\n\t}\n");
+		}
+		fprintf(filep, "\telse if(!next->fused)\n");
+		fprintf(filep, "\t{\n\t\tm68ki_fused_start(cycles, word);\n");
+		fprintf(filep, "\t\tnext->handler();\n");
+		fprintf(filep, "\t\tm68ki_fused_end(cycles, word);\n\t}\n");
+		fprintf(filep, "}\n\n\n");
+	}
+}
+
+
 /* ======================================================================== */
 /* ============================= MAIN FUNCTION ============================ */
 /* ======================================================================== */
@@ -1242,6 +1542,27 @@ int main(int argc, char **argv)
 	printf("\n\t\tMusashi v%s 68000, 68010, 68EC020, 68020 emulator\n", g_version);
 	printf("\t\tCopyright 1998-2000 Karl Stenerud (karl@mame.net)\n\n");
 
+	/* -000 generates a core for the 68000 alone, -fuse FILE adds fused
+	 * handlers for the opcode pairs listed in FILE
+	 */
+	for(;;)
+	{
+		if(argc > 1 && strcmp(argv[1], "-000") == 0)
+		{
+			g_cpu_000_only = 1;
+			argc--;
+			argv++;
+		}
+		else if(argc > 2 && strcmp(argv[1], "-fuse") == 0)
+		{
+			read_fuse_file(argv[2]);
+			argc -= 2;
+			argv += 2;
+		}
+		else
+			break;
+	}
+
 	/* Check if output path and source for the input file are given */
     if(argc > 1)
 	{
@@ -1299,6 +1620,8 @@ int main(int argc, char **argv)
 				error_exit("Duplicate prototype header");
 			read_insert(temp_insert);
 			fprintf(g_prototype_file, "%s\n\n", temp_insert);
+			if(g_cpu_000_only)
+				fprintf(g_prototype_file, "#define M68K_OPS_000_ONLY 1\n\n");
 			prototype_header_read = 1;
 		}
 		else if(strcmp(section_id, ID_TABLE_HEADER) == 0)
@@ -1393,6 +1716,7 @@ int main(int argc, char **argv)
 			if(!ophandler_body_read)
 				error_exit("Missing opcode handler body");
 
+			write_fused_handlers();
 			print_opcode_output_table(g_table_file);
 
 			fprintf(g_prototype_file, "%s\n\n", prototype_footer_insert);
@@ -0,0 +1,7831 @@
+/* ======================================================================== */
+/* ============================= OPCODE TABLE ============================= */
+/* ======================================================================== */
+
+#include "m68k.h"
+#include "m68kops.h"
+const m68ki_opcode_entry m68ki_opcode_entries[1855] =
+{
+	{m68k_op_ori_8_d             , {  8}, 0},
+	{m68k_op_illegal             , {  0}, 0},
+	{m68k_op_ori_8_ai            , { 16}, 0},
+	{m68k_op_ori_8_pi            , { 16}, 0},
+	{m68k_op_ori_8_pi7           , { 16}, 0},
+	{m68k_op_ori_8_pd            , { 18}, 0},
+	{m68k_op_ori_8_pd7           , { 18}, 0},
+	{m68k_op_ori_8_di            , { 20}, 0},
+	{m68k_op_ori_8_ix            , { 22}, 0},
+	{m68k_op_ori_8_aw            , { 20}, 0},
+	{m68k_op_ori_8_al            , { 24}, 0},
+	{m68k_op_ori_16_toc          , { 20}, 0},
+	{m68k_op_ori_16_d            , {  8}, 0},
+	{m68k_op_ori_16_ai           , { 16}, 0},
+	{m68k_op_ori_16_pi           , { 16}, 0},
+	{m68k_op_ori_16_pd           , { 18}, 0},
+	{m68k_op_ori_16_di           , { 20}, 0},
+	{m68k_op_ori_16_ix           , { 22}, 0},
+	{m68k_op_ori_16_aw           , { 20}, 0},
+	{m68k_op_ori_16_al           , { 24}, 0},
+	{m68k_op_ori_16_tos          , { 20}, 0},
+	{m68k_op_ori_32_d            , { 16}, 0},
+	{m68k_op_ori_32_ai           , { 28}, 0},
+	{m68k_op_ori_32_pi           , { 28}, 0},
+	{m68k_op_ori_32_pd           , { 30}, 0},
+	{m68k_op_ori_32_di           , { 32}, 0},
+	{m68k_op_ori_32_ix           , { 34}, 0},
+	{m68k_op_ori_32_aw           , { 32}, 0},
+	{m68k_op_ori_32_al           , { 36}, 0},
+	{m68k_op_btst_32_r_d         , {  6}, 0},
+	{m68k_op_movep_16_er         , { 16}, 0},
+	{m68k_op_btst_8_r_ai         , {  8}, 0},
+	{m68k_op_btst_8_r_pi         , {  8}, 0},
+	{m68k_op_btst_8_r_pi7        , {  8}, 0},
+	{m68k_op_btst_8_r_pd         , { 10}, 0},
+	{m68k_op_btst_8_r_pd7        , { 10}, 0},
+	{m68k_op_btst_8_r_di         , { 12}, 0},
+	{m68k_op_btst_8_r_ix         , { 14}, 0},
+	{m68k_op_btst_8_r_aw         , { 12}, 0},
+	{m68k_op_btst_8_r_al         , { 16}, 0},
+	{m68k_op_btst_8_r_pcdi       , { 12}, 0},
+	{m68k_op_btst_8_r_pcix       , { 14}, 0},
+	{m68k_op_btst_8_r_i          , {  8}, 0},
+	{m68k_op_bchg_32_r_d         , {  8}, 0},
+	{m68k_op_movep_32_er         , { 24}, 0},
+	{m68k_op_bchg_8_r_ai         , { 12}, 0},
+	{m68k_op_bchg_8_r_pi         , { 12}, 0},
+	{m68k_op_bchg_8_r_pi7        , { 12}, 0},
+	{m68k_op_bchg_8_r_pd         , { 14}, 0},
+	{m68k_op_bchg_8_r_pd7        , { 14}, 0},
+	{m68k_op_bchg_8_r_di         , { 16}, 0},
+	{m68k_op_bchg_8_r_ix         , { 18}, 0},
+	{m68k_op_bchg_8_r_aw         , { 16}, 0},
+	{m68k_op_bchg_8_r_al         , { 20}, 0},
+	{m68k_op_bclr_32_r_d         , { 10}, 0},
+	{m68k_op_movep_16_re         , { 16}, 0},
+	{m68k_op_bclr_8_r_ai         , { 12}, 0},
+	{m68k_op_bclr_8_r_pi         , { 12}, 0},
+	{m68k_op_bclr_8_r_pi7        , { 12}, 0},
+	{m68k_op_bclr_8_r_pd         , { 14}, 0},
+	{m68k_op_bclr_8_r_pd7        , { 14}, 0},
+	{m68k_op_bclr_8_r_di         , { 16}, 0},
+	{m68k_op_bclr_8_r_ix         , { 18}, 0},
+	{m68k_op_bclr_8_r_aw         , { 16}, 0},
+	{m68k_op_bclr_8_r_al         , { 20}, 0},
+	{m68k_op_bset_32_r_d         , {  8}, 0},
+	{m68k_op_movep_32_re         , { 24}, 0},
+	{m68k_op_bset_8_r_ai         , { 12}, 0},
+	{m68k_op_bset_8_r_pi         , { 12}, 0},
+	{m68k_op_bset_8_r_pi7        , { 12}, 0},
+	{m68k_op_bset_8_r_pd         , { 14}, 0},
+	{m68k_op_bset_8_r_pd7        , { 14}, 0},
+	{m68k_op_bset_8_r_di         , { 16}, 0},
+	{m68k_op_bset_8_r_ix         , { 18}, 0},
+	{m68k_op_bset_8_r_aw         , { 16}, 0},
+	{m68k_op_bset_8_r_al         , { 20}, 0},
+	{m68k_op_andi_8_d            , {  8}, 0},
+	{m68k_op_andi_8_ai           , { 16}, 0},
+	{m68k_op_andi_8_pi           , { 16}, 0},
+	{m68k_op_andi_8_pi7          , { 16}, 0},
+	{m68k_op_andi_8_pd           , { 18}, 0},
+	{m68k_op_andi_8_pd7          , { 18}, 0},
+	{m68k_op_andi_8_di           , { 20}, 0},
+	{m68k_op_andi_8_ix           , { 22}, 0},
+	{m68k_op_andi_8_aw           , { 20}, 0},
+	{m68k_op_andi_8_al           , { 24}, 0},
+	{m68k_op_andi_16_toc         , { 20}, 0},
+	{m68k_op_andi_16_d           , {  8}, 0},
+	{m68k_op_andi_16_ai          , { 16}, 0},
+	{m68k_op_andi_16_pi          , { 16}, 0},
+	{m68k_op_andi_16_pd          , { 18}, 0},
+	{m68k_op_andi_16_di          , { 20}, 0},
+	{m68k_op_andi_16_ix          , { 22}, 0},
+	{m68k_op_andi_16_aw          , { 20}, 0},
+	{m68k_op_andi_16_al          , { 24}, 0},
+	{m68k_op_andi_16_tos         , { 20}, 0},
+	{m68k_op_andi_32_d           , { 14}, 0},
+	{m68k_op_andi_32_ai          , { 28}, 0},
+	{m68k_op_andi_32_pi          , { 28}, 0},
+	{m68k_op_andi_32_pd          , { 30}, 0},
+	{m68k_op_andi_32_di          , { 32}, 0},
+	{m68k_op_andi_32_ix          , { 34}, 0},
+	{m68k_op_andi_32_aw          , { 32}, 0},
+	{m68k_op_andi_32_al          , { 36}, 0},
+	{m68k_op_subi_8_d            , {  8}, 0},
+	{m68k_op_subi_8_ai           , { 16}, 0},
+	{m68k_op_subi_8_pi           , { 16}, 0},
+	{m68k_op_subi_8_pi7          , { 16}, 0},
+	{m68k_op_subi_8_pd           , { 18}, 0},
+	{m68k_op_subi_8_pd7          , { 18}, 0},
+	{m68k_op_subi_8_di           , { 20}, 0},
+	{m68k_op_subi_8_ix           , { 22}, 0},
+	{m68k_op_subi_8_aw           , { 20}, 0},
+	{m68k_op_subi_8_al           , { 24}, 0},
+	{m68k_op_subi_16_d           , {  8}, 0},
+	{m68k_op_subi_16_ai          , { 16}, 0},
+	{m68k_op_subi_16_pi          , { 16}, 0},
+	{m68k_op_subi_16_pd          , { 18}, 0},
+	{m68k_op_subi_16_di          , { 20}, 0},
+	{m68k_op_subi_16_ix          , { 22}, 0},
+	{m68k_op_subi_16_aw          , { 20}, 0},
+	{m68k_op_subi_16_al          , { 24}, 0},
+	{m68k_op_subi_32_d           , { 16}, 0},
+	{m68k_op_subi_32_ai          , { 28}, 0},
+	{m68k_op_subi_32_pi          , { 28}, 0},
+	{m68k_op_subi_32_pd          , { 30}, 0},
+	{m68k_op_subi_32_di          , { 32}, 0},
+	{m68k_op_subi_32_ix          , { 34}, 0},
+	{m68k_op_subi_32_aw          , { 32}, 0},
+	{m68k_op_subi_32_al          , { 36}, 0},
+	{m68k_op_addi_8_d            , {  8}, 0},
+	{m68k_op_addi_8_ai           , { 16}, 0},
+	{m68k_op_addi_8_pi           , { 16}, 0},
+	{m68k_op_addi_8_pi7          , { 16}, 0},
+	{m68k_op_addi_8_pd           , { 18}, 0},
+	{m68k_op_addi_8_pd7          , { 18}, 0},
+	{m68k_op_addi_8_di           , { 20}, 0},
+	{m68k_op_addi_8_ix           , { 22}, 0},
+	{m68k_op_addi_8_aw           , { 20}, 0},
+	{m68k_op_addi_8_al           , { 24}, 0},
+	{m68k_op_addi_16_d           , {  8}, 0},
+	{m68k_op_addi_16_ai          , { 16}, 0},
+	{m68k_op_addi_16_pi          , { 16}, 0},
+	{m68k_op_addi_16_pd          , { 18}, 0},
+	{m68k_op_addi_16_di          , { 20}, 0},
+	{m68k_op_addi_16_ix          , { 22}, 0},
+	{m68k_op_addi_16_aw          , { 20}, 0},
+	{m68k_op_addi_16_al          , { 24}, 0},
+	{m68k_op_addi_32_d           , { 16}, 0},
+	{m68k_op_addi_32_ai          , { 28}, 0},
+	{m68k_op_addi_32_pi          , { 28}, 0},
+	{m68k_op_addi_32_pd          , { 30}, 0},
+	{m68k_op_addi_32_di          , { 32}, 0},
+	{m68k_op_addi_32_ix          , { 34}, 0},
+	{m68k_op_addi_32_aw          , { 32}, 0},
+	{m68k_op_addi_32_al          , { 36}, 0},
+	{m68k_op_btst_32_s_d         , { 10}, 0},
+	{m68k_op_btst_8_s_ai         , { 12}, 0},
+	{m68k_op_btst_8_s_pi         , { 12}, 0},
+	{m68k_op_btst_8_s_pi7        , { 12}, 0},
+	{m68k_op_btst_8_s_pd         , { 14}, 0},
+	{m68k_op_btst_8_s_pd7        , { 14}, 0},
+	{m68k_op_btst_8_s_di         , { 16}, 0},
+	{m68k_op_btst_8_s_ix         , { 18}, 0},
+	{m68k_op_btst_8_s_aw         , { 16}, 0},
+	{m68k_op_btst_8_s_al         , { 20}, 0},
+	{m68k_op_btst_8_s_pcdi       , { 16}, 0},
+	{m68k_op_btst_8_s_pcix       , { 18}, 0},
+	{m68k_op_bchg_32_s_d         , { 12}, 0},
+	{m68k_op_bchg_8_s_ai         , { 16}, 0},
+	{m68k_op_bchg_8_s_pi         , { 16}, 0},
+	{m68k_op_bchg_8_s_pi7        , { 16}, 0},
+	{m68k_op_bchg_8_s_pd         , { 18}, 0},
+	{m68k_op_bchg_8_s_pd7        , { 18}, 0},
+	{m68k_op_bchg_8_s_di         , { 20}, 0},
+	{m68k_op_bchg_8_s_ix         , { 22}, 0},
+	{m68k_op_bchg_8_s_aw         , { 20}, 0},
+	{m68k_op_bchg_8_s_al         , { 24}, 0},
+	{m68k_op_bclr_32_s_d         , { 14}, 0},
+	{m68k_op_bclr_8_s_ai         , { 16}, 0},
+	{m68k_op_bclr_8_s_pi         , { 16}, 0},
+	{m68k_op_bclr_8_s_pi7        , { 16}, 0},
+	{m68k_op_bclr_8_s_pd         , { 18}, 0},
+	{m68k_op_bclr_8_s_pd7        , { 18}, 0},
+	{m68k_op_bclr_8_s_di         , { 20}, 0},
+	{m68k_op_bclr_8_s_ix         , { 22}, 0},
+	{m68k_op_bclr_8_s_aw         , { 20}, 0},
+	{m68k_op_bclr_8_s_al         , { 24}, 0},
+	{m68k_op_bset_32_s_d         , { 12}, 0},
+	{m68k_op_bset_8_s_ai         , { 16}, 0},
+	{m68k_op_bset_8_s_pi         , { 16}, 0},
+	{m68k_op_bset_8_s_pi7        , { 16}, 0},
+	{m68k_op_bset_8_s_pd         , { 18}, 0},
+	{m68k_op_bset_8_s_pd7        , { 18}, 0},
+	{m68k_op_bset_8_s_di         , { 20}, 0},
+	{m68k_op_bset_8_s_ix         , { 22}, 0},
+	{m68k_op_bset_8_s_aw         , { 20}, 0},
+	{m68k_op_bset_8_s_al         , { 24}, 0},
+	{m68k_op_eori_8_d            , {  8}, 0},
+	{m68k_op_eori_8_ai           , { 16}, 0},
+	{m68k_op_eori_8_pi           , { 16}, 0},
+	{m68k_op_eori_8_pi7          , { 16}, 0},
+	{m68k_op_eori_8_pd           , { 18}, 0},
+	{m68k_op_eori_8_pd7          , { 18}, 0},
+	{m68k_op_eori_8_di           , { 20}, 0},
+	{m68k_op_eori_8_ix           , { 22}, 0},
+	{m68k_op_eori_8_aw           , { 20}, 0},
+	{m68k_op_eori_8_al           , { 24}, 0},
+	{m68k_op_eori_16_toc         , { 20}, 0},
+	{m68k_op_eori_16_d           , {  8}, 0},
+	{m68k_op_eori_16_ai          , { 16}, 0},
+	{m68k_op_eori_16_pi          , { 16}, 0},
+	{m68k_op_eori_16_pd          , { 18}, 0},
+	{m68k_op_eori_16_di          , { 20}, 0},
+	{m68k_op_eori_16_ix          , { 22}, 0},
+	{m68k_op_eori_16_aw          , { 20}, 0},
+	{m68k_op_eori_16_al          , { 24}, 0},
+	{m68k_op_eori_16_tos         , { 20}, 0},
+	{m68k_op_eori_32_d           , { 16}, 0},
+	{m68k_op_eori_32_ai          , { 28}, 0},
+	{m68k_op_eori_32_pi          , { 28}, 0},
+	{m68k_op_eori_32_pd          , { 30}, 0},
+	{m68k_op_eori_32_di          , { 32}, 0},
+	{m68k_op_eori_32_ix          , { 34}, 0},
+	{m68k_op_eori_32_aw          , { 32}, 0},
+	{m68k_op_eori_32_al          , { 36}, 0},
+	{m68k_op_cmpi_8_d            , {  8}, 0},
+	{m68k_op_cmpi_8_ai           , { 12}, 0},
+	{m68k_op_cmpi_8_pi           , { 12}, 0},
+	{m68k_op_cmpi_8_pi7          , { 12}, 0},
+	{m68k_op_cmpi_8_pd           , { 14}, 0},
+	{m68k_op_cmpi_8_pd7          , { 14}, 0},
+	{m68k_op_cmpi_8_di           , { 16}, 0},
+	{m68k_op_cmpi_8_ix           , { 18}, 0},
+	{m68k_op_cmpi_8_aw           , { 16}, 0},
+	{m68k_op_cmpi_8_al           , { 20}, 0},
+	{m68k_op_cmpi_16_d           , {  8}, 0},
+	{m68k_op_cmpi_16_ai          , { 12}, 0},
+	{m68k_op_cmpi_16_pi          , { 12}, 0},
+	{m68k_op_cmpi_16_pd          , { 14}, 0},
+	{m68k_op_cmpi_16_di          , { 16}, 0},
+	{m68k_op_cmpi_16_ix          , { 18}, 0},
+	{m68k_op_cmpi_16_aw          , { 16}, 0},
+	{m68k_op_cmpi_16_al          , { 20}, 0},
+	{m68k_op_cmpi_32_d           , { 14}, 0},
+	{m68k_op_cmpi_32_ai          , { 20}, 0},
+	{m68k_op_cmpi_32_pi          , { 20}, 0},
+	{m68k_op_cmpi_32_pd          , { 22}, 0},
+	{m68k_op_cmpi_32_di          , { 24}, 0},
+	{m68k_op_cmpi_32_ix          , { 26}, 0},
+	{m68k_op_cmpi_32_aw          , { 24}, 0},
+	{m68k_op_cmpi_32_al          , { 28}, 0},
+	{m68k_op_move_8_d_d          , {  4}, 0},
+	{m68k_op_move_8_d_ai         , {  8}, 0},
+	{m68k_op_move_8_d_pi         , {  8}, 0},
+	{m68k_op_move_8_d_pi7        , {  8}, 0},
+	{m68k_op_move_8_d_pd         , { 10}, 0},
+	{m68k_op_move_8_d_pd7        , { 10}, 0},
+	{m68k_op_move_8_d_di         , { 12}, 0},
+	{m68k_op_move_8_d_ix         , { 14}, 0},
+	{m68k_op_move_8_d_aw         , { 12}, 0},
+	{m68k_op_move_8_d_al         , { 16}, 0},
+	{m68k_op_move_8_d_pcdi       , { 12}, 0},
+	{m68k_op_move_8_d_pcix       , { 14}, 0},
+	{m68k_op_move_8_d_i          , {  8}, 0},
+	{m68k_op_move_8_ai_d         , {  8}, 0},
+	{m68k_op_move_8_ai_ai        , { 12}, 0},
+	{m68k_op_move_8_ai_pi        , { 12}, 0},
+	{m68k_op_move_8_ai_pi7       , { 12}, 0},
+	{m68k_op_move_8_ai_pd        , { 14}, 0},
+	{m68k_op_move_8_ai_pd7       , { 14}, 0},
+	{m68k_op_move_8_ai_di        , { 16}, 0},
+	{m68k_op_move_8_ai_ix        , { 18}, 0},
+	{m68k_op_move_8_ai_aw        , { 16}, 0},
+	{m68k_op_move_8_ai_al        , { 20}, 0},
+	{m68k_op_move_8_ai_pcdi      , { 16}, 0},
+	{m68k_op_move_8_ai_pcix      , { 18}, 0},
+	{m68k_op_move_8_ai_i         , { 12}, 0},
+	{m68k_op_move_8_pi_d         , {  8}, 0},
+	{m68k_op_move_8_pi_ai        , { 12}, 0},
+	{m68k_op_move_8_pi_pi        , { 12}, 0},
+	{m68k_op_move_8_pi_pi7       , { 12}, 0},
+	{m68k_op_move_8_pi_pd        , { 14}, 0},
+	{m68k_op_move_8_pi_pd7       , { 14}, 0},
+	{m68k_op_move_8_pi_di        , { 16}, 0},
+	{m68k_op_move_8_pi_ix        , { 18}, 0},
+	{m68k_op_move_8_pi_aw        , { 16}, 0},
+	{m68k_op_move_8_pi_al        , { 20}, 0},
+	{m68k_op_move_8_pi_pcdi      , { 16}, 0},
+	{m68k_op_move_8_pi_pcix      , { 18}, 0},
+	{m68k_op_move_8_pi_i         , { 12}, 0},
+	{m68k_op_move_8_pd_d         , {  8}, 0},
+	{m68k_op_move_8_pd_ai        , { 12}, 0},
+	{m68k_op_move_8_pd_pi        , { 12}, 0},
+	{m68k_op_move_8_pd_pi7       , { 12}, 0},
+	{m68k_op_move_8_pd_pd        , { 14}, 0},
+	{m68k_op_move_8_pd_pd7       , { 14}, 0},
+	{m68k_op_move_8_pd_di        , { 16}, 0},
+	{m68k_op_move_8_pd_ix        , { 18}, 0},
+	{m68k_op_move_8_pd_aw        , { 16}, 0},
+	{m68k_op_move_8_pd_al        , { 20}, 0},
+	{m68k_op_move_8_pd_pcdi      , { 16}, 0},
+	{m68k_op_move_8_pd_pcix      , { 18}, 0},
+	{m68k_op_move_8_pd_i         , { 12}, 0},
+	{m68k_op_move_8_di_d         , { 12}, 0},
+	{m68k_op_move_8_di_ai        , { 16}, 0},
+	{m68k_op_move_8_di_pi        , { 16}, 0},
+	{m68k_op_move_8_di_pi7       , { 16}, 0},
+	{m68k_op_move_8_di_pd        , { 18}, 0},
+	{m68k_op_move_8_di_pd7       , { 18}, 0},
+	{m68k_op_move_8_di_di        , { 20}, 0},
+	{m68k_op_move_8_di_ix        , { 22}, 0},
+	{m68k_op_move_8_di_aw        , { 20}, 0},
+	{m68k_op_move_8_di_al        , { 24}, 0},
+	{m68k_op_move_8_di_pcdi      , { 20}, 0},
+	{m68k_op_move_8_di_pcix      , { 22}, 0},
+	{m68k_op_move_8_di_i         , { 16}, 0},
+	{m68k_op_move_8_ix_d         , { 14}, 0},
+	{m68k_op_move_8_ix_ai        , { 18}, 0},
+	{m68k_op_move_8_ix_pi        , { 18}, 0},
+	{m68k_op_move_8_ix_pi7       , { 18}, 0},
+	{m68k_op_move_8_ix_pd        , { 20}, 0},
+	{m68k_op_move_8_ix_pd7       , { 20}, 0},
+	{m68k_op_move_8_ix_di        , { 22}, 0},
+	{m68k_op_move_8_ix_ix        , { 24}, 0},
+	{m68k_op_move_8_ix_aw        , { 22}, 0},
+	{m68k_op_move_8_ix_al        , { 26}, 0},
+	{m68k_op_move_8_ix_pcdi      , { 22}, 0},
+	{m68k_op_move_8_ix_pcix      , { 24}, 0},
+	{m68k_op_move_8_ix_i         , { 18}, 0},
+	{m68k_op_move_8_aw_d         , { 12}, 0},
+	{m68k_op_move_8_aw_ai        , { 16}, 0},
+	{m68k_op_move_8_aw_pi        , { 16}, 0},
+	{m68k_op_move_8_aw_pi7       , { 16}, 0},
+	{m68k_op_move_8_aw_pd        , { 18}, 0},
+	{m68k_op_move_8_aw_pd7       , { 18}, 0},
+	{m68k_op_move_8_aw_di        , { 20}, 0},
+	{m68k_op_move_8_aw_ix        , { 22}, 0},
+	{m68k_op_move_8_aw_aw        , { 20}, 0},
+	{m68k_op_move_8_aw_al        , { 24}, 0},
+	{m68k_op_move_8_aw_pcdi      , { 20}, 0},
+	{m68k_op_move_8_aw_pcix      , { 22}, 0},
+	{m68k_op_move_8_aw_i         , { 16}, 0},
+	{m68k_op_move_8_al_d         , { 16}, 0},
+	{m68k_op_move_8_al_ai        , { 20}, 0},
+	{m68k_op_move_8_al_pi        , { 20}, 0},
+	{m68k_op_move_8_al_pi7       , { 20}, 0},
+	{m68k_op_move_8_al_pd        , { 22}, 0},
+	{m68k_op_move_8_al_pd7       , { 22}, 0},
+	{m68k_op_move_8_al_di        , { 24}, 0},
+	{m68k_op_move_8_al_ix        , { 26}, 0},
+	{m68k_op_move_8_al_aw        , { 24}, 0},
+	{m68k_op_move_8_al_al        , { 28}, 0},
+	{m68k_op_move_8_al_pcdi      , { 24}, 0},
+	{m68k_op_move_8_al_pcix      , { 26}, 0},
+	{m68k_op_move_8_al_i         , { 20}, 0},
+	{m68k_op_move_8_pi7_d        , {  8}, 0},
+	{m68k_op_move_8_pi7_ai       , { 12}, 0},
+	{m68k_op_move_8_pi7_pi       , { 12}, 0},
+	{m68k_op_move_8_pi7_pi7      , { 12}, 0},
+	{m68k_op_move_8_pi7_pd       , { 14}, 0},
+	{m68k_op_move_8_pi7_pd7      , { 14}, 0},
+	{m68k_op_move_8_pi7_di       , { 16}, 0},
+	{m68k_op_move_8_pi7_ix       , { 18}, 0},
+	{m68k_op_move_8_pi7_aw       , { 16}, 0},
+	{m68k_op_move_8_pi7_al       , { 20}, 0},
+	{m68k_op_move_8_pi7_pcdi     , { 16}, 0},
+	{m68k_op_move_8_pi7_pcix     , { 18}, 0},
+	{m68k_op_move_8_pi7_i        , { 12}, 0},
+	{m68k_op_move_8_pd7_d        , {  8}, 0},
+	{m68k_op_move_8_pd7_ai       , { 12}, 0},
+	{m68k_op_move_8_pd7_pi       , { 12}, 0},
+	{m68k_op_move_8_pd7_pi7      , { 12}, 0},
+	{m68k_op_move_8_pd7_pd       , { 14}, 0},
+	{m68k_op_move_8_pd7_pd7      , { 14}, 0},
+	{m68k_op_move_8_pd7_di       , { 16}, 0},
+	{m68k_op_move_8_pd7_ix       , { 18}, 0},
+	{m68k_op_move_8_pd7_aw       , { 16}, 0},
+	{m68k_op_move_8_pd7_al       , { 20}, 0},
+	{m68k_op_move_8_pd7_pcdi     , { 16}, 0},
+	{m68k_op_move_8_pd7_pcix     , { 18}, 0},
+	{m68k_op_move_8_pd7_i        , { 12}, 0},
+	{m68k_op_move_32_d_d         , {  4}, 0},
+	{m68k_op_move_32_d_a         , {  4}, 0},
+	{m68k_op_move_32_d_ai        , { 12}, 0},
+	{m68k_op_move_32_d_pi        , { 12}, 0},
+	{m68k_op_move_32_d_pd        , { 14}, 0},
+	{m68k_op_move_32_d_di        , { 16}, 0},
+	{m68k_op_move_32_d_ix        , { 18}, 0},
+	{m68k_op_move_32_d_aw        , { 16}, 0},
+	{m68k_op_move_32_d_al        , { 20}, 0},
+	{m68k_op_move_32_d_pcdi      , { 16}, 0},
+	{m68k_op_move_32_d_pcix      , { 18}, 0},
+	{m68k_op_move_32_d_i         , { 12}, 0},
+	{m68k_op_movea_32_d          , {  4}, 0},
+	{m68k_op_movea_32_a          , {  4}, 0},
+	{m68k_op_movea_32_ai         , { 12}, 0},
+	{m68k_op_movea_32_pi         , { 12}, 0},
+	{m68k_op_movea_32_pd         , { 14}, 0},
+	{m68k_op_movea_32_di         , { 16}, 0},
+	{m68k_op_movea_32_ix         , { 18}, 0},
+	{m68k_op_movea_32_aw         , { 16}, 0},
+	{m68k_op_movea_32_al         , { 20}, 0},
+	{m68k_op_movea_32_pcdi       , { 16}, 0},
+	{m68k_op_movea_32_pcix       , { 18}, 0},
+	{m68k_op_movea_32_i          , { 12}, 0},
+	{m68k_op_move_32_ai_d        , { 12}, 0},
+	{m68k_op_move_32_ai_a        , { 12}, 0},
+	{m68k_op_move_32_ai_ai       , { 20}, 0},
+	{m68k_op_move_32_ai_pi       , { 20}, 0},
+	{m68k_op_move_32_ai_pd       , { 22}, 0},
+	{m68k_op_move_32_ai_di       , { 24}, 0},
+	{m68k_op_move_32_ai_ix       , { 26}, 0},
+	{m68k_op_move_32_ai_aw       , { 24}, 0},
+	{m68k_op_move_32_ai_al       , { 28}, 0},
+	{m68k_op_move_32_ai_pcdi     , { 24}, 0},
+	{m68k_op_move_32_ai_pcix     , { 26}, 0},
+	{m68k_op_move_32_ai_i        , { 20}, 0},
+	{m68k_op_move_32_pi_d        , { 12}, 0},
+	{m68k_op_move_32_pi_a        , { 12}, 0},
+	{m68k_op_move_32_pi_ai       , { 20}, 0},
+	{m68k_op_move_32_pi_pi       , { 20}, 0},
+	{m68k_op_move_32_pi_pd       , { 22}, 0},
+	{m68k_op_move_32_pi_di       , { 24}, 0},
+	{m68k_op_move_32_pi_ix       , { 26}, 0},
+	{m68k_op_move_32_pi_aw       , { 24}, 0},
+	{m68k_op_move_32_pi_al       , { 28}, 0},
+	{m68k_op_move_32_pi_pcdi     , { 24}, 0},
+	{m68k_op_move_32_pi_pcix     , { 26}, 0},
+	{m68k_op_move_32_pi_i        , { 20}, 0},
+	{m68k_op_move_32_pd_d        , { 12}, 0},
+	{m68k_op_move_32_pd_a        , { 12}, 0},
+	{m68k_op_move_32_pd_ai       , { 20}, 0},
+	{m68k_op_move_32_pd_pi       , { 20}, 0},
+	{m68k_op_move_32_pd_pd       , { 22}, 0},
+	{m68k_op_move_32_pd_di       , { 24}, 0},
+	{m68k_op_move_32_pd_ix       , { 26}, 0},
+	{m68k_op_move_32_pd_aw       , { 24}, 0},
+	{m68k_op_move_32_pd_al       , { 28}, 0},
+	{m68k_op_move_32_pd_pcdi     , { 24}, 0},
+	{m68k_op_move_32_pd_pcix     , { 26}, 0},
+	{m68k_op_move_32_pd_i        , { 20}, 0},
+	{m68k_op_move_32_di_d        , { 16}, 0},
+	{m68k_op_move_32_di_a        , { 16}, 0},
+	{m68k_op_move_32_di_ai       , { 24}, 0},
+	{m68k_op_move_32_di_pi       , { 24}, 0},
+	{m68k_op_move_32_di_pd       , { 26}, 0},
+	{m68k_op_move_32_di_di       , { 28}, 0},
+	{m68k_op_move_32_di_ix       , { 30}, 0},
+	{m68k_op_move_32_di_aw       , { 28}, 0},
+	{m68k_op_move_32_di_al       , { 32}, 0},
+	{m68k_op_move_32_di_pcdi     , { 28}, 0},
+	{m68k_op_move_32_di_pcix     , { 30}, 0},
+	{m68k_op_move_32_di_i        , { 24}, 0},
+	{m68k_op_move_32_ix_d        , { 18}, 0},
+	{m68k_op_move_32_ix_a        , { 18}, 0},
+	{m68k_op_move_32_ix_ai       , { 26}, 0},
+	{m68k_op_move_32_ix_pi       , { 26}, 0},
+	{m68k_op_move_32_ix_pd       , { 28}, 0},
+	{m68k_op_move_32_ix_di       , { 30}, 0},
+	{m68k_op_move_32_ix_ix       , { 32}, 0},
+	{m68k_op_move_32_ix_aw       , { 30}, 0},
+	{m68k_op_move_32_ix_al       , { 34}, 0},
+	{m68k_op_move_32_ix_pcdi     , { 30}, 0},
+	{m68k_op_move_32_ix_pcix     , { 32}, 0},
+	{m68k_op_move_32_ix_i        , { 26}, 0},
+	{m68k_op_move_32_aw_d        , { 16}, 0},
+	{m68k_op_move_32_aw_a        , { 16}, 0},
+	{m68k_op_move_32_aw_ai       , { 24}, 0},
+	{m68k_op_move_32_aw_pi       , { 24}, 0},
+	{m68k_op_move_32_aw_pd       , { 26}, 0},
+	{m68k_op_move_32_aw_di       , { 28}, 0},
+	{m68k_op_move_32_aw_ix       , { 30}, 0},
+	{m68k_op_move_32_aw_aw       , { 28}, 0},
+	{m68k_op_move_32_aw_al       , { 32}, 0},
+	{m68k_op_move_32_aw_pcdi     , { 28}, 0},
+	{m68k_op_move_32_aw_pcix     , { 30}, 0},
+	{m68k_op_move_32_aw_i        , { 24}, 0},
+	{m68k_op_move_32_al_d        , { 20}, 0},
+	{m68k_op_move_32_al_a        , { 20}, 0},
+	{m68k_op_move_32_al_ai       , { 28}, 0},
+	{m68k_op_move_32_al_pi       , { 28}, 0},
+	{m68k_op_move_32_al_pd       , { 30}, 0},
+	{m68k_op_move_32_al_di       , { 32}, 0},
+	{m68k_op_move_32_al_ix       , { 34}, 0},
+	{m68k_op_move_32_al_aw       , { 32}, 0},
+	{m68k_op_move_32_al_al       , { 36}, 0},
+	{m68k_op_move_32_al_pcdi     , { 32}, 0},
+	{m68k_op_move_32_al_pcix     , { 34}, 0},
+	{m68k_op_move_32_al_i        , { 28}, 0},
+	{m68k_op_move_16_d_d         , {  4}, 0},
+	{m68k_op_move_16_d_a         , {  4}, 0},
+	{m68k_op_move_16_d_ai        , {  8}, 0},
+	{m68k_op_move_16_d_pi        , {  8}, 0},
+	{m68k_op_move_16_d_pd        , { 10}, 0},
+	{m68k_op_move_16_d_di        , { 12}, 0},
+	{m68k_op_move_16_d_ix        , { 14}, 0},
+	{m68k_op_move_16_d_aw        , { 12}, 0},
+	{m68k_op_move_16_d_al        , { 16}, 0},
+	{m68k_op_move_16_d_pcdi      , { 12}, 0},
+	{m68k_op_move_16_d_pcix      , { 14}, 0},
+	{m68k_op_move_16_d_i         , {  8}, 0},
+	{m68k_op_movea_16_d          , {  4}, 0},
+	{m68k_op_movea_16_a          , {  4}, 0},
+	{m68k_op_movea_16_ai         , {  8}, 0},
+	{m68k_op_movea_16_pi         , {  8}, 0},
+	{m68k_op_movea_16_pd         , { 10}, 0},
+	{m68k_op_movea_16_di         , { 12}, 0},
+	{m68k_op_movea_16_ix         , { 14}, 0},
+	{m68k_op_movea_16_aw         , { 12}, 0},
+	{m68k_op_movea_16_al         , { 16}, 0},
+	{m68k_op_movea_16_pcdi       , { 12}, 0},
+	{m68k_op_movea_16_pcix       , { 14}, 0},
+	{m68k_op_movea_16_i          , {  8}, 0},
+	{m68k_op_move_16_ai_d        , {  8}, 0},
+	{m68k_op_move_16_ai_a        , {  8}, 0},
+	{m68k_op_move_16_ai_ai       , { 12}, 0},
+	{m68k_op_move_16_ai_pi       , { 12}, 0},
+	{m68k_op_move_16_ai_pd       , { 14}, 0},
+	{m68k_op_move_16_ai_di       , { 16}, 0},
+	{m68k_op_move_16_ai_ix       , { 18}, 0},
+	{m68k_op_move_16_ai_aw       , { 16}, 0},
+	{m68k_op_move_16_ai_al       , { 20}, 0},
+	{m68k_op_move_16_ai_pcdi     , { 16}, 0},
+	{m68k_op_move_16_ai_pcix     , { 18}, 0},
+	{m68k_op_move_16_ai_i        , { 12}, 0},
+	{m68k_op_move_16_pi_d        , {  8}, 0},
+	{m68k_op_move_16_pi_a        , {  8}, 0},
+	{m68k_op_move_16_pi_ai       , { 12}, 0},
+	{m68k_op_move_16_pi_pi       , { 12}, 0},
+	{m68k_op_move_16_pi_pd       , { 14}, 0},
+	{m68k_op_move_16_pi_di       , { 16}, 0},
+	{m68k_op_move_16_pi_ix       , { 18}, 0},
+	{m68k_op_move_16_pi_aw       , { 16}, 0},
+	{m68k_op_move_16_pi_al       , { 20}, 0},
+	{m68k_op_move_16_pi_pcdi     , { 16}, 0},
+	{m68k_op_move_16_pi_pcix     , { 18}, 0},
+	{m68k_op_move_16_pi_i        , { 12}, 0},
+	{m68k_op_move_16_pd_d        , {  8}, 0},
+	{m68k_op_move_16_pd_a        , {  8}, 0},
+	{m68k_op_move_16_pd_ai       , { 12}, 0},
+	{m68k_op_move_16_pd_pi       , { 12}, 0},
+	{m68k_op_move_16_pd_pd       , { 14}, 0},
+	{m68k_op_move_16_pd_di       , { 16}, 0},
+	{m68k_op_move_16_pd_ix       , { 18}, 0},
+	{m68k_op_move_16_pd_aw       , { 16}, 0},
+	{m68k_op_move_16_pd_al       , { 20}, 0},
+	{m68k_op_move_16_pd_pcdi     , { 16}, 0},
+	{m68k_op_move_16_pd_pcix     , { 18}, 0},
+	{m68k_op_move_16_pd_i        , { 12}, 0},
+	{m68k_op_move_16_di_d        , { 12}, 0},
+	{m68k_op_move_16_di_a        , { 12}, 0},
+	{m68k_op_move_16_di_ai       , { 16}, 0},
+	{m68k_op_move_16_di_pi       , { 16}, 0},
+	{m68k_op_move_16_di_pd       , { 18}, 0},
+	{m68k_op_move_16_di_di       , { 20}, 0},
+	{m68k_op_move_16_di_ix       , { 22}, 0},
+	{m68k_op_move_16_di_aw       , { 20}, 0},
+	{m68k_op_move_16_di_al       , { 24}, 0},
+	{m68k_op_move_16_di_pcdi     , { 20}, 0},
+	{m68k_op_move_16_di_pcix     , { 22}, 0},
+	{m68k_op_move_16_di_i        , { 16}, 0},
+	{m68k_op_move_16_ix_d        , { 14}, 0},
+	{m68k_op_move_16_ix_a        , { 14}, 0},
+	{m68k_op_move_16_ix_ai       , { 18}, 0},
+	{m68k_op_move_16_ix_pi       , { 18}, 0},
+	{m68k_op_move_16_ix_pd       , { 20}, 0},
+	{m68k_op_move_16_ix_di       , { 22}, 0},
+	{m68k_op_move_16_ix_ix       , { 24}, 0},
+	{m68k_op_move_16_ix_aw       , { 22}, 0},
+	{m68k_op_move_16_ix_al       , { 26}, 0},
+	{m68k_op_move_16_ix_pcdi     , { 22}, 0},
+	{m68k_op_move_16_ix_pcix     , { 24}, 0},
+	{m68k_op_move_16_ix_i        , { 18}, 0},
+	{m68k_op_move_16_aw_d        , { 12}, 0},
+	{m68k_op_move_16_aw_a        , { 12}, 0},
+	{m68k_op_move_16_aw_ai       , { 16}, 0},
+	{m68k_op_move_16_aw_pi       , { 16}, 0},
+	{m68k_op_move_16_aw_pd       , { 18}, 0},
+	{m68k_op_move_16_aw_di       , { 20}, 0},
+	{m68k_op_move_16_aw_ix       , { 22}, 0},
+	{m68k_op_move_16_aw_aw       , { 20}, 0},
+	{m68k_op_move_16_aw_al       , { 24}, 0},
+	{m68k_op_move_16_aw_pcdi     , { 20}, 0},
+	{m68k_op_move_16_aw_pcix     , { 22}, 0},
+	{m68k_op_move_16_aw_i        , { 16}, 0},
+	{m68k_op_move_16_al_d        , { 16}, 0},
+	{m68k_op_move_16_al_a        , { 16}, 0},
+	{m68k_op_move_16_al_ai       , { 20}, 0},
+	{m68k_op_move_16_al_pi       , { 20}, 0},
+	{m68k_op_move_16_al_pd       , { 22}, 0},
+	{m68k_op_move_16_al_di       , { 24}, 0},
+	{m68k_op_move_16_al_ix       , { 26}, 0},
+	{m68k_op_move_16_al_aw       , { 24}, 0},
+	{m68k_op_move_16_al_al       , { 28}, 0},
+	{m68k_op_move_16_al_pcdi     , { 24}, 0},
+	{m68k_op_move_16_al_pcix     , { 26}, 0},
+	{m68k_op_move_16_al_i        , { 20}, 0},
+	{m68k_op_negx_8_d            , {  4}, 0},
+	{m68k_op_negx_8_ai           , { 12}, 0},
+	{m68k_op_negx_8_pi           , { 12}, 0},
+	{m68k_op_negx_8_pi7          , { 12}, 0},
+	{m68k_op_negx_8_pd           , { 14}, 0},
+	{m68k_op_negx_8_pd7          , { 14}, 0},
+	{m68k_op_negx_8_di           , { 16}, 0},
+	{m68k_op_negx_8_ix           , { 18}, 0},
+	{m68k_op_negx_8_aw           , { 16}, 0},
+	{m68k_op_negx_8_al           , { 20}, 0},
+	{m68k_op_negx_16_d           , {  4}, 0},
+	{m68k_op_negx_16_ai          , { 12}, 0},
+	{m68k_op_negx_16_pi          , { 12}, 0},
+	{m68k_op_negx_16_pd          , { 14}, 0},
+	{m68k_op_negx_16_di          , { 16}, 0},
+	{m68k_op_negx_16_ix          , { 18}, 0},
+	{m68k_op_negx_16_aw          , { 16}, 0},
+	{m68k_op_negx_16_al          , { 20}, 0},
+	{m68k_op_negx_32_d           , {  6}, 0},
+	{m68k_op_negx_32_ai          , { 20}, 0},
+	{m68k_op_negx_32_pi          , { 20}, 0},
+	{m68k_op_negx_32_pd          , { 22}, 0},
+	{m68k_op_negx_32_di          , { 24}, 0},
+	{m68k_op_negx_32_ix          , { 26}, 0},
+	{m68k_op_negx_32_aw          , { 24}, 0},
+	{m68k_op_negx_32_al          , { 28}, 0},
+	{m68k_op_move_16_frs_d       , {  6}, 0},
+	{m68k_op_move_16_frs_ai      , { 12}, 0},
+	{m68k_op_move_16_frs_pi      , { 12}, 0},
+	{m68k_op_move_16_frs_pd      , { 14}, 0},
+	{m68k_op_move_16_frs_di      , { 16}, 0},
+	{m68k_op_move_16_frs_ix      , { 18}, 0},
+	{m68k_op_move_16_frs_aw      , { 16}, 0},
+	{m68k_op_move_16_frs_al      , { 20}, 0},
+	{m68k_op_chk_16_d            , { 10}, 0},
+	{m68k_op_chk_16_ai           , { 14}, 0},
+	{m68k_op_chk_16_pi           , { 14}, 0},
+	{m68k_op_chk_16_pd           , { 16}, 0},
+	{m68k_op_chk_16_di           , { 18}, 0},
+	{m68k_op_chk_16_ix           , { 20}, 0},
+	{m68k_op_chk_16_aw           , { 18}, 0},
+	{m68k_op_chk_16_al           , { 22}, 0},
+	{m68k_op_chk_16_pcdi         , { 18}, 0},
+	{m68k_op_chk_16_pcix         , { 20}, 0},
+	{m68k_op_chk_16_i            , { 14}, 0},
+	{m68k_op_lea_32_ai           , {  4}, 0},
+	{m68k_op_lea_32_di           , {  8}, 0},
+	{m68k_op_lea_32_ix           , { 12}, 0},
+	{m68k_op_lea_32_aw           , {  8}, 0},
+	{m68k_op_lea_32_al           , { 12}, 0},
+	{m68k_op_lea_32_pcdi         , {  8}, 0},
+	{m68k_op_lea_32_pcix         , { 12}, 0},
+	{m68k_op_clr_8_d             , {  4}, 0},
+	{m68k_op_clr_8_ai            , { 12}, 0},
+	{m68k_op_clr_8_pi            , { 12}, 0},
+	{m68k_op_clr_8_pi7           , { 12}, 0},
+	{m68k_op_clr_8_pd            , { 14}, 0},
+	{m68k_op_clr_8_pd7           , { 14}, 0},
+	{m68k_op_clr_8_di            , { 16}, 0},
+	{m68k_op_clr_8_ix            , { 18}, 0},
+	{m68k_op_clr_8_aw            , { 16}, 0},
+	{m68k_op_clr_8_al            , { 20}, 0},
+	{m68k_op_clr_16_d            , {  4}, 0},
+	{m68k_op_clr_16_ai           , { 12}, 0},
+	{m68k_op_clr_16_pi           , { 12}, 0},
+	{m68k_op_clr_16_pd           , { 14}, 0},
+	{m68k_op_clr_16_di           , { 16}, 0},
+	{m68k_op_clr_16_ix           , { 18}, 0},
+	{m68k_op_clr_16_aw           , { 16}, 0},
+	{m68k_op_clr_16_al           , { 20}, 0},
+	{m68k_op_clr_32_d            , {  6}, 0},
+	{m68k_op_clr_32_ai           , { 20}, 0},
+	{m68k_op_clr_32_pi           , { 20}, 0},
+	{m68k_op_clr_32_pd           , { 22}, 0},
+	{m68k_op_clr_32_di           , { 24}, 0},
+	{m68k_op_clr_32_ix           , { 26}, 0},
+	{m68k_op_clr_32_aw           , { 24}, 0},
+	{m68k_op_clr_32_al           , { 28}, 0},
+	{m68k_op_neg_8_d             , {  4}, 0},
+	{m68k_op_neg_8_ai            , { 12}, 0},
+	{m68k_op_neg_8_pi            , { 12}, 0},
+	{m68k_op_neg_8_pi7           , { 12}, 0},
+	{m68k_op_neg_8_pd            , { 14}, 0},
+	{m68k_op_neg_8_pd7           , { 14}, 0},
+	{m68k_op_neg_8_di            , { 16}, 0},
+	{m68k_op_neg_8_ix            , { 18}, 0},
+	{m68k_op_neg_8_aw            , { 16}, 0},
+	{m68k_op_neg_8_al            , { 20}, 0},
+	{m68k_op_neg_16_d            , {  4}, 0},
+	{m68k_op_neg_16_ai           , { 12}, 0},
+	{m68k_op_neg_16_pi           , { 12}, 0},
+	{m68k_op_neg_16_pd           , { 14}, 0},
+	{m68k_op_neg_16_di           , { 16}, 0},
+	{m68k_op_neg_16_ix           , { 18}, 0},
+	{m68k_op_neg_16_aw           , { 16}, 0},
+	{m68k_op_neg_16_al           , { 20}, 0},
+	{m68k_op_neg_32_d            , {  6}, 0},
+	{m68k_op_neg_32_ai           , { 20}, 0},
+	{m68k_op_neg_32_pi           , { 20}, 0},
+	{m68k_op_neg_32_pd           , { 22}, 0},
+	{m68k_op_neg_32_di           , { 24}, 0},
+	{m68k_op_neg_32_ix           , { 26}, 0},
+	{m68k_op_neg_32_aw           , { 24}, 0},
+	{m68k_op_neg_32_al           , { 28}, 0},
+	{m68k_op_move_16_toc_d       , { 12}, 0},
+	{m68k_op_move_16_toc_ai      , { 16}, 0},
+	{m68k_op_move_16_toc_pi      , { 16}, 0},
+	{m68k_op_move_16_toc_pd      , { 18}, 0},
+	{m68k_op_move_16_toc_di      , { 20}, 0},
+	{m68k_op_move_16_toc_ix      , { 22}, 0},
+	{m68k_op_move_16_toc_aw      , { 20}, 0},
+	{m68k_op_move_16_toc_al      , { 24}, 0},
+	{m68k_op_move_16_toc_pcdi    , { 20}, 0},
+	{m68k_op_move_16_toc_pcix    , { 22}, 0},
+	{m68k_op_move_16_toc_i       , { 16}, 0},
+	{m68k_op_not_8_d             , {  4}, 0},
+	{m68k_op_not_8_ai            , { 12}, 0},
+	{m68k_op_not_8_pi            , { 12}, 0},
+	{m68k_op_not_8_pi7           , { 12}, 0},
+	{m68k_op_not_8_pd            , { 14}, 0},
+	{m68k_op_not_8_pd7           , { 14}, 0},
+	{m68k_op_not_8_di            , { 16}, 0},
+	{m68k_op_not_8_ix            , { 18}, 0},
+	{m68k_op_not_8_aw            , { 16}, 0},
+	{m68k_op_not_8_al            , { 20}, 0},
+	{m68k_op_not_16_d            , {  4}, 0},
+	{m68k_op_not_16_ai           , { 12}, 0},
+	{m68k_op_not_16_pi           , { 12}, 0},
+	{m68k_op_not_16_pd           , { 14}, 0},
+	{m68k_op_not_16_di           , { 16}, 0},
+	{m68k_op_not_16_ix           , { 18}, 0},
+	{m68k_op_not_16_aw           , { 16}, 0},
+	{m68k_op_not_16_al           , { 20}, 0},
+	{m68k_op_not_32_d            , {  6}, 0},
+	{m68k_op_not_32_ai           , { 20}, 0},
+	{m68k_op_not_32_pi           , { 20}, 0},
+	{m68k_op_not_32_pd           , { 22}, 0},
+	{m68k_op_not_32_di           , { 24}, 0},
+	{m68k_op_not_32_ix           , { 26}, 0},
+	{m68k_op_not_32_aw           , { 24}, 0},
+	{m68k_op_not_32_al           , { 28}, 0},
+	{m68k_op_move_16_tos_d       , { 12}, 0},
+	{m68k_op_move_16_tos_ai      , { 16}, 0},
+	{m68k_op_move_16_tos_pi      , { 16}, 0},
+	{m68k_op_move_16_tos_pd      , { 18}, 0},
+	{m68k_op_move_16_tos_di      , { 20}, 0},
+	{m68k_op_move_16_tos_ix      , { 22}, 0},
+	{m68k_op_move_16_tos_aw      , { 20}, 0},
+	{m68k_op_move_16_tos_al      , { 24}, 0},
+	{m68k_op_move_16_tos_pcdi    , { 20}, 0},
+	{m68k_op_move_16_tos_pcix    , { 22}, 0},
+	{m68k_op_move_16_tos_i       , { 16}, 0},
+	{m68k_op_nbcd_8_d            , {  6}, 0},
+	{m68k_op_nbcd_8_ai           , { 12}, 0},
+	{m68k_op_nbcd_8_pi           , { 12}, 0},
+	{m68k_op_nbcd_8_pi7          , { 12}, 0},
+	{m68k_op_nbcd_8_pd           , { 14}, 0},
+	{m68k_op_nbcd_8_pd7          , { 14}, 0},
+	{m68k_op_nbcd_8_di           , { 16}, 0},
+	{m68k_op_nbcd_8_ix           , { 18}, 0},
+	{m68k_op_nbcd_8_aw           , { 16}, 0},
+	{m68k_op_nbcd_8_al           , { 20}, 0},
+	{m68k_op_swap_32             , {  4}, 0},
+	{m68k_op_pea_32_ai           , { 12}, 0},
+	{m68k_op_pea_32_di           , { 16}, 0},
+	{m68k_op_pea_32_ix           , { 20}, 0},
+	{m68k_op_pea_32_aw           , { 16}, 0},
+	{m68k_op_pea_32_al           , { 20}, 0},
+	{m68k_op_pea_32_pcdi         , { 16}, 0},
+	{m68k_op_pea_32_pcix         , { 20}, 0},
+	{m68k_op_ext_16              , {  4}, 0},
+	{m68k_op_movem_16_re_ai      , {  8}, 0},
+	{m68k_op_movem_16_re_pd      , {  8}, 0},
+	{m68k_op_movem_16_re_di      , { 12}, 0},
+	{m68k_op_movem_16_re_ix      , { 14}, 0},
+	{m68k_op_movem_16_re_aw      , { 12}, 0},
+	{m68k_op_movem_16_re_al      , { 16}, 0},
+	{m68k_op_ext_32              , {  4}, 0},
+	{m68k_op_movem_32_re_ai      , {  8}, 0},
+	{m68k_op_movem_32_re_pd      , {  8}, 0},
+	{m68k_op_movem_32_re_di      , { 12}, 0},
+	{m68k_op_movem_32_re_ix      , { 14}, 0},
+	{m68k_op_movem_32_re_aw      , { 12}, 0},
+	{m68k_op_movem_32_re_al      , { 16}, 0},
+	{m68k_op_tst_8_d             , {  4}, 0},
+	{m68k_op_tst_8_ai            , {  8}, 0},
+	{m68k_op_tst_8_pi            , {  8}, 0},
+	{m68k_op_tst_8_pi7           , {  8}, 0},
+	{m68k_op_tst_8_pd            , { 10}, 0},
+	{m68k_op_tst_8_pd7           , { 10}, 0},
+	{m68k_op_tst_8_di            , { 12}, 0},
+	{m68k_op_tst_8_ix            , { 14}, 0},
+	{m68k_op_tst_8_aw            , { 12}, 0},
+	{m68k_op_tst_8_al            , { 16}, 0},
+	{m68k_op_tst_16_d            , {  4}, 0},
+	{m68k_op_tst_16_ai           , {  8}, 0},
+	{m68k_op_tst_16_pi           , {  8}, 0},
+	{m68k_op_tst_16_pd           , { 10}, 0},
+	{m68k_op_tst_16_di           , { 12}, 0},
+	{m68k_op_tst_16_ix           , { 14}, 0},
+	{m68k_op_tst_16_aw           , { 12}, 0},
+	{m68k_op_tst_16_al           , { 16}, 0},
+	{m68k_op_tst_32_d            , {  4}, 0},
+	{m68k_op_tst_32_ai           , { 12}, 0},
+	{m68k_op_tst_32_pi           , { 12}, 0},
+	{m68k_op_tst_32_pd           , { 14}, 0},
+	{m68k_op_tst_32_di           , { 16}, 0},
+	{m68k_op_tst_32_ix           , { 18}, 0},
+	{m68k_op_tst_32_aw           , { 16}, 0},
+	{m68k_op_tst_32_al           , { 20}, 0},
+	{m68k_op_tas_8_d             , {  4}, 0},
+	{m68k_op_tas_8_ai            , { 18}, 0},
+	{m68k_op_tas_8_pi            , { 18}, 0},
+	{m68k_op_tas_8_pi7           , { 18}, 0},
+	{m68k_op_tas_8_pd            , { 20}, 0},
+	{m68k_op_tas_8_pd7           , { 20}, 0},
+	{m68k_op_tas_8_di            , { 22}, 0},
+	{m68k_op_tas_8_ix            , { 24}, 0},
+	{m68k_op_tas_8_aw            , { 22}, 0},
+	{m68k_op_tas_8_al            , { 26}, 0},
+	{m68k_op_illegal             , {  4}, 0},
+	{m68k_op_movem_16_er_ai      , { 12}, 0},
+	{m68k_op_movem_16_er_pi      , { 12}, 0},
+	{m68k_op_movem_16_er_di      , { 16}, 0},
+	{m68k_op_movem_16_er_ix      , { 18}, 0},
+	{m68k_op_movem_16_er_aw      , { 16}, 0},
+	{m68k_op_movem_16_er_al      , { 20}, 0},
+	{m68k_op_movem_16_er_pcdi    , { 16}, 0},
+	{m68k_op_movem_16_er_pcix    , { 18}, 0},
+	{m68k_op_movem_32_er_ai      , { 12}, 0},
+	{m68k_op_movem_32_er_pi      , { 12}, 0},
+	{m68k_op_movem_32_er_di      , { 16}, 0},
+	{m68k_op_movem_32_er_ix      , { 18}, 0},
+	{m68k_op_movem_32_er_aw      , { 16}, 0},
+	{m68k_op_movem_32_er_al      , { 20}, 0},
+	{m68k_op_movem_32_er_pcdi    , { 16}, 0},
+	{m68k_op_movem_32_er_pcix    , { 18}, 0},
+	{m68k_op_trap                , {  4}, 0},
+	{m68k_op_link_16             , { 16}, 0},
+	{m68k_op_link_16_a7          , { 16}, 0},
+	{m68k_op_unlk_32             , { 12}, 0},
+	{m68k_op_unlk_32_a7          , { 12}, 0},
+	{m68k_op_move_32_tou         , {  4}, 0},
+	{m68k_op_move_32_fru         , {  4}, 0},
+	{m68k_op_reset               , {  0}, 0},
+	{m68k_op_nop                 , {  4}, 0},
+	{m68k_op_stop                , {  4}, 0},
+	{m68k_op_rte_32              , { 20}, 0},
+	{m68k_op_rts_32              , { 16}, 0},
+	{m68k_op_trapv               , {  4}, 0},
+	{m68k_op_rtr_32              , { 20}, 0},
+	{m68k_op_jsr_32_ai           , { 16}, 0},
+	{m68k_op_jsr_32_di           , { 18}, 0},
+	{m68k_op_jsr_32_ix           , { 22}, 0},
+	{m68k_op_jsr_32_aw           , { 18}, 0},
+	{m68k_op_jsr_32_al           , { 20}, 0},
+	{m68k_op_jsr_32_pcdi         , { 18}, 0},
+	{m68k_op_jsr_32_pcix         , { 22}, 0},
+	{m68k_op_jmp_32_ai           , {  8}, 0},
+	{m68k_op_jmp_32_di           , { 10}, 0},
+	{m68k_op_jmp_32_ix           , { 14}, 0},
+	{m68k_op_jmp_32_aw           , { 10}, 0},
+	{m68k_op_jmp_32_al           , { 12}, 0},
+	{m68k_op_jmp_32_pcdi         , { 10}, 0},
+	{m68k_op_jmp_32_pcix         , { 14}, 0},
+	{m68k_op_addq_8_d            , {  4}, 0},
+	{m68k_op_addq_8_ai           , { 12}, 0},
+	{m68k_op_addq_8_pi           , { 12}, 0},
+	{m68k_op_addq_8_pi7          , { 12}, 0},
+	{m68k_op_addq_8_pd           , { 14}, 0},
+	{m68k_op_addq_8_pd7          , { 14}, 0},
+	{m68k_op_addq_8_di           , { 16}, 0},
+	{m68k_op_addq_8_ix           , { 18}, 0},
+	{m68k_op_addq_8_aw           , { 16}, 0},
+	{m68k_op_addq_8_al           , { 20}, 0},
+	{m68k_op_addq_16_d           , {  4}, 0},
+	{m68k_op_addq_16_a           , {  4}, 0},
+	{m68k_op_addq_16_ai          , { 12}, 0},
+	{m68k_op_addq_16_pi          , { 12}, 0},
+	{m68k_op_addq_16_pd          , { 14}, 0},
+	{m68k_op_addq_16_di          , { 16}, 0},
+	{m68k_op_addq_16_ix          , { 18}, 0},
+	{m68k_op_addq_16_aw          , { 16}, 0},
+	{m68k_op_addq_16_al          , { 20}, 0},
+	{m68k_op_addq_32_d           , {  8}, 0},
+	{m68k_op_addq_32_a           , {  8}, 0},
+	{m68k_op_addq_32_ai          , { 20}, 0},
+	{m68k_op_addq_32_pi          , { 20}, 0},
+	{m68k_op_addq_32_pd          , { 22}, 0},
+	{m68k_op_addq_32_di          , { 24}, 0},
+	{m68k_op_addq_32_ix          , { 26}, 0},
+	{m68k_op_addq_32_aw          , { 24}, 0},
+	{m68k_op_addq_32_al          , { 28}, 0},
+	{m68k_op_st_8_d              , {  6}, 0},
+	{m68k_op_dbt_16              , { 12}, 0},
+	{m68k_op_st_8_ai             , { 12}, 0},
+	{m68k_op_st_8_pi             , { 12}, 0},
+	{m68k_op_st_8_pi7            , { 12}, 0},
+	{m68k_op_st_8_pd             , { 14}, 0},
+	{m68k_op_st_8_pd7            , { 14}, 0},
+	{m68k_op_st_8_di             , { 16}, 0},
+	{m68k_op_st_8_ix             , { 18}, 0},
+	{m68k_op_st_8_aw             , { 16}, 0},
+	{m68k_op_st_8_al             , { 20}, 0},
+	{m68k_op_subq_8_d            , {  4}, 0},
+	{m68k_op_subq_8_ai           , { 12}, 0},
+	{m68k_op_subq_8_pi           , { 12}, 0},
+	{m68k_op_subq_8_pi7          , { 12}, 0},
+	{m68k_op_subq_8_pd           , { 14}, 0},
+	{m68k_op_subq_8_pd7          , { 14}, 0},
+	{m68k_op_subq_8_di           , { 16}, 0},
+	{m68k_op_subq_8_ix           , { 18}, 0},
+	{m68k_op_subq_8_aw           , { 16}, 0},
+	{m68k_op_subq_8_al           , { 20}, 0},
+	{m68k_op_subq_16_d           , {  4}, 0},
+	{m68k_op_subq_16_a           , {  8}, 0},
+	{m68k_op_subq_16_ai          , { 12}, 0},
+	{m68k_op_subq_16_pi          , { 12}, 0},
+	{m68k_op_subq_16_pd          , { 14}, 0},
+	{m68k_op_subq_16_di          , { 16}, 0},
+	{m68k_op_subq_16_ix          , { 18}, 0},
+	{m68k_op_subq_16_aw          , { 16}, 0},
+	{m68k_op_subq_16_al          , { 20}, 0},
+	{m68k_op_subq_32_d           , {  8}, 0},
+	{m68k_op_subq_32_a           , {  8}, 0},
+	{m68k_op_subq_32_ai          , { 20}, 0},
+	{m68k_op_subq_32_pi          , { 20}, 0},
+	{m68k_op_subq_32_pd          , { 22}, 0},
+	{m68k_op_subq_32_di          , { 24}, 0},
+	{m68k_op_subq_32_ix          , { 26}, 0},
+	{m68k_op_subq_32_aw          , { 24}, 0},
+	{m68k_op_subq_32_al          , { 28}, 0},
+	{m68k_op_sf_8_d              , {  4}, 0},
+	{m68k_op_dbf_16              , { 12}, 0},
+	{m68k_op_sf_8_ai             , { 12}, 0},
+	{m68k_op_sf_8_pi             , { 12}, 0},
+	{m68k_op_sf_8_pi7            , { 12}, 0},
+	{m68k_op_sf_8_pd             , { 14}, 0},
+	{m68k_op_sf_8_pd7            , { 14}, 0},
+	{m68k_op_sf_8_di             , { 16}, 0},
+	{m68k_op_sf_8_ix             , { 18}, 0},
+	{m68k_op_sf_8_aw             , { 16}, 0},
+	{m68k_op_sf_8_al             , { 20}, 0},
+	{m68k_op_shi_8_d             , {  4}, 0},
+	{m68k_op_dbhi_16             , { 12}, 0},
+	{m68k_op_shi_8_ai            , { 12}, 0},
+	{m68k_op_shi_8_pi            , { 12}, 0},
+	{m68k_op_shi_8_pi7           , { 12}, 0},
+	{m68k_op_shi_8_pd            , { 14}, 0},
+	{m68k_op_shi_8_pd7           , { 14}, 0},
+	{m68k_op_shi_8_di            , { 16}, 0},
+	{m68k_op_shi_8_ix            , { 18}, 0},
+	{m68k_op_shi_8_aw            , { 16}, 0},
+	{m68k_op_shi_8_al            , { 20}, 0},
+	{m68k_op_sls_8_d             , {  4}, 0},
+	{m68k_op_dbls_16             , { 12}, 0},
+	{m68k_op_sls_8_ai            , { 12}, 0},
+	{m68k_op_sls_8_pi            , { 12}, 0},
+	{m68k_op_sls_8_pi7           , { 12}, 0},
+	{m68k_op_sls_8_pd            , { 14}, 0},
+	{m68k_op_sls_8_pd7           , { 14}, 0},
+	{m68k_op_sls_8_di            , { 16}, 0},
+	{m68k_op_sls_8_ix            , { 18}, 0},
+	{m68k_op_sls_8_aw            , { 16}, 0},
+	{m68k_op_sls_8_al            , { 20}, 0},
+	{m68k_op_scc_8_d             , {  4}, 0},
+	{m68k_op_dbcc_16             , { 12}, 0},
+	{m68k_op_scc_8_ai            , { 12}, 0},
+	{m68k_op_scc_8_pi            , { 12}, 0},
+	{m68k_op_scc_8_pi7           , { 12}, 0},
+	{m68k_op_scc_8_pd            , { 14}, 0},
+	{m68k_op_scc_8_pd7           , { 14}, 0},
+	{m68k_op_scc_8_di            , { 16}, 0},
+	{m68k_op_scc_8_ix            , { 18}, 0},
+	{m68k_op_scc_8_aw            , { 16}, 0},
+	{m68k_op_scc_8_al            , { 20}, 0},
+	{m68k_op_scs_8_d             , {  4}, 0},
+	{m68k_op_dbcs_16             , { 12}, 0},
+	{m68k_op_scs_8_ai            , { 12}, 0},
+	{m68k_op_scs_8_pi            , { 12}, 0},
+	{m68k_op_scs_8_pi7           , { 12}, 0},
+	{m68k_op_scs_8_pd            , { 14}, 0},
+	{m68k_op_scs_8_pd7           , { 14}, 0},
+	{m68k_op_scs_8_di            , { 16}, 0},
+	{m68k_op_scs_8_ix            , { 18}, 0},
+	{m68k_op_scs_8_aw            , { 16}, 0},
+	{m68k_op_scs_8_al            , { 20}, 0},
+	{m68k_op_sne_8_d             , {  4}, 0},
+	{m68k_op_dbne_16             , { 12}, 0},
+	{m68k_op_sne_8_ai            , { 12}, 0},
+	{m68k_op_sne_8_pi            , { 12}, 0},
+	{m68k_op_sne_8_pi7           , { 12}, 0},
+	{m68k_op_sne_8_pd            , { 14}, 0},
+	{m68k_op_sne_8_pd7           , { 14}, 0},
+	{m68k_op_sne_8_di            , { 16}, 0},
+	{m68k_op_sne_8_ix            , { 18}, 0},
+	{m68k_op_sne_8_aw            , { 16}, 0},
+	{m68k_op_sne_8_al            , { 20}, 0},
+	{m68k_op_seq_8_d             , {  4}, 0},
+	{m68k_op_dbeq_16             , { 12}, 0},
+	{m68k_op_seq_8_ai            , { 12}, 0},
+	{m68k_op_seq_8_pi            , { 12}, 0},
+	{m68k_op_seq_8_pi7           , { 12}, 0},
+	{m68k_op_seq_8_pd            , { 14}, 0},
+	{m68k_op_seq_8_pd7           , { 14}, 0},
+	{m68k_op_seq_8_di            , { 16}, 0},
+	{m68k_op_seq_8_ix            , { 18}, 0},
+	{m68k_op_seq_8_aw            , { 16}, 0},
+	{m68k_op_seq_8_al            , { 20}, 0},
+	{m68k_op_svc_8_d             , {  4}, 0},
+	{m68k_op_dbvc_16             , { 12}, 0},
+	{m68k_op_svc_8_ai            , { 12}, 0},
+	{m68k_op_svc_8_pi            , { 12}, 0},
+	{m68k_op_svc_8_pi7           , { 12}, 0},
+	{m68k_op_svc_8_pd            , { 14}, 0},
+	{m68k_op_svc_8_pd7           , { 14}, 0},
+	{m68k_op_svc_8_di            , { 16}, 0},
+	{m68k_op_svc_8_ix            , { 18}, 0},
+	{m68k_op_svc_8_aw            , { 16}, 0},
+	{m68k_op_svc_8_al            , { 20}, 0},
+	{m68k_op_svs_8_d             , {  4}, 0},
+	{m68k_op_dbvs_16             , { 12}, 0},
+	{m68k_op_svs_8_ai            , { 12}, 0},
+	{m68k_op_svs_8_pi            , { 12}, 0},
+	{m68k_op_svs_8_pi7           , { 12}, 0},
+	{m68k_op_svs_8_pd            , { 14}, 0},
+	{m68k_op_svs_8_pd7           , { 14}, 0},
+	{m68k_op_svs_8_di            , { 16}, 0},
+	{m68k_op_svs_8_ix            , { 18}, 0},
+	{m68k_op_svs_8_aw            , { 16}, 0},
+	{m68k_op_svs_8_al            , { 20}, 0},
+	{m68k_op_spl_8_d             , {  4}, 0},
+	{m68k_op_dbpl_16             , { 12}, 0},
+	{m68k_op_spl_8_ai            , { 12}, 0},
+	{m68k_op_spl_8_pi            , { 12}, 0},
+	{m68k_op_spl_8_pi7           , { 12}, 0},
+	{m68k_op_spl_8_pd            , { 14}, 0},
+	{m68k_op_spl_8_pd7           , { 14}, 0},
+	{m68k_op_spl_8_di            , { 16}, 0},
+	{m68k_op_spl_8_ix            , { 18}, 0},
+	{m68k_op_spl_8_aw            , { 16}, 0},
+	{m68k_op_spl_8_al            , { 20}, 0},
+	{m68k_op_smi_8_d             , {  4}, 0},
+	{m68k_op_dbmi_16             , { 12}, 0},
+	{m68k_op_smi_8_ai            , { 12}, 0},
+	{m68k_op_smi_8_pi            , { 12}, 0},
+	{m68k_op_smi_8_pi7           , { 12}, 0},
+	{m68k_op_smi_8_pd            , { 14}, 0},
+	{m68k_op_smi_8_pd7           , { 14}, 0},
+	{m68k_op_smi_8_di            , { 16}, 0},
+	{m68k_op_smi_8_ix            , { 18}, 0},
+	{m68k_op_smi_8_aw            , { 16}, 0},
+	{m68k_op_smi_8_al            , { 20}, 0},
+	{m68k_op_sge_8_d             , {  4}, 0},
+	{m68k_op_dbge_16             , { 12}, 0},
+	{m68k_op_sge_8_ai            , { 12}, 0},
+	{m68k_op_sge_8_pi            , { 12}, 0},
+	{m68k_op_sge_8_pi7           , { 12}, 0},
+	{m68k_op_sge_8_pd            , { 14}, 0},
+	{m68k_op_sge_8_pd7           , { 14}, 0},
+	{m68k_op_sge_8_di            , { 16}, 0},
+	{m68k_op_sge_8_ix            , { 18}, 0},
+	{m68k_op_sge_8_aw            , { 16}, 0},
+	{m68k_op_sge_8_al            , { 20}, 0},
+	{m68k_op_slt_8_d             , {  4}, 0},
+	{m68k_op_dblt_16             , { 12}, 0},
+	{m68k_op_slt_8_ai            , { 12}, 0},
+	{m68k_op_slt_8_pi            , { 12}, 0},
+	{m68k_op_slt_8_pi7           , { 12}, 0},
+	{m68k_op_slt_8_pd            , { 14}, 0},
+	{m68k_op_slt_8_pd7           , { 14}, 0},
+	{m68k_op_slt_8_di            , { 16}, 0},
+	{m68k_op_slt_8_ix            , { 18}, 0},
+	{m68k_op_slt_8_aw            , { 16}, 0},
+	{m68k_op_slt_8_al            , { 20}, 0},
+	{m68k_op_sgt_8_d             , {  4}, 0},
+	{m68k_op_dbgt_16             , { 12}, 0},
+	{m68k_op_sgt_8_ai            , { 12}, 0},
+	{m68k_op_sgt_8_pi            , { 12}, 0},
+	{m68k_op_sgt_8_pi7           , { 12}, 0},
+	{m68k_op_sgt_8_pd            , { 14}, 0},
+	{m68k_op_sgt_8_pd7           , { 14}, 0},
+	{m68k_op_sgt_8_di            , { 16}, 0},
+	{m68k_op_sgt_8_ix            , { 18}, 0},
+	{m68k_op_sgt_8_aw            , { 16}, 0},
+	{m68k_op_sgt_8_al            , { 20}, 0},
+	{m68k_op_sle_8_d             , {  4}, 0},
+	{m68k_op_dble_16             , { 12}, 0},
+	{m68k_op_sle_8_ai            , { 12}, 0},
+	{m68k_op_sle_8_pi            , { 12}, 0},
+	{m68k_op_sle_8_pi7           , { 12}, 0},
+	{m68k_op_sle_8_pd            , { 14}, 0},
+	{m68k_op_sle_8_pd7           , { 14}, 0},
+	{m68k_op_sle_8_di            , { 16}, 0},
+	{m68k_op_sle_8_ix            , { 18}, 0},
+	{m68k_op_sle_8_aw            , { 16}, 0},
+	{m68k_op_sle_8_al            , { 20}, 0},
+	{m68k_op_bra_16              , { 10}, 0},
+	{m68k_op_bra_8               , { 10}, 0},
+	{m68k_op_bsr_16              , { 18}, 0},
+	{m68k_op_bsr_8               , { 18}, 0},
+	{m68k_op_bhi_16              , { 10}, 0},
+	{m68k_op_bhi_8               , { 10}, 0},
+	{m68k_op_bls_16              , { 10}, 0},
+	{m68k_op_bls_8               , { 10}, 0},
+	{m68k_op_bcc_16              , { 10}, 0},
+	{m68k_op_bcc_8               , { 10}, 0},
+	{m68k_op_bcs_16              , { 10}, 0},
+	{m68k_op_bcs_8               , { 10}, 0},
+	{m68k_op_bne_16              , { 10}, 0},
+	{m68k_op_bne_8               , { 10}, 0},
+	{m68k_op_beq_16              , { 10}, 0},
+	{m68k_op_beq_8               , { 10}, 0},
+	{m68k_op_bvc_16              , { 10}, 0},
+	{m68k_op_bvc_8               , { 10}, 0},
+	{m68k_op_bvs_16              , { 10}, 0},
+	{m68k_op_bvs_8               , { 10}, 0},
+	{m68k_op_bpl_16              , { 10}, 0},
+	{m68k_op_bpl_8               , { 10}, 0},
+	{m68k_op_bmi_16              , { 10}, 0},
+	{m68k_op_bmi_8               , { 10}, 0},
+	{m68k_op_bge_16              , { 10}, 0},
+	{m68k_op_bge_8               , { 10}, 0},
+	{m68k_op_blt_16              , { 10}, 0},
+	{m68k_op_blt_8               , { 10}, 0},
+	{m68k_op_bgt_16              , { 10}, 0},
+	{m68k_op_bgt_8               , { 10}, 0},
+	{m68k_op_ble_16              , { 10}, 0},
+	{m68k_op_ble_8               , { 10}, 0},
+	{m68k_op_moveq_32            , {  4}, 0},
+	{m68k_op_or_8_er_d           , {  4}, 0},
+	{m68k_op_or_8_er_ai          , {  8}, 0},
+	{m68k_op_or_8_er_pi          , {  8}, 0},
+	{m68k_op_or_8_er_pi7         , {  8}, 0},
+	{m68k_op_or_8_er_pd          , { 10}, 0},
+	{m68k_op_or_8_er_pd7         , { 10}, 0},
+	{m68k_op_or_8_er_di          , { 12}, 0},
+	{m68k_op_or_8_er_ix          , { 14}, 0},
+	{m68k_op_or_8_er_aw          , { 12}, 0},
+	{m68k_op_or_8_er_al          , { 16}, 0},
+	{m68k_op_or_8_er_pcdi        , { 12}, 0},
+	{m68k_op_or_8_er_pcix        , { 14}, 0},
+	{m68k_op_or_8_er_i           , { 10}, 0},
+	{m68k_op_or_16_er_d          , {  4}, 0},
+	{m68k_op_or_16_er_ai         , {  8}, 0},
+	{m68k_op_or_16_er_pi         , {  8}, 0},
+	{m68k_op_or_16_er_pd         , { 10}, 0},
+	{m68k_op_or_16_er_di         , { 12}, 0},
+	{m68k_op_or_16_er_ix         , { 14}, 0},
+	{m68k_op_or_16_er_aw         , { 12}, 0},
+	{m68k_op_or_16_er_al         , { 16}, 0},
+	{m68k_op_or_16_er_pcdi       , { 12}, 0},
+	{m68k_op_or_16_er_pcix       , { 14}, 0},
+	{m68k_op_or_16_er_i          , { 10}, 0},
+	{m68k_op_or_32_er_d          , {  6}, 0},
+	{m68k_op_or_32_er_ai         , { 14}, 0},
+	{m68k_op_or_32_er_pi         , { 14}, 0},
+	{m68k_op_or_32_er_pd         , { 16}, 0},
+	{m68k_op_or_32_er_di         , { 18}, 0},
+	{m68k_op_or_32_er_ix         , { 20}, 0},
+	{m68k_op_or_32_er_aw         , { 18}, 0},
+	{m68k_op_or_32_er_al         , { 22}, 0},
+	{m68k_op_or_32_er_pcdi       , { 18}, 0},
+	{m68k_op_or_32_er_pcix       , { 20}, 0},
+	{m68k_op_or_32_er_i          , { 16}, 0},
+	{m68k_op_divu_16_d           , {140}, 0},
+	{m68k_op_divu_16_ai          , {144}, 0},
+	{m68k_op_divu_16_pi          , {144}, 0},
+	{m68k_op_divu_16_pd          , {146}, 0},
+	{m68k_op_divu_16_di          , {148}, 0},
+	{m68k_op_divu_16_ix          , {150}, 0},
+	{m68k_op_divu_16_aw          , {148}, 0},
+	{m68k_op_divu_16_al          , {152}, 0},
+	{m68k_op_divu_16_pcdi        , {148}, 0},
+	{m68k_op_divu_16_pcix        , {150}, 0},
+	{m68k_op_divu_16_i           , {144}, 0},
+	{m68k_op_sbcd_8_rr           , {  6}, 0},
+	{m68k_op_sbcd_8_mm           , { 18}, 0},
+	{m68k_op_sbcd_8_mm_ay7       , { 18}, 0},
+	{m68k_op_or_8_re_ai          , { 12}, 0},
+	{m68k_op_or_8_re_pi          , { 12}, 0},
+	{m68k_op_or_8_re_pi7         , { 12}, 0},
+	{m68k_op_or_8_re_pd          , { 14}, 0},
+	{m68k_op_or_8_re_pd7         , { 14}, 0},
+	{m68k_op_or_8_re_di          , { 16}, 0},
+	{m68k_op_or_8_re_ix          , { 18}, 0},
+	{m68k_op_or_8_re_aw          , { 16}, 0},
+	{m68k_op_or_8_re_al          , { 20}, 0},
+	{m68k_op_or_16_re_ai         , { 12}, 0},
+	{m68k_op_or_16_re_pi         , { 12}, 0},
+	{m68k_op_or_16_re_pd         , { 14}, 0},
+	{m68k_op_or_16_re_di         , { 16}, 0},
+	{m68k_op_or_16_re_ix         , { 18}, 0},
+	{m68k_op_or_16_re_aw         , { 16}, 0},
+	{m68k_op_or_16_re_al         , { 20}, 0},
+	{m68k_op_or_32_re_ai         , { 20}, 0},
+	{m68k_op_or_32_re_pi         , { 20}, 0},
+	{m68k_op_or_32_re_pd         , { 22}, 0},
+	{m68k_op_or_32_re_di         , { 24}, 0},
+	{m68k_op_or_32_re_ix         , { 26}, 0},
+	{m68k_op_or_32_re_aw         , { 24}, 0},
+	{m68k_op_or_32_re_al         , { 28}, 0},
+	{m68k_op_divs_16_d           , {158}, 0},
+	{m68k_op_divs_16_ai          , {162}, 0},
+	{m68k_op_divs_16_pi          , {162}, 0},
+	{m68k_op_divs_16_pd          , {164}, 0},
+	{m68k_op_divs_16_di          , {166}, 0},
+	{m68k_op_divs_16_ix          , {168}, 0},
+	{m68k_op_divs_16_aw          , {166}, 0},
+	{m68k_op_divs_16_al          , {170}, 0},
+	{m68k_op_divs_16_pcdi        , {166}, 0},
+	{m68k_op_divs_16_pcix        , {168}, 0},
+	{m68k_op_divs_16_i           , {162}, 0},
+	{m68k_op_sbcd_8_mm_ax7       , { 18}, 0},
+	{m68k_op_sbcd_8_mm_axy7      , { 18}, 0},
+	{m68k_op_sub_8_er_d          , {  4}, 0},
+	{m68k_op_sub_8_er_ai         , {  8}, 0},
+	{m68k_op_sub_8_er_pi         , {  8}, 0},
+	{m68k_op_sub_8_er_pi7        , {  8}, 0},
+	{m68k_op_sub_8_er_pd         , { 10}, 0},
+	{m68k_op_sub_8_er_pd7        , { 10}, 0},
+	{m68k_op_sub_8_er_di         , { 12}, 0},
+	{m68k_op_sub_8_er_ix         , { 14}, 0},
+	{m68k_op_sub_8_er_aw         , { 12}, 0},
+	{m68k_op_sub_8_er_al         , { 16}, 0},
+	{m68k_op_sub_8_er_pcdi       , { 12}, 0},
+	{m68k_op_sub_8_er_pcix       , { 14}, 0},
+	{m68k_op_sub_8_er_i          , { 10}, 0},
+	{m68k_op_sub_16_er_d         , {  4}, 0},
+	{m68k_op_sub_16_er_a         , {  4}, 0},
+	{m68k_op_sub_16_er_ai        , {  8}, 0},
+	{m68k_op_sub_16_er_pi        , {  8}, 0},
+	{m68k_op_sub_16_er_pd        , { 10}, 0},
+	{m68k_op_sub_16_er_di        , { 12}, 0},
+	{m68k_op_sub_16_er_ix        , { 14}, 0},
+	{m68k_op_sub_16_er_aw        , { 12}, 0},
+	{m68k_op_sub_16_er_al        , { 16}, 0},
+	{m68k_op_sub_16_er_pcdi      , { 12}, 0},
+	{m68k_op_sub_16_er_pcix      , { 14}, 0},
+	{m68k_op_sub_16_er_i         , { 10}, 0},
+	{m68k_op_sub_32_er_d         , {  6}, 0},
+	{m68k_op_sub_32_er_a         , {  6}, 0},
+	{m68k_op_sub_32_er_ai        , { 14}, 0},
+	{m68k_op_sub_32_er_pi        , { 14}, 0},
+	{m68k_op_sub_32_er_pd        , { 16}, 0},
+	{m68k_op_sub_32_er_di        , { 18}, 0},
+	{m68k_op_sub_32_er_ix        , { 20}, 0},
+	{m68k_op_sub_32_er_aw        , { 18}, 0},
+	{m68k_op_sub_32_er_al        , { 22}, 0},
+	{m68k_op_sub_32_er_pcdi      , { 18}, 0},
+	{m68k_op_sub_32_er_pcix      , { 20}, 0},
+	{m68k_op_sub_32_er_i         , { 16}, 0},
+	{m68k_op_suba_16_d           , {  8}, 0},
+	{m68k_op_suba_16_a           , {  8}, 0},
+	{m68k_op_suba_16_ai          , { 12}, 0},
+	{m68k_op_suba_16_pi          , { 12}, 0},
+	{m68k_op_suba_16_pd          , { 14}, 0},
+	{m68k_op_suba_16_di          , { 16}, 0},
+	{m68k_op_suba_16_ix          , { 18}, 0},
+	{m68k_op_suba_16_aw          , { 16}, 0},
+	{m68k_op_suba_16_al          , { 20}, 0},
+	{m68k_op_suba_16_pcdi        , { 16}, 0},
+	{m68k_op_suba_16_pcix        , { 18}, 0},
+	{m68k_op_suba_16_i           , { 14}, 0},
+	{m68k_op_subx_8_rr           , {  4}, 0},
+	{m68k_op_subx_8_mm           , { 18}, 0},
+	{m68k_op_subx_8_mm_ay7       , { 18}, 0},
+	{m68k_op_sub_8_re_ai         , { 12}, 0},
+	{m68k_op_sub_8_re_pi         , { 12}, 0},
+	{m68k_op_sub_8_re_pi7        , { 12}, 0},
+	{m68k_op_sub_8_re_pd         , { 14}, 0},
+	{m68k_op_sub_8_re_pd7        , { 14}, 0},
+	{m68k_op_sub_8_re_di         , { 16}, 0},
+	{m68k_op_sub_8_re_ix         , { 18}, 0},
+	{m68k_op_sub_8_re_aw         , { 16}, 0},
+	{m68k_op_sub_8_re_al         , { 20}, 0},
+	{m68k_op_subx_16_rr          , {  4}, 0},
+	{m68k_op_subx_16_mm          , { 18}, 0},
+	{m68k_op_sub_16_re_ai        , { 12}, 0},
+	{m68k_op_sub_16_re_pi        , { 12}, 0},
+	{m68k_op_sub_16_re_pd        , { 14}, 0},
+	{m68k_op_sub_16_re_di        , { 16}, 0},
+	{m68k_op_sub_16_re_ix        , { 18}, 0},
+	{m68k_op_sub_16_re_aw        , { 16}, 0},
+	{m68k_op_sub_16_re_al        , { 20}, 0},
+	{m68k_op_subx_32_rr          , {  8}, 0},
+	{m68k_op_subx_32_mm          , { 30}, 0},
+	{m68k_op_sub_32_re_ai        , { 20}, 0},
+	{m68k_op_sub_32_re_pi        , { 20}, 0},
+	{m68k_op_sub_32_re_pd        , { 22}, 0},
+	{m68k_op_sub_32_re_di        , { 24}, 0},
+	{m68k_op_sub_32_re_ix        , { 26}, 0},
+	{m68k_op_sub_32_re_aw        , { 24}, 0},
+	{m68k_op_sub_32_re_al        , { 28}, 0},
+	{m68k_op_suba_32_d           , {  6}, 0},
+	{m68k_op_suba_32_a           , {  6}, 0},
+	{m68k_op_suba_32_ai          , { 14}, 0},
+	{m68k_op_suba_32_pi          , { 14}, 0},
+	{m68k_op_suba_32_pd          , { 16}, 0},
+	{m68k_op_suba_32_di          , { 18}, 0},
+	{m68k_op_suba_32_ix          , { 20}, 0},
+	{m68k_op_suba_32_aw          , { 18}, 0},
+	{m68k_op_suba_32_al          , { 22}, 0},
+	{m68k_op_suba_32_pcdi        , { 18}, 0},
+	{m68k_op_suba_32_pcix        , { 20}, 0},
+	{m68k_op_suba_32_i           , { 16}, 0},
+	{m68k_op_subx_8_mm_ax7       , { 18}, 0},
+	{m68k_op_subx_8_mm_axy7      , { 18}, 0},
+	{m68k_op_1010                , {  4}, 0},
+	{m68k_op_cmp_8_d             , {  4}, 0},
+	{m68k_op_cmp_8_ai            , {  8}, 0},
+	{m68k_op_cmp_8_pi            , {  8}, 0},
+	{m68k_op_cmp_8_pi7           , {  8}, 0},
+	{m68k_op_cmp_8_pd            , { 10}, 0},
+	{m68k_op_cmp_8_pd7           , { 10}, 0},
+	{m68k_op_cmp_8_di            , { 12}, 0},
+	{m68k_op_cmp_8_ix            , { 14}, 0},
+	{m68k_op_cmp_8_aw            , { 12}, 0},
+	{m68k_op_cmp_8_al            , { 16}, 0},
+	{m68k_op_cmp_8_pcdi          , { 12}, 0},
+	{m68k_op_cmp_8_pcix          , { 14}, 0},
+	{m68k_op_cmp_8_i             , {  8}, 0},
+	{m68k_op_cmp_16_d            , {  4}, 0},
+	{m68k_op_cmp_16_a            , {  4}, 0},
+	{m68k_op_cmp_16_ai           , {  8}, 0},
+	{m68k_op_cmp_16_pi           , {  8}, 0},
+	{m68k_op_cmp_16_pd           , { 10}, 0},
+	{m68k_op_cmp_16_di           , { 12}, 0},
+	{m68k_op_cmp_16_ix           , { 14}, 0},
+	{m68k_op_cmp_16_aw           , { 12}, 0},
+	{m68k_op_cmp_16_al           , { 16}, 0},
+	{m68k_op_cmp_16_pcdi         , { 12}, 0},
+	{m68k_op_cmp_16_pcix         , { 14}, 0},
+	{m68k_op_cmp_16_i            , {  8}, 0},
+	{m68k_op_cmp_32_d            , {  6}, 0},
+	{m68k_op_cmp_32_a            , {  6}, 0},
+	{m68k_op_cmp_32_ai           , { 14}, 0},
+	{m68k_op_cmp_32_pi           , { 14}, 0},
+	{m68k_op_cmp_32_pd           , { 16}, 0},
+	{m68k_op_cmp_32_di           , { 18}, 0},
+	{m68k_op_cmp_32_ix           , { 20}, 0},
+	{m68k_op_cmp_32_aw           , { 18}, 0},
+	{m68k_op_cmp_32_al           , { 22}, 0},
+	{m68k_op_cmp_32_pcdi         , { 18}, 0},
+	{m68k_op_cmp_32_pcix         , { 20}, 0},
+	{m68k_op_cmp_32_i            , { 14}, 0},
+	{m68k_op_cmpa_16_d           , {  6}, 0},
+	{m68k_op_cmpa_16_a           , {  6}, 0},
+	{m68k_op_cmpa_16_ai          , { 10}, 0},
+	{m68k_op_cmpa_16_pi          , { 10}, 0},
+	{m68k_op_cmpa_16_pd          , { 12}, 0},
+	{m68k_op_cmpa_16_di          , { 14}, 0},
+	{m68k_op_cmpa_16_ix          , { 16}, 0},
+	{m68k_op_cmpa_16_aw          , { 14}, 0},
+	{m68k_op_cmpa_16_al          , { 18}, 0},
+	{m68k_op_cmpa_16_pcdi        , { 14}, 0},
+	{m68k_op_cmpa_16_pcix        , { 16}, 0},
+	{m68k_op_cmpa_16_i           , { 10}, 0},
+	{m68k_op_eor_8_d             , {  4}, 0},
+	{m68k_op_cmpm_8              , { 12}, 0},
+	{m68k_op_cmpm_8_ay7          , { 12}, 0},
+	{m68k_op_eor_8_ai            , { 12}, 0},
+	{m68k_op_eor_8_pi            , { 12}, 0},
+	{m68k_op_eor_8_pi7           , { 12}, 0},
+	{m68k_op_eor_8_pd            , { 14}, 0},
+	{m68k_op_eor_8_pd7           , { 14}, 0},
+	{m68k_op_eor_8_di            , { 16}, 0},
+	{m68k_op_eor_8_ix            , { 18}, 0},
+	{m68k_op_eor_8_aw            , { 16}, 0},
+	{m68k_op_eor_8_al            , { 20}, 0},
+	{m68k_op_eor_16_d            , {  4}, 0},
+	{m68k_op_cmpm_16             , { 12}, 0},
+	{m68k_op_eor_16_ai           , { 12}, 0},
+	{m68k_op_eor_16_pi           , { 12}, 0},
+	{m68k_op_eor_16_pd           , { 14}, 0},
+	{m68k_op_eor_16_di           , { 16}, 0},
+	{m68k_op_eor_16_ix           , { 18}, 0},
+	{m68k_op_eor_16_aw           , { 16}, 0},
+	{m68k_op_eor_16_al           , { 20}, 0},
+	{m68k_op_eor_32_d            , {  8}, 0},
+	{m68k_op_cmpm_32             , { 20}, 0},
+	{m68k_op_eor_32_ai           , { 20}, 0},
+	{m68k_op_eor_32_pi           , { 20}, 0},
+	{m68k_op_eor_32_pd           , { 22}, 0},
+	{m68k_op_eor_32_di           , { 24}, 0},
+	{m68k_op_eor_32_ix           , { 26}, 0},
+	{m68k_op_eor_32_aw           , { 24}, 0},
+	{m68k_op_eor_32_al           , { 28}, 0},
+	{m68k_op_cmpa_32_d           , {  6}, 0},
+	{m68k_op_cmpa_32_a           , {  6}, 0},
+	{m68k_op_cmpa_32_ai          , { 14}, 0},
+	{m68k_op_cmpa_32_pi          , { 14}, 0},
+	{m68k_op_cmpa_32_pd          , { 16}, 0},
+	{m68k_op_cmpa_32_di          , { 18}, 0},
+	{m68k_op_cmpa_32_ix          , { 20}, 0},
+	{m68k_op_cmpa_32_aw          , { 18}, 0},
+	{m68k_op_cmpa_32_al          , { 22}, 0},
+	{m68k_op_cmpa_32_pcdi        , { 18}, 0},
+	{m68k_op_cmpa_32_pcix        , { 20}, 0},
+	{m68k_op_cmpa_32_i           , { 14}, 0},
+	{m68k_op_cmpm_8_ax7          , { 12}, 0},
+	{m68k_op_cmpm_8_axy7         , { 12}, 0},
+	{m68k_op_and_8_er_d          , {  4}, 0},
+	{m68k_op_and_8_er_ai         , {  8}, 0},
+	{m68k_op_and_8_er_pi         , {  8}, 0},
+	{m68k_op_and_8_er_pi7        , {  8}, 0},
+	{m68k_op_and_8_er_pd         , { 10}, 0},
+	{m68k_op_and_8_er_pd7        , { 10}, 0},
+	{m68k_op_and_8_er_di         , { 12}, 0},
+	{m68k_op_and_8_er_ix         , { 14}, 0},
+	{m68k_op_and_8_er_aw         , { 12}, 0},
+	{m68k_op_and_8_er_al         , { 16}, 0},
+	{m68k_op_and_8_er_pcdi       , { 12}, 0},
+	{m68k_op_and_8_er_pcix       , { 14}, 0},
+	{m68k_op_and_8_er_i          , { 10}, 0},
+	{m68k_op_and_16_er_d         , {  4}, 0},
+	{m68k_op_and_16_er_ai        , {  8}, 0},
+	{m68k_op_and_16_er_pi        , {  8}, 0},
+	{m68k_op_and_16_er_pd        , { 10}, 0},
+	{m68k_op_and_16_er_di        , { 12}, 0},
+	{m68k_op_and_16_er_ix        , { 14}, 0},
+	{m68k_op_and_16_er_aw        , { 12}, 0},
+	{m68k_op_and_16_er_al        , { 16}, 0},
+	{m68k_op_and_16_er_pcdi      , { 12}, 0},
+	{m68k_op_and_16_er_pcix      , { 14}, 0},
+	{m68k_op_and_16_er_i         , { 10}, 0},
+	{m68k_op_and_32_er_d         , {  6}, 0},
+	{m68k_op_and_32_er_ai        , { 14}, 0},
+	{m68k_op_and_32_er_pi        , { 14}, 0},
+	{m68k_op_and_32_er_pd        , { 16}, 0},
+	{m68k_op_and_32_er_di        , { 18}, 0},
+	{m68k_op_and_32_er_ix        , { 20}, 0},
+	{m68k_op_and_32_er_aw        , { 18}, 0},
+	{m68k_op_and_32_er_al        , { 22}, 0},
+	{m68k_op_and_32_er_pcdi      , { 18}, 0},
+	{m68k_op_and_32_er_pcix      , { 20}, 0},
+	{m68k_op_and_32_er_i         , { 16}, 0},
+	{m68k_op_mulu_16_d           , { 54}, 0},
+	{m68k_op_mulu_16_ai          , { 58}, 0},
+	{m68k_op_mulu_16_pi          , { 58}, 0},
+	{m68k_op_mulu_16_pd          , { 60}, 0},
+	{m68k_op_mulu_16_di          , { 62}, 0},
+	{m68k_op_mulu_16_ix          , { 64}, 0},
+	{m68k_op_mulu_16_aw          , { 62}, 0},
+	{m68k_op_mulu_16_al          , { 66}, 0},
+	{m68k_op_mulu_16_pcdi        , { 62}, 0},
+	{m68k_op_mulu_16_pcix        , { 64}, 0},
+	{m68k_op_mulu_16_i           , { 58}, 0},
+	{m68k_op_abcd_8_rr           , {  6}, 0},
+	{m68k_op_abcd_8_mm           , { 18}, 0},
+	{m68k_op_abcd_8_mm_ay7       , { 18}, 0},
+	{m68k_op_and_8_re_ai         , { 12}, 0},
+	{m68k_op_and_8_re_pi         , { 12}, 0},
+	{m68k_op_and_8_re_pi7        , { 12}, 0},
+	{m68k_op_and_8_re_pd         , { 14}, 0},
+	{m68k_op_and_8_re_pd7        , { 14}, 0},
+	{m68k_op_and_8_re_di         , { 16}, 0},
+	{m68k_op_and_8_re_ix         , { 18}, 0},
+	{m68k_op_and_8_re_aw         , { 16}, 0},
+	{m68k_op_and_8_re_al         , { 20}, 0},
+	{m68k_op_exg_32_dd           , {  6}, 0},
+	{m68k_op_exg_32_aa           , {  6}, 0},
+	{m68k_op_and_16_re_ai        , { 12}, 0},
+	{m68k_op_and_16_re_pi        , { 12}, 0},
+	{m68k_op_and_16_re_pd        , { 14}, 0},
+	{m68k_op_and_16_re_di        , { 16}, 0},
+	{m68k_op_and_16_re_ix        , { 18}, 0},
+	{m68k_op_and_16_re_aw        , { 16}, 0},
+	{m68k_op_and_16_re_al        , { 20}, 0},
+	{m68k_op_exg_32_da           , {  6}, 0},
+	{m68k_op_and_32_re_ai        , { 20}, 0},
+	{m68k_op_and_32_re_pi        , { 20}, 0},
+	{m68k_op_and_32_re_pd        , { 22}, 0},
+	{m68k_op_and_32_re_di        , { 24}, 0},
+	{m68k_op_and_32_re_ix        , { 26}, 0},
+	{m68k_op_and_32_re_aw        , { 24}, 0},
+	{m68k_op_and_32_re_al        , { 28}, 0},
+	{m68k_op_muls_16_d           , { 54}, 0},
+	{m68k_op_muls_16_ai          , { 58}, 0},
+	{m68k_op_muls_16_pi          , { 58}, 0},
+	{m68k_op_muls_16_pd          , { 60}, 0},
+	{m68k_op_muls_16_di          , { 62}, 0},
+	{m68k_op_muls_16_ix          , { 64}, 0},
+	{m68k_op_muls_16_aw          , { 62}, 0},
+	{m68k_op_muls_16_al          , { 66}, 0},
+	{m68k_op_muls_16_pcdi        , { 62}, 0},
+	{m68k_op_muls_16_pcix        , { 64}, 0},
+	{m68k_op_muls_16_i           , { 58}, 0},
+	{m68k_op_abcd_8_mm_ax7       , { 18}, 0},
+	{m68k_op_abcd_8_mm_axy7      , { 18}, 0},
+	{m68k_op_add_8_er_d          , {  4}, 0},
+	{m68k_op_add_8_er_ai         , {  8}, 0},
+	{m68k_op_add_8_er_pi         , {  8}, 0},
+	{m68k_op_add_8_er_pi7        , {  8}, 0},
+	{m68k_op_add_8_er_pd         , { 10}, 0},
+	{m68k_op_add_8_er_pd7        , { 10}, 0},
+	{m68k_op_add_8_er_di         , { 12}, 0},
+	{m68k_op_add_8_er_ix         , { 14}, 0},
+	{m68k_op_add_8_er_aw         , { 12}, 0},
+	{m68k_op_add_8_er_al         , { 16}, 0},
+	{m68k_op_add_8_er_pcdi       , { 12}, 0},
+	{m68k_op_add_8_er_pcix       , { 14}, 0},
+	{m68k_op_add_8_er_i          , { 10}, 0},
+	{m68k_op_add_16_er_d         , {  4}, 0},
+	{m68k_op_add_16_er_a         , {  4}, 0},
+	{m68k_op_add_16_er_ai        , {  8}, 0},
+	{m68k_op_add_16_er_pi        , {  8}, 0},
+	{m68k_op_add_16_er_pd        , { 10}, 0},
+	{m68k_op_add_16_er_di        , { 12}, 0},
+	{m68k_op_add_16_er_ix        , { 14}, 0},
+	{m68k_op_add_16_er_aw        , { 12}, 0},
+	{m68k_op_add_16_er_al        , { 16}, 0},
+	{m68k_op_add_16_er_pcdi      , { 12}, 0},
+	{m68k_op_add_16_er_pcix      , { 14}, 0},
+	{m68k_op_add_16_er_i         , { 10}, 0},
+	{m68k_op_add_32_er_d         , {  6}, 0},
+	{m68k_op_add_32_er_a         , {  6}, 0},
+	{m68k_op_add_32_er_ai        , { 14}, 0},
+	{m68k_op_add_32_er_pi        , { 14}, 0},
+	{m68k_op_add_32_er_pd        , { 16}, 0},
+	{m68k_op_add_32_er_di        , { 18}, 0},
+	{m68k_op_add_32_er_ix        , { 20}, 0},
+	{m68k_op_add_32_er_aw        , { 18}, 0},
+	{m68k_op_add_32_er_al        , { 22}, 0},
+	{m68k_op_add_32_er_pcdi      , { 18}, 0},
+	{m68k_op_add_32_er_pcix      , { 20}, 0},
+	{m68k_op_add_32_er_i         , { 16}, 0},
+	{m68k_op_adda_16_d           , {  8}, 0},
+	{m68k_op_adda_16_a           , {  8}, 0},
+	{m68k_op_adda_16_ai          , { 12}, 0},
+	{m68k_op_adda_16_pi          , { 12}, 0},
+	{m68k_op_adda_16_pd          , { 14}, 0},
+	{m68k_op_adda_16_di          , { 16}, 0},
+	{m68k_op_adda_16_ix          , { 18}, 0},
+	{m68k_op_adda_16_aw          , { 16}, 0},
+	{m68k_op_adda_16_al          , { 20}, 0},
+	{m68k_op_adda_16_pcdi        , { 16}, 0},
+	{m68k_op_adda_16_pcix        , { 18}, 0},
+	{m68k_op_adda_16_i           , { 14}, 0},
+	{m68k_op_addx_8_rr           , {  4}, 0},
+	{m68k_op_addx_8_mm           , { 18}, 0},
+	{m68k_op_addx_8_mm_ay7       , { 18}, 0},
+	{m68k_op_add_8_re_ai         , { 12}, 0},
+	{m68k_op_add_8_re_pi         , { 12}, 0},
+	{m68k_op_add_8_re_pi7        , { 12}, 0},
+	{m68k_op_add_8_re_pd         , { 14}, 0},
+	{m68k_op_add_8_re_pd7        , { 14}, 0},
+	{m68k_op_add_8_re_di         , { 16}, 0},
+	{m68k_op_add_8_re_ix         , { 18}, 0},
+	{m68k_op_add_8_re_aw         , { 16}, 0},
+	{m68k_op_add_8_re_al         , { 20}, 0},
+	{m68k_op_addx_16_rr          , {  4}, 0},
+	{m68k_op_addx_16_mm          , { 18}, 0},
+	{m68k_op_add_16_re_ai        , { 12}, 0},
+	{m68k_op_add_16_re_pi        , { 12}, 0},
+	{m68k_op_add_16_re_pd        , { 14}, 0},
+	{m68k_op_add_16_re_di        , { 16}, 0},
+	{m68k_op_add_16_re_ix        , { 18}, 0},
+	{m68k_op_add_16_re_aw        , { 16}, 0},
+	{m68k_op_add_16_re_al        , { 20}, 0},
+	{m68k_op_addx_32_rr          , {  8}, 0},
+	{m68k_op_addx_32_mm          , { 30}, 0},
+	{m68k_op_add_32_re_ai        , { 20}, 0},
+	{m68k_op_add_32_re_pi        , { 20}, 0},
+	{m68k_op_add_32_re_pd        , { 22}, 0},
+	{m68k_op_add_32_re_di        , { 24}, 0},
+	{m68k_op_add_32_re_ix        , { 26}, 0},
+	{m68k_op_add_32_re_aw        , { 24}, 0},
+	{m68k_op_add_32_re_al        , { 28}, 0},
+	{m68k_op_adda_32_d           , {  6}, 0},
+	{m68k_op_adda_32_a           , {  6}, 0},
+	{m68k_op_adda_32_ai          , { 14}, 0},
+	{m68k_op_adda_32_pi          , { 14}, 0},
+	{m68k_op_adda_32_pd          , { 16}, 0},
+	{m68k_op_adda_32_di          , { 18}, 0},
+	{m68k_op_adda_32_ix          , { 20}, 0},
+	{m68k_op_adda_32_aw          , { 18}, 0},
+	{m68k_op_adda_32_al          , { 22}, 0},
+	{m68k_op_adda_32_pcdi        , { 18}, 0},
+	{m68k_op_adda_32_pcix        , { 20}, 0},
+	{m68k_op_adda_32_i           , { 16}, 0},
+	{m68k_op_addx_8_mm_ax7       , { 18}, 0},
+	{m68k_op_addx_8_mm_axy7      , { 18}, 0},
+	{m68k_op_asr_8_s             , { 22}, 0},
+	{m68k_op_lsr_8_s             , { 22}, 0},
+	{m68k_op_roxr_8_s            , { 22}, 0},
+	{m68k_op_ror_8_s             , { 22}, 0},
+	{m68k_op_asr_8_r             , {  6}, 0},
+	{m68k_op_lsr_8_r             , {  6}, 0},
+	{m68k_op_roxr_8_r            , {  6}, 0},
+	{m68k_op_ror_8_r             , {  6}, 0},
+	{m68k_op_asr_16_s            , { 22}, 0},
+	{m68k_op_lsr_16_s            , { 22}, 0},
+	{m68k_op_roxr_16_s           , { 22}, 0},
+	{m68k_op_ror_16_s            , { 22}, 0},
+	{m68k_op_asr_16_r            , {  6}, 0},
+	{m68k_op_lsr_16_r            , {  6}, 0},
+	{m68k_op_roxr_16_r           , {  6}, 0},
+	{m68k_op_ror_16_r            , {  6}, 0},
+	{m68k_op_asr_32_s            , { 24}, 0},
+	{m68k_op_lsr_32_s            , { 24}, 0},
+	{m68k_op_roxr_32_s           , { 24}, 0},
+	{m68k_op_ror_32_s            , { 24}, 0},
+	{m68k_op_asr_32_r            , {  8}, 0},
+	{m68k_op_lsr_32_r            , {  8}, 0},
+	{m68k_op_roxr_32_r           , {  8}, 0},
+	{m68k_op_ror_32_r            , {  8}, 0},
+	{m68k_op_asr_16_ai           , { 12}, 0},
+	{m68k_op_asr_16_pi           , { 12}, 0},
+	{m68k_op_asr_16_pd           , { 14}, 0},
+	{m68k_op_asr_16_di           , { 16}, 0},
+	{m68k_op_asr_16_ix           , { 18}, 0},
+	{m68k_op_asr_16_aw           , { 16}, 0},
+	{m68k_op_asr_16_al           , { 20}, 0},
+	{m68k_op_asl_8_s             , { 22}, 0},
+	{m68k_op_lsl_8_s             , { 22}, 0},
+	{m68k_op_roxl_8_s            , { 22}, 0},
+	{m68k_op_rol_8_s             , { 22}, 0},
+	{m68k_op_asl_8_r             , {  6}, 0},
+	{m68k_op_lsl_8_r             , {  6}, 0},
+	{m68k_op_roxl_8_r            , {  6}, 0},
+	{m68k_op_rol_8_r             , {  6}, 0},
+	{m68k_op_asl_16_s            , { 22}, 0},
+	{m68k_op_lsl_16_s            , { 22}, 0},
+	{m68k_op_roxl_16_s           , { 22}, 0},
+	{m68k_op_rol_16_s            , { 22}, 0},
+	{m68k_op_asl_16_r            , {  6}, 0},
+	{m68k_op_lsl_16_r            , {  6}, 0},
+	{m68k_op_roxl_16_r           , {  6}, 0},
+	{m68k_op_rol_16_r            , {  6}, 0},
+	{m68k_op_asl_32_s            , { 24}, 0},
+	{m68k_op_lsl_32_s            , { 24}, 0},
+	{m68k_op_roxl_32_s           , { 24}, 0},
+	{m68k_op_rol_32_s            , { 24}, 0},
+	{m68k_op_asl_32_r            , {  8}, 0},
+	{m68k_op_lsl_32_r            , {  8}, 0},
+	{m68k_op_roxl_32_r           , {  8}, 0},
+	{m68k_op_rol_32_r            , {  8}, 0},
+	{m68k_op_asl_16_ai           , { 12}, 0},
+	{m68k_op_asl_16_pi           , { 12}, 0},
+	{m68k_op_asl_16_pd           , { 14}, 0},
+	{m68k_op_asl_16_di           , { 16}, 0},
+	{m68k_op_asl_16_ix           , { 18}, 0},
+	{m68k_op_asl_16_aw           , { 16}, 0},
+	{m68k_op_asl_16_al           , { 20}, 0},
+	{m68k_op_asr_8_s             , {  8}, 0},
+	{m68k_op_lsr_8_s             , {  8}, 0},
+	{m68k_op_roxr_8_s            , {  8}, 0},
+	{m68k_op_ror_8_s             , {  8}, 0},
+	{m68k_op_asr_16_s            , {  8}, 0},
+	{m68k_op_lsr_16_s            , {  8}, 0},
+	{m68k_op_roxr_16_s           , {  8}, 0},
+	{m68k_op_ror_16_s            , {  8}, 0},
+	{m68k_op_asr_32_s            , { 10}, 0},
+	{m68k_op_lsr_32_s            , { 10}, 0},
+	{m68k_op_roxr_32_s           , { 10}, 0},
+	{m68k_op_ror_32_s            , { 10}, 0},
+	{m68k_op_lsr_16_ai           , { 12}, 0},
+	{m68k_op_lsr_16_pi           , { 12}, 0},
+	{m68k_op_lsr_16_pd           , { 14}, 0},
+	{m68k_op_lsr_16_di           , { 16}, 0},
+	{m68k_op_lsr_16_ix           , { 18}, 0},
+	{m68k_op_lsr_16_aw           , { 16}, 0},
+	{m68k_op_lsr_16_al           , { 20}, 0},
+	{m68k_op_asl_8_s             , {  8}, 0},
+	{m68k_op_lsl_8_s             , {  8}, 0},
+	{m68k_op_roxl_8_s            , {  8}, 0},
+	{m68k_op_rol_8_s             , {  8}, 0},
+	{m68k_op_asl_16_s            , {  8}, 0},
+	{m68k_op_lsl_16_s            , {  8}, 0},
+	{m68k_op_roxl_16_s           , {  8}, 0},
+	{m68k_op_rol_16_s            , {  8}, 0},
+	{m68k_op_asl_32_s            , { 10}, 0},
+	{m68k_op_lsl_32_s            , { 10}, 0},
+	{m68k_op_roxl_32_s           , { 10}, 0},
+	{m68k_op_rol_32_s            , { 10}, 0},
+	{m68k_op_lsl_16_ai           , { 12}, 0},
+	{m68k_op_lsl_16_pi           , { 12}, 0},
+	{m68k_op_lsl_16_pd           , { 14}, 0},
+	{m68k_op_lsl_16_di           , { 16}, 0},
+	{m68k_op_lsl_16_ix           , { 18}, 0},
+	{m68k_op_lsl_16_aw           , { 16}, 0},
+	{m68k_op_lsl_16_al           , { 20}, 0},
+	{m68k_op_asr_8_s             , { 10}, 0},
+	{m68k_op_lsr_8_s             , { 10}, 0},
+	{m68k_op_roxr_8_s            , { 10}, 0},
+	{m68k_op_ror_8_s             , { 10}, 0},
+	{m68k_op_asr_16_s            , { 10}, 0},
+	{m68k_op_lsr_16_s            , { 10}, 0},
+	{m68k_op_roxr_16_s           , { 10}, 0},
+	{m68k_op_ror_16_s            , { 10}, 0},
+	{m68k_op_asr_32_s            , { 12}, 0},
+	{m68k_op_lsr_32_s            , { 12}, 0},
+	{m68k_op_roxr_32_s           , { 12}, 0},
+	{m68k_op_ror_32_s            , { 12}, 0},
+	{m68k_op_roxr_16_ai          , { 12}, 0},
+	{m68k_op_roxr_16_pi          , { 12}, 0},
+	{m68k_op_roxr_16_pd          , { 14}, 0},
+	{m68k_op_roxr_16_di          , { 16}, 0},
+	{m68k_op_roxr_16_ix          , { 18}, 0},
+	{m68k_op_roxr_16_aw          , { 16}, 0},
+	{m68k_op_roxr_16_al          , { 20}, 0},
+	{m68k_op_asl_8_s             , { 10}, 0},
+	{m68k_op_lsl_8_s             , { 10}, 0},
+	{m68k_op_roxl_8_s            , { 10}, 0},
+	{m68k_op_rol_8_s             , { 10}, 0},
+	{m68k_op_asl_16_s            , { 10}, 0},
+	{m68k_op_lsl_16_s            , { 10}, 0},
+	{m68k_op_roxl_16_s           , { 10}, 0},
+	{m68k_op_rol_16_s            , { 10}, 0},
+	{m68k_op_asl_32_s            , { 12}, 0},
+	{m68k_op_lsl_32_s            , { 12}, 0},
+	{m68k_op_roxl_32_s           , { 12}, 0},
+	{m68k_op_rol_32_s            , { 12}, 0},
+	{m68k_op_roxl_16_ai          , { 12}, 0},
+	{m68k_op_roxl_16_pi          , { 12}, 0},
+	{m68k_op_roxl_16_pd          , { 14}, 0},
+	{m68k_op_roxl_16_di          , { 16}, 0},
+	{m68k_op_roxl_16_ix          , { 18}, 0},
+	{m68k_op_roxl_16_aw          , { 16}, 0},
+	{m68k_op_roxl_16_al          , { 20}, 0},
+	{m68k_op_asr_8_s             , { 12}, 0},
+	{m68k_op_lsr_8_s             , { 12}, 0},
+	{m68k_op_roxr_8_s            , { 12}, 0},
+	{m68k_op_ror_8_s             , { 12}, 0},
+	{m68k_op_asr_16_s            , { 12}, 0},
+	{m68k_op_lsr_16_s            , { 12}, 0},
+	{m68k_op_roxr_16_s           , { 12}, 0},
+	{m68k_op_ror_16_s            , { 12}, 0},
+	{m68k_op_asr_32_s            , { 14}, 0},
+	{m68k_op_lsr_32_s            , { 14}, 0},
+	{m68k_op_roxr_32_s           , { 14}, 0},
+	{m68k_op_ror_32_s            , { 14}, 0},
+	{m68k_op_ror_16_ai           , { 12}, 0},
+	{m68k_op_ror_16_pi           , { 12}, 0},
+	{m68k_op_ror_16_pd           , { 14}, 0},
+	{m68k_op_ror_16_di           , { 16}, 0},
+	{m68k_op_ror_16_ix           , { 18}, 0},
+	{m68k_op_ror_16_aw           , { 16}, 0},
+	{m68k_op_ror_16_al           , { 20}, 0},
+	{m68k_op_asl_8_s             , { 12}, 0},
+	{m68k_op_lsl_8_s             , { 12}, 0},
+	{m68k_op_roxl_8_s            , { 12}, 0},
+	{m68k_op_rol_8_s             , { 12}, 0},
+	{m68k_op_asl_16_s            , { 12}, 0},
+	{m68k_op_lsl_16_s            , { 12}, 0},
+	{m68k_op_roxl_16_s           , { 12}, 0},
+	{m68k_op_rol_16_s            , { 12}, 0},
+	{m68k_op_asl_32_s            , { 14}, 0},
+	{m68k_op_lsl_32_s            , { 14}, 0},
+	{m68k_op_roxl_32_s           , { 14}, 0},
+	{m68k_op_rol_32_s            , { 14}, 0},
+	{m68k_op_rol_16_ai           , { 12}, 0},
+	{m68k_op_rol_16_pi           , { 12}, 0},
+	{m68k_op_rol_16_pd           , { 14}, 0},
+	{m68k_op_rol_16_di           , { 16}, 0},
+	{m68k_op_rol_16_ix           , { 18}, 0},
+	{m68k_op_rol_16_aw           , { 16}, 0},
+	{m68k_op_rol_16_al           , { 20}, 0},
+	{m68k_op_asr_8_s             , { 14}, 0},
+	{m68k_op_lsr_8_s             , { 14}, 0},
+	{m68k_op_roxr_8_s            , { 14}, 0},
+	{m68k_op_ror_8_s             , { 14}, 0},
+	{m68k_op_asr_16_s            , { 14}, 0},
+	{m68k_op_lsr_16_s            , { 14}, 0},
+	{m68k_op_roxr_16_s           , { 14}, 0},
+	{m68k_op_ror_16_s            , { 14}, 0},
+	{m68k_op_asr_32_s            , { 16}, 0},
+	{m68k_op_lsr_32_s            , { 16}, 0},
+	{m68k_op_roxr_32_s           , { 16}, 0},
+	{m68k_op_ror_32_s            , { 16}, 0},
+	{m68k_op_asl_8_s             , { 14}, 0},
+	{m68k_op_lsl_8_s             , { 14}, 0},
+	{m68k_op_roxl_8_s            , { 14}, 0},
+	{m68k_op_rol_8_s             , { 14}, 0},
+	{m68k_op_asl_16_s            , { 14}, 0},
+	{m68k_op_lsl_16_s            , { 14}, 0},
+	{m68k_op_roxl_16_s           , { 14}, 0},
+	{m68k_op_rol_16_s            , { 14}, 0},
+	{m68k_op_asl_32_s            , { 16}, 0},
+	{m68k_op_lsl_32_s            , { 16}, 0},
+	{m68k_op_roxl_32_s           , { 16}, 0},
+	{m68k_op_rol_32_s            , { 16}, 0},
+	{m68k_op_asr_8_s             , { 16}, 0},
+	{m68k_op_lsr_8_s             , { 16}, 0},
+	{m68k_op_roxr_8_s            , { 16}, 0},
+	{m68k_op_ror_8_s             , { 16}, 0},
+	{m68k_op_asr_16_s            , { 16}, 0},
+	{m68k_op_lsr_16_s            , { 16}, 0},
+	{m68k_op_roxr_16_s           , { 16}, 0},
+	{m68k_op_ror_16_s            , { 16}, 0},
+	{m68k_op_asr_32_s            , { 18}, 0},
+	{m68k_op_lsr_32_s            , { 18}, 0},
+	{m68k_op_roxr_32_s           , { 18}, 0},
+	{m68k_op_ror_32_s            , { 18}, 0},
+	{m68k_op_asl_8_s             , { 16}, 0},
+	{m68k_op_lsl_8_s             , { 16}, 0},
+	{m68k_op_roxl_8_s            , { 16}, 0},
+	{m68k_op_rol_8_s             , { 16}, 0},
+	{m68k_op_asl_16_s            , { 16}, 0},
+	{m68k_op_lsl_16_s            , { 16}, 0},
+	{m68k_op_roxl_16_s           , { 16}, 0},
+	{m68k_op_rol_16_s            , { 16}, 0},
+	{m68k_op_asl_32_s            , { 18}, 0},
+	{m68k_op_lsl_32_s            , { 18}, 0},
+	{m68k_op_roxl_32_s           , { 18}, 0},
+	{m68k_op_rol_32_s            , { 18}, 0},
+	{m68k_op_asr_8_s             , { 18}, 0},
+	{m68k_op_lsr_8_s             , { 18}, 0},
+	{m68k_op_roxr_8_s            , { 18}, 0},
+	{m68k_op_ror_8_s             , { 18}, 0},
+	{m68k_op_asr_16_s            , { 18}, 0},
+	{m68k_op_lsr_16_s            , { 18}, 0},
+	{m68k_op_roxr_16_s           , { 18}, 0},
+	{m68k_op_ror_16_s            , { 18}, 0},
+	{m68k_op_asr_32_s            , { 20}, 0},
+	{m68k_op_lsr_32_s            , { 20}, 0},
+	{m68k_op_roxr_32_s           , { 20}, 0},
+	{m68k_op_ror_32_s            , { 20}, 0},
+	{m68k_op_asl_8_s             , { 18}, 0},
+	{m68k_op_lsl_8_s             , { 18}, 0},
+	{m68k_op_roxl_8_s            , { 18}, 0},
+	{m68k_op_rol_8_s             , { 18}, 0},
+	{m68k_op_asl_16_s            , { 18}, 0},
+	{m68k_op_lsl_16_s            , { 18}, 0},
+	{m68k_op_roxl_16_s           , { 18}, 0},
+	{m68k_op_rol_16_s            , { 18}, 0},
+	{m68k_op_asl_32_s            , { 20}, 0},
+	{m68k_op_lsl_32_s            , { 20}, 0},
+	{m68k_op_roxl_32_s           , { 20}, 0},
+	{m68k_op_rol_32_s            , { 20}, 0},
+	{m68k_op_asr_8_s             , { 20}, 0},
+	{m68k_op_lsr_8_s             , { 20}, 0},
+	{m68k_op_roxr_8_s            , { 20}, 0},
+	{m68k_op_ror_8_s             , { 20}, 0},
+	{m68k_op_asr_16_s            , { 20}, 0},
+	{m68k_op_lsr_16_s            , { 20}, 0},
+	{m68k_op_roxr_16_s           , { 20}, 0},
+	{m68k_op_ror_16_s            , { 20}, 0},
+	{m68k_op_asr_32_s            , { 22}, 0},
+	{m68k_op_lsr_32_s            , { 22}, 0},
+	{m68k_op_roxr_32_s           , { 22}, 0},
+	{m68k_op_ror_32_s            , { 22}, 0},
+	{m68k_op_asl_8_s             , { 20}, 0},
+	{m68k_op_lsl_8_s             , { 20}, 0},
+	{m68k_op_roxl_8_s            , { 20}, 0},
+	{m68k_op_rol_8_s             , { 20}, 0},
+	{m68k_op_asl_16_s            , { 20}, 0},
+	{m68k_op_lsl_16_s            , { 20}, 0},
+	{m68k_op_roxl_16_s           , { 20}, 0},
+	{m68k_op_rol_16_s            , { 20}, 0},
+	{m68k_op_asl_32_s            , { 22}, 0},
+	{m68k_op_lsl_32_s            , { 22}, 0},
+	{m68k_op_roxl_32_s           , { 22}, 0},
+	{m68k_op_rol_32_s            , { 22}, 0},
+	{m68k_op_1111                , {  0}, 0},
+	{m68k_op_1111                , {  4}, 0},
+};
+
+const unsigned short m68ki_opcode_index[0x10000] =
+{
+	   0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+	   2,    2,    2,    2,    2,    2,    2,    2,    3,    3,    3,    3,    3,    3,    3,    4,
+	   5,    5,    5,    5,    5,    5,    5,    6,    7,    7,    7,    7,    7,    7,    7,    7,
+	   8,    8,    8,    8,    8,    8,    8,    8,    9,   10,    1,    1,   11,    1,    1,    1,
+	  12,   12,   12,   12,   12,   12,   12,   12,    1,    1,    1,    1,    1,    1,    1,    1,
+	  13,   13,   13,   13,   13,   13,   13,   13,   14,   14,   14,   14,   14,   14,   14,   14,
+	  15,   15,   15,   15,   15,   15,   15,   15,   16,   16,   16,   16,   16,   16,   16,   16,
+	  17,   17,   17,   17,   17,   17,   17,   17,   18,   19,    1,    1,   20,    1,    1,    1,
+	  21,   21,   21,   21,   21,   21,   21,   21,    1,    1,    1,    1,    1,    1,    1,    1,
+	  22,   22,   22,   22,   22,   22,   22,   22,   23,   23,   23,   23,   23,   23,   23,   23,
+	  24,   24,   24,   24,   24,   24,   24,   24,   25,   25,   25,   25,   25,   25,   25,   25,
+	  26,   26,   26,   26,   26,   26,   26,   26,   27,   28,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	  29,   29,   29,   29,   29,   29,   29,   29,   30,   30,   30,   30,   30,   30,   30,   30,
+	  31,   31,   31,   31,   31,   31,   31,   31,   32,   32,   32,   32,   32,   32,   32,   33,
+	  34,   34,   34,   34,   34,   34,   34,   35,   36,   36,   36,   36,   36,   36,   36,   36,
+	  37,   37,   37,   37,   37,   37,   37,   37,   38,   39,   40,   41,   42,    1,    1,    1,
+	  43,   43,   43,   43,   43,   43,   43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+	  45,   45,   45,   45,   45,   45,   45,   45,   46,   46,   46,   46,   46,   46,   46,   47,
+	  48,   48,   48,   48,   48,   48,   48,   49,   50,   50,   50,   50,   50,   50,   50,   50,
+	  51,   51,   51,   51,   51,   51,   51,   51,   52,   53,    1,    1,    1,    1,    1,    1,
+	  54,   54,   54,   54,   54,   54,   54,   54,   55,   55,   55,   55,   55,   55,   55,   55,
+	  56,   56,   56,   56,   56,   56,   56,   56,   57,   57,   57,   57,   57,   57,   57,   58,
+	  59,   59,   59,   59,   59,   59,   59,   60,   61,   61,   61,   61,   61,   61,   61,   61,
+	  62,   62,   62,   62,   62,   62,   62,   62,   63,   64,    1,    1,    1,    1,    1,    1,
+	  65,   65,   65,   65,   65,   65,   65,   65,   66,   66,   66,   66,   66,   66,   66,   66,
+	  67,   67,   67,   67,   67,   67,   67,   67,   68,   68,   68,   68,   68,   68,   68,   69,
+	  70,   70,   70,   70,   70,   70,   70,   71,   72,   72,   72,   72,   72,   72,   72,   72,
+	  73,   73,   73,   73,   73,   73,   73,   73,   74,   75,    1,    1,    1,    1,    1,    1,
+	  76,   76,   76,   76,   76,   76,   76,   76,    1,    1,    1,    1,    1,    1,    1,    1,
+	  77,   77,   77,   77,   77,   77,   77,   77,   78,   78,   78,   78,   78,   78,   78,   79,
+	  80,   80,   80,   80,   80,   80,   80,   81,   82,   82,   82,   82,   82,   82,   82,   82,
+	  83,   83,   83,   83,   83,   83,   83,   83,   84,   85,    1,    1,   86,    1,    1,    1,
+	  87,   87,   87,   87,   87,   87,   87,   87,    1,    1,    1,    1,    1,    1,    1,    1,
+	  88,   88,   88,   88,   88,   88,   88,   88,   89,   89,   89,   89,   89,   89,   89,   89,
+	  90,   90,   90,   90,   90,   90,   90,   90,   91,   91,   91,   91,   91,   91,   91,   91,
+	  92,   92,   92,   92,   92,   92,   92,   92,   93,   94,    1,    1,   95,    1,    1,    1,
+	  96,   96,   96,   96,   96,   96,   96,   96,    1,    1,    1,    1,    1,    1,    1,    1,
+	  97,   97,   97,   97,   97,   97,   97,   97,   98,   98,   98,   98,   98,   98,   98,   98,
+	  99,   99,   99,   99,   99,   99,   99,   99,  100,  100,  100,  100,  100,  100,  100,  100,
+	 101,  101,  101,  101,  101,  101,  101,  101,  102,  103,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	  29,   29,   29,   29,   29,   29,   29,   29,   30,   30,   30,   30,   30,   30,   30,   30,
+	  31,   31,   31,   31,   31,   31,   31,   31,   32,   32,   32,   32,   32,   32,   32,   33,
+	  34,   34,   34,   34,   34,   34,   34,   35,   36,   36,   36,   36,   36,   36,   36,   36,
+	  37,   37,   37,   37,   37,   37,   37,   37,   38,   39,   40,   41,   42,    1,    1,    1,
+	  43,   43,   43,   43,   43,   43,   43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+	  45,   45,   45,   45,   45,   45,   45,   45,   46,   46,   46,   46,   46,   46,   46,   47,
+	  48,   48,   48,   48,   48,   48,   48,   49,   50,   50,   50,   50,   50,   50,   50,   50,
+	  51,   51,   51,   51,   51,   51,   51,   51,   52,   53,    1,    1,    1,    1,    1,    1,
+	  54,   54,   54,   54,   54,   54,   54,   54,   55,   55,   55,   55,   55,   55,   55,   55,
+	  56,   56,   56,   56,   56,   56,   56,   56,   57,   57,   57,   57,   57,   57,   57,   58,
+	  59,   59,   59,   59,   59,   59,   59,   60,   61,   61,   61,   61,   61,   61,   61,   61,
+	  62,   62,   62,   62,   62,   62,   62,   62,   63,   64,    1,    1,    1,    1,    1,    1,
+	  65,   65,   65,   65,   65,   65,   65,   65,   66,   66,   66,   66,   66,   66,   66,   66,
+	  67,   67,   67,   67,   67,   67,   67,   67,   68,   68,   68,   68,   68,   68,   68,   69,
+	  70,   70,   70,   70,   70,   70,   70,   71,   72,   72,   72,   72,   72,   72,   72,   72,
+	  73,   73,   73,   73,   73,   73,   73,   73,   74,   75,    1,    1,    1,    1,    1,    1,
+	 104,  104,  104,  104,  104,  104,  104,  104,    1,    1,    1,    1,    1,    1,    1,    1,
+	 105,  105,  105,  105,  105,  105,  105,  105,  106,  106,  106,  106,  106,  106,  106,  107,
+	 108,  108,  108,  108,  108,  108,  108,  109,  110,  110,  110,  110,  110,  110,  110,  110,
+	 111,  111,  111,  111,  111,  111,  111,  111,  112,  113,    1,    1,    1,    1,    1,    1,
+	 114,  114,  114,  114,  114,  114,  114,  114,    1,    1,    1,    1,    1,    1,    1,    1,
+	 115,  115,  115,  115,  115,  115,  115,  115,  116,  116,  116,  116,  116,  116,  116,  116,
+	 117,  117,  117,  117,  117,  117,  117,  117,  118,  118,  118,  118,  118,  118,  118,  118,
+	 119,  119,  119,  119,  119,  119,  119,  119,  120,  121,    1,    1,    1,    1,    1,    1,
+	 122,  122,  122,  122,  122,  122,  122,  122,    1,    1,    1,    1,    1,    1,    1,    1,
+	 123,  123,  123,  123,  123,  123,  123,  123,  124,  124,  124,  124,  124,  124,  124,  124,
+	 125,  125,  125,  125,  125,  125,  125,  125,  126,  126,  126,  126,  126,  126,  126,  126,
+	 127,  127,  127,  127,  127,  127,  127,  127,  128,  129,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	  29,   29,   29,   29,   29,   29,   29,   29,   30,   30,   30,   30,   30,   30,   30,   30,
+	  31,   31,   31,   31,   31,   31,   31,   31,   32,   32,   32,   32,   32,   32,   32,   33,
+	  34,   34,   34,   34,   34,   34,   34,   35,   36,   36,   36,   36,   36,   36,   36,   36,
+	  37,   37,   37,   37,   37,   37,   37,   37,   38,   39,   40,   41,   42,    1,    1,    1,
+	  43,   43,   43,   43,   43,   43,   43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+	  45,   45,   45,   45,   45,   45,   45,   45,   46,   46,   46,   46,   46,   46,   46,   47,
+	  48,   48,   48,   48,   48,   48,   48,   49,   50,   50,   50,   50,   50,   50,   50,   50,
+	  51,   51,   51,   51,   51,   51,   51,   51,   52,   53,    1,    1,    1,    1,    1,    1,
+	  54,   54,   54,   54,   54,   54,   54,   54,   55,   55,   55,   55,   55,   55,   55,   55,
+	  56,   56,   56,   56,   56,   56,   56,   56,   57,   57,   57,   57,   57,   57,   57,   58,
+	  59,   59,   59,   59,   59,   59,   59,   60,   61,   61,   61,   61,   61,   61,   61,   61,
+	  62,   62,   62,   62,   62,   62,   62,   62,   63,   64,    1,    1,    1,    1,    1,    1,
+	  65,   65,   65,   65,   65,   65,   65,   65,   66,   66,   66,   66,   66,   66,   66,   66,
+	  67,   67,   67,   67,   67,   67,   67,   67,   68,   68,   68,   68,   68,   68,   68,   69,
+	  70,   70,   70,   70,   70,   70,   70,   71,   72,   72,   72,   72,   72,   72,   72,   72,
+	  73,   73,   73,   73,   73,   73,   73,   73,   74,   75,    1,    1,    1,    1,    1,    1,
+	 130,  130,  130,  130,  130,  130,  130,  130,    1,    1,    1,    1,    1,    1,    1,    1,
+	 131,  131,  131,  131,  131,  131,  131,  131,  132,  132,  132,  132,  132,  132,  132,  133,
+	 134,  134,  134,  134,  134,  134,  134,  135,  136,  136,  136,  136,  136,  136,  136,  136,
+	 137,  137,  137,  137,  137,  137,  137,  137,  138,  139,    1,    1,    1,    1,    1,    1,
+	 140,  140,  140,  140,  140,  140,  140,  140,    1,    1,    1,    1,    1,    1,    1,    1,
+	 141,  141,  141,  141,  141,  141,  141,  141,  142,  142,  142,  142,  142,  142,  142,  142,
+	 143,  143,  143,  143,  143,  143,  143,  143,  144,  144,  144,  144,  144,  144,  144,  144,
+	 145,  145,  145,  145,  145,  145,  145,  145,  146,  147,    1,    1,    1,    1,    1,    1,
+	 148,  148,  148,  148,  148,  148,  148,  148,    1,    1,    1,    1,    1,    1,    1,    1,
+	 149,  149,  149,  149,  149,  149,  149,  149,  150,  150,  150,  150,  150,  150,  150,  150,
+	 151,  151,  151,  151,  151,  151,  151,  151,  152,  152,  152,  152,  152,  152,  152,  152,
+	 153,  153,  153,  153,  153,  153,  153,  153,  154,  155,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	  29,   29,   29,   29,   29,   29,   29,   29,   30,   30,   30,   30,   30,   30,   30,   30,
+	  31,   31,   31,   31,   31,   31,   31,   31,   32,   32,   32,   32,   32,   32,   32,   33,
+	  34,   34,   34,   34,   34,   34,   34,   35,   36,   36,   36,   36,   36,   36,   36,   36,
+	  37,   37,   37,   37,   37,   37,   37,   37,   38,   39,   40,   41,   42,    1,    1,    1,
+	  43,   43,   43,   43,   43,   43,   43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+	  45,   45,   45,   45,   45,   45,   45,   45,   46,   46,   46,   46,   46,   46,   46,   47,
+	  48,   48,   48,   48,   48,   48,   48,   49,   50,   50,   50,   50,   50,   50,   50,   50,
+	  51,   51,   51,   51,   51,   51,   51,   51,   52,   53,    1,    1,    1,    1,    1,    1,
+	  54,   54,   54,   54,   54,   54,   54,   54,   55,   55,   55,   55,   55,   55,   55,   55,
+	  56,   56,   56,   56,   56,   56,   56,   56,   57,   57,   57,   57,   57,   57,   57,   58,
+	  59,   59,   59,   59,   59,   59,   59,   60,   61,   61,   61,   61,   61,   61,   61,   61,
+	  62,   62,   62,   62,   62,   62,   62,   62,   63,   64,    1,    1,    1,    1,    1,    1,
+	  65,   65,   65,   65,   65,   65,   65,   65,   66,   66,   66,   66,   66,   66,   66,   66,
+	  67,   67,   67,   67,   67,   67,   67,   67,   68,   68,   68,   68,   68,   68,   68,   69,
+	  70,   70,   70,   70,   70,   70,   70,   71,   72,   72,   72,   72,   72,   72,   72,   72,
+	  73,   73,   73,   73,   73,   73,   73,   73,   74,   75,    1,    1,    1,    1,    1,    1,
+	 156,  156,  156,  156,  156,  156,  156,  156,    1,    1,    1,    1,    1,    1,    1,    1,
+	 157,  157,  157,  157,  157,  157,  157,  157,  158,  158,  158,  158,  158,  158,  158,  159,
+	 160,  160,  160,  160,  160,  160,  160,  161,  162,  162,  162,  162,  162,  162,  162,  162,
+	 163,  163,  163,  163,  163,  163,  163,  163,  164,  165,  166,  167,    1,    1,    1,    1,
+	 168,  168,  168,  168,  168,  168,  168,  168,    1,    1,    1,    1,    1,    1,    1,    1,
+	 169,  169,  169,  169,  169,  169,  169,  169,  170,  170,  170,  170,  170,  170,  170,  171,
+	 172,  172,  172,  172,  172,  172,  172,  173,  174,  174,  174,  174,  174,  174,  174,  174,
+	 175,  175,  175,  175,  175,  175,  175,  175,  176,  177,    1,    1,    1,    1,    1,    1,
+	 178,  178,  178,  178,  178,  178,  178,  178,    1,    1,    1,    1,    1,    1,    1,    1,
+	 179,  179,  179,  179,  179,  179,  179,  179,  180,  180,  180,  180,  180,  180,  180,  181,
+	 182,  182,  182,  182,  182,  182,  182,  183,  184,  184,  184,  184,  184,  184,  184,  184,
+	 185,  185,  185,  185,  185,  185,  185,  185,  186,  187,    1,    1,    1,    1,    1,    1,
+	 188,  188,  188,  188,  188,  188,  188,  188,    1,    1,    1,    1,    1,    1,    1,    1,
+	 189,  189,  189,  189,  189,  189,  189,  189,  190,  190,  190,  190,  190,  190,  190,  191,
+	 192,  192,  192,  192,  192,  192,  192,  193,  194,  194,  194,  194,  194,  194,  194,  194,
+	 195,  195,  195,  195,  195,  195,  195,  195,  196,  197,    1,    1,    1,    1,    1,    1,
+	  29,   29,   29,   29,   29,   29,   29,   29,   30,   30,   30,   30,   30,   30,   30,   30,
+	  31,   31,   31,   31,   31,   31,   31,   31,   32,   32,   32,   32,   32,   32,   32,   33,
+	  34,   34,   34,   34,   34,   34,   34,   35,   36,   36,   36,   36,   36,   36,   36,   36,
+	  37,   37,   37,   37,   37,   37,   37,   37,   38,   39,   40,   41,   42,    1,    1,    1,
+	  43,   43,   43,   43,   43,   43,   43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+	  45,   45,   45,   45,   45,   45,   45,   45,   46,   46,   46,   46,   46,   46,   46,   47,
+	  48,   48,   48,   48,   48,   48,   48,   49,   50,   50,   50,   50,   50,   50,   50,   50,
+	  51,   51,   51,   51,   51,   51,   51,   51,   52,   53,    1,    1,    1,    1,    1,    1,
+	  54,   54,   54,   54,   54,   54,   54,   54,   55,   55,   55,   55,   55,   55,   55,   55,
+	  56,   56,   56,   56,   56,   56,   56,   56,   57,   57,   57,   57,   57,   57,   57,   58,
+	  59,   59,   59,   59,   59,   59,   59,   60,   61,   61,   61,   61,   61,   61,   61,   61,
+	  62,   62,   62,   62,   62,   62,   62,   62,   63,   64,    1,    1,    1,    1,    1,    1,
+	  65,   65,   65,   65,   65,   65,   65,   65,   66,   66,   66,   66,   66,   66,   66,   66,
+	  67,   67,   67,   67,   67,   67,   67,   67,   68,   68,   68,   68,   68,   68,   68,   69,
+	  70,   70,   70,   70,   70,   70,   70,   71,   72,   72,   72,   72,   72,   72,   72,   72,
+	  73,   73,   73,   73,   73,   73,   73,   73,   74,   75,    1,    1,    1,    1,    1,    1,
+	 198,  198,  198,  198,  198,  198,  198,  198,    1,    1,    1,    1,    1,    1,    1,    1,
+	 199,  199,  199,  199,  199,  199,  199,  199,  200,  200,  200,  200,  200,  200,  200,  201,
+	 202,  202,  202,  202,  202,  202,  202,  203,  204,  204,  204,  204,  204,  204,  204,  204,
+	 205,  205,  205,  205,  205,  205,  205,  205,  206,  207,    1,    1,  208,    1,    1,    1,
+	 209,  209,  209,  209,  209,  209,  209,  209,    1,    1,    1,    1,    1,    1,    1,    1,
+	 210,  210,  210,  210,  210,  210,  210,  210,  211,  211,  211,  211,  211,  211,  211,  211,
+	 212,  212,  212,  212,  212,  212,  212,  212,  213,  213,  213,  213,  213,  213,  213,  213,
+	 214,  214,  214,  214,  214,  214,  214,  214,  215,  216,    1,    1,  217,    1,    1,    1,
+	 218,  218,  218,  218,  218,  218,  218,  218,    1,    1,    1,    1,    1,    1,    1,    1,
+	 219,  219,  219,  219,  219,  219,  219,  219,  220,  220,  220,  220,  220,  220,  220,  220,
+	 221,  221,  221,  221,  221,  221,  221,  221,  222,  222,  222,  222,  222,  222,  222,  222,
+	 223,  223,  223,  223,  223,  223,  223,  223,  224,  225,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	  29,   29,   29,   29,   29,   29,   29,   29,   30,   30,   30,   30,   30,   30,   30,   30,
+	  31,   31,   31,   31,   31,   31,   31,   31,   32,   32,   32,   32,   32,   32,   32,   33,
+	  34,   34,   34,   34,   34,   34,   34,   35,   36,   36,   36,   36,   36,   36,   36,   36,
+	  37,   37,   37,   37,   37,   37,   37,   37,   38,   39,   40,   41,   42,    1,    1,    1,
+	  43,   43,   43,   43,   43,   43,   43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+	  45,   45,   45,   45,   45,   45,   45,   45,   46,   46,   46,   46,   46,   46,   46,   47,
+	  48,   48,   48,   48,   48,   48,   48,   49,   50,   50,   50,   50,   50,   50,   50,   50,
+	  51,   51,   51,   51,   51,   51,   51,   51,   52,   53,    1,    1,    1,    1,    1,    1,
+	  54,   54,   54,   54,   54,   54,   54,   54,   55,   55,   55,   55,   55,   55,   55,   55,
+	  56,   56,   56,   56,   56,   56,   56,   56,   57,   57,   57,   57,   57,   57,   57,   58,
+	  59,   59,   59,   59,   59,   59,   59,   60,   61,   61,   61,   61,   61,   61,   61,   61,
+	  62,   62,   62,   62,   62,   62,   62,   62,   63,   64,    1,    1,    1,    1,    1,    1,
+	  65,   65,   65,   65,   65,   65,   65,   65,   66,   66,   66,   66,   66,   66,   66,   66,
+	  67,   67,   67,   67,   67,   67,   67,   67,   68,   68,   68,   68,   68,   68,   68,   69,
+	  70,   70,   70,   70,   70,   70,   70,   71,   72,   72,   72,   72,   72,   72,   72,   72,
+	  73,   73,   73,   73,   73,   73,   73,   73,   74,   75,    1,    1,    1,    1,    1,    1,
+	 226,  226,  226,  226,  226,  226,  226,  226,    1,    1,    1,    1,    1,    1,    1,    1,
+	 227,  227,  227,  227,  227,  227,  227,  227,  228,  228,  228,  228,  228,  228,  228,  229,
+	 230,  230,  230,  230,  230,  230,  230,  231,  232,  232,  232,  232,  232,  232,  232,  232,
+	 233,  233,  233,  233,  233,  233,  233,  233,  234,  235,    1,    1,    1,    1,    1,    1,
+	 236,  236,  236,  236,  236,  236,  236,  236,    1,    1,    1,    1,    1,    1,    1,    1,
+	 237,  237,  237,  237,  237,  237,  237,  237,  238,  238,  238,  238,  238,  238,  238,  238,
+	 239,  239,  239,  239,  239,  239,  239,  239,  240,  240,  240,  240,  240,  240,  240,  240,
+	 241,  241,  241,  241,  241,  241,  241,  241,  242,  243,    1,    1,    1,    1,    1,    1,
+	 244,  244,  244,  244,  244,  244,  244,  244,    1,    1,    1,    1,    1,    1,    1,    1,
+	 245,  245,  245,  245,  245,  245,  245,  245,  246,  246,  246,  246,  246,  246,  246,  246,
+	 247,  247,  247,  247,  247,  247,  247,  247,  248,  248,  248,  248,  248,  248,  248,  248,
+	 249,  249,  249,  249,  249,  249,  249,  249,  250,  251,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	  29,   29,   29,   29,   29,   29,   29,   29,   30,   30,   30,   30,   30,   30,   30,   30,
+	  31,   31,   31,   31,   31,   31,   31,   31,   32,   32,   32,   32,   32,   32,   32,   33,
+	  34,   34,   34,   34,   34,   34,   34,   35,   36,   36,   36,   36,   36,   36,   36,   36,
+	  37,   37,   37,   37,   37,   37,   37,   37,   38,   39,   40,   41,   42,    1,    1,    1,
+	  43,   43,   43,   43,   43,   43,   43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+	  45,   45,   45,   45,   45,   45,   45,   45,   46,   46,   46,   46,   46,   46,   46,   47,
+	  48,   48,   48,   48,   48,   48,   48,   49,   50,   50,   50,   50,   50,   50,   50,   50,
+	  51,   51,   51,   51,   51,   51,   51,   51,   52,   53,    1,    1,    1,    1,    1,    1,
+	  54,   54,   54,   54,   54,   54,   54,   54,   55,   55,   55,   55,   55,   55,   55,   55,
+	  56,   56,   56,   56,   56,   56,   56,   56,   57,   57,   57,   57,   57,   57,   57,   58,
+	  59,   59,   59,   59,   59,   59,   59,   60,   61,   61,   61,   61,   61,   61,   61,   61,
+	  62,   62,   62,   62,   62,   62,   62,   62,   63,   64,    1,    1,    1,    1,    1,    1,
+	  65,   65,   65,   65,   65,   65,   65,   65,   66,   66,   66,   66,   66,   66,   66,   66,
+	  67,   67,   67,   67,   67,   67,   67,   67,   68,   68,   68,   68,   68,   68,   68,   69,
+	  70,   70,   70,   70,   70,   70,   70,   71,   72,   72,   72,   72,   72,   72,   72,   72,
+	  73,   73,   73,   73,   73,   73,   73,   73,   74,   75,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	  29,   29,   29,   29,   29,   29,   29,   29,   30,   30,   30,   30,   30,   30,   30,   30,
+	  31,   31,   31,   31,   31,   31,   31,   31,   32,   32,   32,   32,   32,   32,   32,   33,
+	  34,   34,   34,   34,   34,   34,   34,   35,   36,   36,   36,   36,   36,   36,   36,   36,
+	  37,   37,   37,   37,   37,   37,   37,   37,   38,   39,   40,   41,   42,    1,    1,    1,
+	  43,   43,   43,   43,   43,   43,   43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+	  45,   45,   45,   45,   45,   45,   45,   45,   46,   46,   46,   46,   46,   46,   46,   47,
+	  48,   48,   48,   48,   48,   48,   48,   49,   50,   50,   50,   50,   50,   50,   50,   50,
+	  51,   51,   51,   51,   51,   51,   51,   51,   52,   53,    1,    1,    1,    1,    1,    1,
+	  54,   54,   54,   54,   54,   54,   54,   54,   55,   55,   55,   55,   55,   55,   55,   55,
+	  56,   56,   56,   56,   56,   56,   56,   56,   57,   57,   57,   57,   57,   57,   57,   58,
+	  59,   59,   59,   59,   59,   59,   59,   60,   61,   61,   61,   61,   61,   61,   61,   61,
+	  62,   62,   62,   62,   62,   62,   62,   62,   63,   64,    1,    1,    1,    1,    1,    1,
+	  65,   65,   65,   65,   65,   65,   65,   65,   66,   66,   66,   66,   66,   66,   66,   66,
+	  67,   67,   67,   67,   67,   67,   67,   67,   68,   68,   68,   68,   68,   68,   68,   69,
+	  70,   70,   70,   70,   70,   70,   70,   71,   72,   72,   72,   72,   72,   72,   72,   72,
+	  73,   73,   73,   73,   73,   73,   73,   73,   74,   75,    1,    1,    1,    1,    1,    1,
+	 252,  252,  252,  252,  252,  252,  252,  252,    1,    1,    1,    1,    1,    1,    1,    1,
+	 253,  253,  253,  253,  253,  253,  253,  253,  254,  254,  254,  254,  254,  254,  254,  255,
+	 256,  256,  256,  256,  256,  256,  256,  257,  258,  258,  258,  258,  258,  258,  258,  258,
+	 259,  259,  259,  259,  259,  259,  259,  259,  260,  261,  262,  263,  264,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 265,  265,  265,  265,  265,  265,  265,  265,    1,    1,    1,    1,    1,    1,    1,    1,
+	 266,  266,  266,  266,  266,  266,  266,  266,  267,  267,  267,  267,  267,  267,  267,  268,
+	 269,  269,  269,  269,  269,  269,  269,  270,  271,  271,  271,  271,  271,  271,  271,  271,
+	 272,  272,  272,  272,  272,  272,  272,  272,  273,  274,  275,  276,  277,    1,    1,    1,
+	 278,  278,  278,  278,  278,  278,  278,  278,    1,    1,    1,    1,    1,    1,    1,    1,
+	 279,  279,  279,  279,  279,  279,  279,  279,  280,  280,  280,  280,  280,  280,  280,  281,
+	 282,  282,  282,  282,  282,  282,  282,  283,  284,  284,  284,  284,  284,  284,  284,  284,
+	 285,  285,  285,  285,  285,  285,  285,  285,  286,  287,  288,  289,  290,    1,    1,    1,
+	 291,  291,  291,  291,  291,  291,  291,  291,    1,    1,    1,    1,    1,    1,    1,    1,
+	 292,  292,  292,  292,  292,  292,  292,  292,  293,  293,  293,  293,  293,  293,  293,  294,
+	 295,  295,  295,  295,  295,  295,  295,  296,  297,  297,  297,  297,  297,  297,  297,  297,
+	 298,  298,  298,  298,  298,  298,  298,  298,  299,  300,  301,  302,  303,    1,    1,    1,
+	 304,  304,  304,  304,  304,  304,  304,  304,    1,    1,    1,    1,    1,    1,    1,    1,
+	 305,  305,  305,  305,  305,  305,  305,  305,  306,  306,  306,  306,  306,  306,  306,  307,
+	 308,  308,  308,  308,  308,  308,  308,  309,  310,  310,  310,  310,  310,  310,  310,  310,
+	 311,  311,  311,  311,  311,  311,  311,  311,  312,  313,  314,  315,  316,    1,    1,    1,
+	 317,  317,  317,  317,  317,  317,  317,  317,    1,    1,    1,    1,    1,    1,    1,    1,
+	 318,  318,  318,  318,  318,  318,  318,  318,  319,  319,  319,  319,  319,  319,  319,  320,
+	 321,  321,  321,  321,  321,  321,  321,  322,  323,  323,  323,  323,  323,  323,  323,  323,
+	 324,  324,  324,  324,  324,  324,  324,  324,  325,  326,  327,  328,  329,    1,    1,    1,
+	 330,  330,  330,  330,  330,  330,  330,  330,    1,    1,    1,    1,    1,    1,    1,    1,
+	 331,  331,  331,  331,  331,  331,  331,  331,  332,  332,  332,  332,  332,  332,  332,  333,
+	 334,  334,  334,  334,  334,  334,  334,  335,  336,  336,  336,  336,  336,  336,  336,  336,
+	 337,  337,  337,  337,  337,  337,  337,  337,  338,  339,  340,  341,  342,    1,    1,    1,
+	 252,  252,  252,  252,  252,  252,  252,  252,    1,    1,    1,    1,    1,    1,    1,    1,
+	 253,  253,  253,  253,  253,  253,  253,  253,  254,  254,  254,  254,  254,  254,  254,  255,
+	 256,  256,  256,  256,  256,  256,  256,  257,  258,  258,  258,  258,  258,  258,  258,  258,
+	 259,  259,  259,  259,  259,  259,  259,  259,  260,  261,  262,  263,  264,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 265,  265,  265,  265,  265,  265,  265,  265,    1,    1,    1,    1,    1,    1,    1,    1,
+	 266,  266,  266,  266,  266,  266,  266,  266,  267,  267,  267,  267,  267,  267,  267,  268,
+	 269,  269,  269,  269,  269,  269,  269,  270,  271,  271,  271,  271,  271,  271,  271,  271,
+	 272,  272,  272,  272,  272,  272,  272,  272,  273,  274,  275,  276,  277,    1,    1,    1,
+	 278,  278,  278,  278,  278,  278,  278,  278,    1,    1,    1,    1,    1,    1,    1,    1,
+	 279,  279,  279,  279,  279,  279,  279,  279,  280,  280,  280,  280,  280,  280,  280,  281,
+	 282,  282,  282,  282,  282,  282,  282,  283,  284,  284,  284,  284,  284,  284,  284,  284,
+	 285,  285,  285,  285,  285,  285,  285,  285,  286,  287,  288,  289,  290,    1,    1,    1,
+	 291,  291,  291,  291,  291,  291,  291,  291,    1,    1,    1,    1,    1,    1,    1,    1,
+	 292,  292,  292,  292,  292,  292,  292,  292,  293,  293,  293,  293,  293,  293,  293,  294,
+	 295,  295,  295,  295,  295,  295,  295,  296,  297,  297,  297,  297,  297,  297,  297,  297,
+	 298,  298,  298,  298,  298,  298,  298,  298,  299,  300,  301,  302,  303,    1,    1,    1,
+	 304,  304,  304,  304,  304,  304,  304,  304,    1,    1,    1,    1,    1,    1,    1,    1,
+	 305,  305,  305,  305,  305,  305,  305,  305,  306,  306,  306,  306,  306,  306,  306,  307,
+	 308,  308,  308,  308,  308,  308,  308,  309,  310,  310,  310,  310,  310,  310,  310,  310,
+	 311,  311,  311,  311,  311,  311,  311,  311,  312,  313,  314,  315,  316,    1,    1,    1,
+	 317,  317,  317,  317,  317,  317,  317,  317,    1,    1,    1,    1,    1,    1,    1,    1,
+	 318,  318,  318,  318,  318,  318,  318,  318,  319,  319,  319,  319,  319,  319,  319,  320,
+	 321,  321,  321,  321,  321,  321,  321,  322,  323,  323,  323,  323,  323,  323,  323,  323,
+	 324,  324,  324,  324,  324,  324,  324,  324,  325,  326,  327,  328,  329,    1,    1,    1,
+	 343,  343,  343,  343,  343,  343,  343,  343,    1,    1,    1,    1,    1,    1,    1,    1,
+	 344,  344,  344,  344,  344,  344,  344,  344,  345,  345,  345,  345,  345,  345,  345,  346,
+	 347,  347,  347,  347,  347,  347,  347,  348,  349,  349,  349,  349,  349,  349,  349,  349,
+	 350,  350,  350,  350,  350,  350,  350,  350,  351,  352,  353,  354,  355,    1,    1,    1,
+	 252,  252,  252,  252,  252,  252,  252,  252,    1,    1,    1,    1,    1,    1,    1,    1,
+	 253,  253,  253,  253,  253,  253,  253,  253,  254,  254,  254,  254,  254,  254,  254,  255,
+	 256,  256,  256,  256,  256,  256,  256,  257,  258,  258,  258,  258,  258,  258,  258,  258,
+	 259,  259,  259,  259,  259,  259,  259,  259,  260,  261,  262,  263,  264,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 265,  265,  265,  265,  265,  265,  265,  265,    1,    1,    1,    1,    1,    1,    1,    1,
+	 266,  266,  266,  266,  266,  266,  266,  266,  267,  267,  267,  267,  267,  267,  267,  268,
+	 269,  269,  269,  269,  269,  269,  269,  270,  271,  271,  271,  271,  271,  271,  271,  271,
+	 272,  272,  272,  272,  272,  272,  272,  272,  273,  274,  275,  276,  277,    1,    1,    1,
+	 278,  278,  278,  278,  278,  278,  278,  278,    1,    1,    1,    1,    1,    1,    1,    1,
+	 279,  279,  279,  279,  279,  279,  279,  279,  280,  280,  280,  280,  280,  280,  280,  281,
+	 282,  282,  282,  282,  282,  282,  282,  283,  284,  284,  284,  284,  284,  284,  284,  284,
+	 285,  285,  285,  285,  285,  285,  285,  285,  286,  287,  288,  289,  290,    1,    1,    1,
+	 291,  291,  291,  291,  291,  291,  291,  291,    1,    1,    1,    1,    1,    1,    1,    1,
+	 292,  292,  292,  292,  292,  292,  292,  292,  293,  293,  293,  293,  293,  293,  293,  294,
+	 295,  295,  295,  295,  295,  295,  295,  296,  297,  297,  297,  297,  297,  297,  297,  297,
+	 298,  298,  298,  298,  298,  298,  298,  298,  299,  300,  301,  302,  303,    1,    1,    1,
+	 304,  304,  304,  304,  304,  304,  304,  304,    1,    1,    1,    1,    1,    1,    1,    1,
+	 305,  305,  305,  305,  305,  305,  305,  305,  306,  306,  306,  306,  306,  306,  306,  307,
+	 308,  308,  308,  308,  308,  308,  308,  309,  310,  310,  310,  310,  310,  310,  310,  310,
+	 311,  311,  311,  311,  311,  311,  311,  311,  312,  313,  314,  315,  316,    1,    1,    1,
+	 317,  317,  317,  317,  317,  317,  317,  317,    1,    1,    1,    1,    1,    1,    1,    1,
+	 318,  318,  318,  318,  318,  318,  318,  318,  319,  319,  319,  319,  319,  319,  319,  320,
+	 321,  321,  321,  321,  321,  321,  321,  322,  323,  323,  323,  323,  323,  323,  323,  323,
+	 324,  324,  324,  324,  324,  324,  324,  324,  325,  326,  327,  328,  329,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 252,  252,  252,  252,  252,  252,  252,  252,    1,    1,    1,    1,    1,    1,    1,    1,
+	 253,  253,  253,  253,  253,  253,  253,  253,  254,  254,  254,  254,  254,  254,  254,  255,
+	 256,  256,  256,  256,  256,  256,  256,  257,  258,  258,  258,  258,  258,  258,  258,  258,
+	 259,  259,  259,  259,  259,  259,  259,  259,  260,  261,  262,  263,  264,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 265,  265,  265,  265,  265,  265,  265,  265,    1,    1,    1,    1,    1,    1,    1,    1,
+	 266,  266,  266,  266,  266,  266,  266,  266,  267,  267,  267,  267,  267,  267,  267,  268,
+	 269,  269,  269,  269,  269,  269,  269,  270,  271,  271,  271,  271,  271,  271,  271,  271,
+	 272,  272,  272,  272,  272,  272,  272,  272,  273,  274,  275,  276,  277,    1,    1,    1,
+	 278,  278,  278,  278,  278,  278,  278,  278,    1,    1,    1,    1,    1,    1,    1,    1,
+	 279,  279,  279,  279,  279,  279,  279,  279,  280,  280,  280,  280,  280,  280,  280,  281,
+	 282,  282,  282,  282,  282,  282,  282,  283,  284,  284,  284,  284,  284,  284,  284,  284,
+	 285,  285,  285,  285,  285,  285,  285,  285,  286,  287,  288,  289,  290,    1,    1,    1,
+	 291,  291,  291,  291,  291,  291,  291,  291,    1,    1,    1,    1,    1,    1,    1,    1,
+	 292,  292,  292,  292,  292,  292,  292,  292,  293,  293,  293,  293,  293,  293,  293,  294,
+	 295,  295,  295,  295,  295,  295,  295,  296,  297,  297,  297,  297,  297,  297,  297,  297,
+	 298,  298,  298,  298,  298,  298,  298,  298,  299,  300,  301,  302,  303,    1,    1,    1,
+	 304,  304,  304,  304,  304,  304,  304,  304,    1,    1,    1,    1,    1,    1,    1,    1,
+	 305,  305,  305,  305,  305,  305,  305,  305,  306,  306,  306,  306,  306,  306,  306,  307,
+	 308,  308,  308,  308,  308,  308,  308,  309,  310,  310,  310,  310,  310,  310,  310,  310,
+	 311,  311,  311,  311,  311,  311,  311,  311,  312,  313,  314,  315,  316,    1,    1,    1,
+	 317,  317,  317,  317,  317,  317,  317,  317,    1,    1,    1,    1,    1,    1,    1,    1,
+	 318,  318,  318,  318,  318,  318,  318,  318,  319,  319,  319,  319,  319,  319,  319,  320,
+	 321,  321,  321,  321,  321,  321,  321,  322,  323,  323,  323,  323,  323,  323,  323,  323,
+	 324,  324,  324,  324,  324,  324,  324,  324,  325,  326,  327,  328,  329,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 252,  252,  252,  252,  252,  252,  252,  252,    1,    1,    1,    1,    1,    1,    1,    1,
+	 253,  253,  253,  253,  253,  253,  253,  253,  254,  254,  254,  254,  254,  254,  254,  255,
+	 256,  256,  256,  256,  256,  256,  256,  257,  258,  258,  258,  258,  258,  258,  258,  258,
+	 259,  259,  259,  259,  259,  259,  259,  259,  260,  261,  262,  263,  264,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 265,  265,  265,  265,  265,  265,  265,  265,    1,    1,    1,    1,    1,    1,    1,    1,
+	 266,  266,  266,  266,  266,  266,  266,  266,  267,  267,  267,  267,  267,  267,  267,  268,
+	 269,  269,  269,  269,  269,  269,  269,  270,  271,  271,  271,  271,  271,  271,  271,  271,
+	 272,  272,  272,  272,  272,  272,  272,  272,  273,  274,  275,  276,  277,    1,    1,    1,
+	 278,  278,  278,  278,  278,  278,  278,  278,    1,    1,    1,    1,    1,    1,    1,    1,
+	 279,  279,  279,  279,  279,  279,  279,  279,  280,  280,  280,  280,  280,  280,  280,  281,
+	 282,  282,  282,  282,  282,  282,  282,  283,  284,  284,  284,  284,  284,  284,  284,  284,
+	 285,  285,  285,  285,  285,  285,  285,  285,  286,  287,  288,  289,  290,    1,    1,    1,
+	 291,  291,  291,  291,  291,  291,  291,  291,    1,    1,    1,    1,    1,    1,    1,    1,
+	 292,  292,  292,  292,  292,  292,  292,  292,  293,  293,  293,  293,  293,  293,  293,  294,
+	 295,  295,  295,  295,  295,  295,  295,  296,  297,  297,  297,  297,  297,  297,  297,  297,
+	 298,  298,  298,  298,  298,  298,  298,  298,  299,  300,  301,  302,  303,    1,    1,    1,
+	 304,  304,  304,  304,  304,  304,  304,  304,    1,    1,    1,    1,    1,    1,    1,    1,
+	 305,  305,  305,  305,  305,  305,  305,  305,  306,  306,  306,  306,  306,  306,  306,  307,
+	 308,  308,  308,  308,  308,  308,  308,  309,  310,  310,  310,  310,  310,  310,  310,  310,
+	 311,  311,  311,  311,  311,  311,  311,  311,  312,  313,  314,  315,  316,    1,    1,    1,
+	 317,  317,  317,  317,  317,  317,  317,  317,    1,    1,    1,    1,    1,    1,    1,    1,
+	 318,  318,  318,  318,  318,  318,  318,  318,  319,  319,  319,  319,  319,  319,  319,  320,
+	 321,  321,  321,  321,  321,  321,  321,  322,  323,  323,  323,  323,  323,  323,  323,  323,
+	 324,  324,  324,  324,  324,  324,  324,  324,  325,  326,  327,  328,  329,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 252,  252,  252,  252,  252,  252,  252,  252,    1,    1,    1,    1,    1,    1,    1,    1,
+	 253,  253,  253,  253,  253,  253,  253,  253,  254,  254,  254,  254,  254,  254,  254,  255,
+	 256,  256,  256,  256,  256,  256,  256,  257,  258,  258,  258,  258,  258,  258,  258,  258,
+	 259,  259,  259,  259,  259,  259,  259,  259,  260,  261,  262,  263,  264,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 265,  265,  265,  265,  265,  265,  265,  265,    1,    1,    1,    1,    1,    1,    1,    1,
+	 266,  266,  266,  266,  266,  266,  266,  266,  267,  267,  267,  267,  267,  267,  267,  268,
+	 269,  269,  269,  269,  269,  269,  269,  270,  271,  271,  271,  271,  271,  271,  271,  271,
+	 272,  272,  272,  272,  272,  272,  272,  272,  273,  274,  275,  276,  277,    1,    1,    1,
+	 278,  278,  278,  278,  278,  278,  278,  278,    1,    1,    1,    1,    1,    1,    1,    1,
+	 279,  279,  279,  279,  279,  279,  279,  279,  280,  280,  280,  280,  280,  280,  280,  281,
+	 282,  282,  282,  282,  282,  282,  282,  283,  284,  284,  284,  284,  284,  284,  284,  284,
+	 285,  285,  285,  285,  285,  285,  285,  285,  286,  287,  288,  289,  290,    1,    1,    1,
+	 291,  291,  291,  291,  291,  291,  291,  291,    1,    1,    1,    1,    1,    1,    1,    1,
+	 292,  292,  292,  292,  292,  292,  292,  292,  293,  293,  293,  293,  293,  293,  293,  294,
+	 295,  295,  295,  295,  295,  295,  295,  296,  297,  297,  297,  297,  297,  297,  297,  297,
+	 298,  298,  298,  298,  298,  298,  298,  298,  299,  300,  301,  302,  303,    1,    1,    1,
+	 304,  304,  304,  304,  304,  304,  304,  304,    1,    1,    1,    1,    1,    1,    1,    1,
+	 305,  305,  305,  305,  305,  305,  305,  305,  306,  306,  306,  306,  306,  306,  306,  307,
+	 308,  308,  308,  308,  308,  308,  308,  309,  310,  310,  310,  310,  310,  310,  310,  310,
+	 311,  311,  311,  311,  311,  311,  311,  311,  312,  313,  314,  315,  316,    1,    1,    1,
+	 317,  317,  317,  317,  317,  317,  317,  317,    1,    1,    1,    1,    1,    1,    1,    1,
+	 318,  318,  318,  318,  318,  318,  318,  318,  319,  319,  319,  319,  319,  319,  319,  320,
+	 321,  321,  321,  321,  321,  321,  321,  322,  323,  323,  323,  323,  323,  323,  323,  323,
+	 324,  324,  324,  324,  324,  324,  324,  324,  325,  326,  327,  328,  329,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 252,  252,  252,  252,  252,  252,  252,  252,    1,    1,    1,    1,    1,    1,    1,    1,
+	 253,  253,  253,  253,  253,  253,  253,  253,  254,  254,  254,  254,  254,  254,  254,  255,
+	 256,  256,  256,  256,  256,  256,  256,  257,  258,  258,  258,  258,  258,  258,  258,  258,
+	 259,  259,  259,  259,  259,  259,  259,  259,  260,  261,  262,  263,  264,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 265,  265,  265,  265,  265,  265,  265,  265,    1,    1,    1,    1,    1,    1,    1,    1,
+	 266,  266,  266,  266,  266,  266,  266,  266,  267,  267,  267,  267,  267,  267,  267,  268,
+	 269,  269,  269,  269,  269,  269,  269,  270,  271,  271,  271,  271,  271,  271,  271,  271,
+	 272,  272,  272,  272,  272,  272,  272,  272,  273,  274,  275,  276,  277,    1,    1,    1,
+	 278,  278,  278,  278,  278,  278,  278,  278,    1,    1,    1,    1,    1,    1,    1,    1,
+	 279,  279,  279,  279,  279,  279,  279,  279,  280,  280,  280,  280,  280,  280,  280,  281,
+	 282,  282,  282,  282,  282,  282,  282,  283,  284,  284,  284,  284,  284,  284,  284,  284,
+	 285,  285,  285,  285,  285,  285,  285,  285,  286,  287,  288,  289,  290,    1,    1,    1,
+	 291,  291,  291,  291,  291,  291,  291,  291,    1,    1,    1,    1,    1,    1,    1,    1,
+	 292,  292,  292,  292,  292,  292,  292,  292,  293,  293,  293,  293,  293,  293,  293,  294,
+	 295,  295,  295,  295,  295,  295,  295,  296,  297,  297,  297,  297,  297,  297,  297,  297,
+	 298,  298,  298,  298,  298,  298,  298,  298,  299,  300,  301,  302,  303,    1,    1,    1,
+	 304,  304,  304,  304,  304,  304,  304,  304,    1,    1,    1,    1,    1,    1,    1,    1,
+	 305,  305,  305,  305,  305,  305,  305,  305,  306,  306,  306,  306,  306,  306,  306,  307,
+	 308,  308,  308,  308,  308,  308,  308,  309,  310,  310,  310,  310,  310,  310,  310,  310,
+	 311,  311,  311,  311,  311,  311,  311,  311,  312,  313,  314,  315,  316,    1,    1,    1,
+	 317,  317,  317,  317,  317,  317,  317,  317,    1,    1,    1,    1,    1,    1,    1,    1,
+	 318,  318,  318,  318,  318,  318,  318,  318,  319,  319,  319,  319,  319,  319,  319,  320,
+	 321,  321,  321,  321,  321,  321,  321,  322,  323,  323,  323,  323,  323,  323,  323,  323,
+	 324,  324,  324,  324,  324,  324,  324,  324,  325,  326,  327,  328,  329,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 252,  252,  252,  252,  252,  252,  252,  252,    1,    1,    1,    1,    1,    1,    1,    1,
+	 253,  253,  253,  253,  253,  253,  253,  253,  254,  254,  254,  254,  254,  254,  254,  255,
+	 256,  256,  256,  256,  256,  256,  256,  257,  258,  258,  258,  258,  258,  258,  258,  258,
+	 259,  259,  259,  259,  259,  259,  259,  259,  260,  261,  262,  263,  264,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 265,  265,  265,  265,  265,  265,  265,  265,    1,    1,    1,    1,    1,    1,    1,    1,
+	 266,  266,  266,  266,  266,  266,  266,  266,  267,  267,  267,  267,  267,  267,  267,  268,
+	 269,  269,  269,  269,  269,  269,  269,  270,  271,  271,  271,  271,  271,  271,  271,  271,
+	 272,  272,  272,  272,  272,  272,  272,  272,  273,  274,  275,  276,  277,    1,    1,    1,
+	 356,  356,  356,  356,  356,  356,  356,  356,    1,    1,    1,    1,    1,    1,    1,    1,
+	 357,  357,  357,  357,  357,  357,  357,  357,  358,  358,  358,  358,  358,  358,  358,  359,
+	 360,  360,  360,  360,  360,  360,  360,  361,  362,  362,  362,  362,  362,  362,  362,  362,
+	 363,  363,  363,  363,  363,  363,  363,  363,  364,  365,  366,  367,  368,    1,    1,    1,
+	 369,  369,  369,  369,  369,  369,  369,  369,    1,    1,    1,    1,    1,    1,    1,    1,
+	 370,  370,  370,  370,  370,  370,  370,  370,  371,  371,  371,  371,  371,  371,  371,  372,
+	 373,  373,  373,  373,  373,  373,  373,  374,  375,  375,  375,  375,  375,  375,  375,  375,
+	 376,  376,  376,  376,  376,  376,  376,  376,  377,  378,  379,  380,  381,    1,    1,    1,
+	 304,  304,  304,  304,  304,  304,  304,  304,    1,    1,    1,    1,    1,    1,    1,    1,
+	 305,  305,  305,  305,  305,  305,  305,  305,  306,  306,  306,  306,  306,  306,  306,  307,
+	 308,  308,  308,  308,  308,  308,  308,  309,  310,  310,  310,  310,  310,  310,  310,  310,
+	 311,  311,  311,  311,  311,  311,  311,  311,  312,  313,  314,  315,  316,    1,    1,    1,
+	 317,  317,  317,  317,  317,  317,  317,  317,    1,    1,    1,    1,    1,    1,    1,    1,
+	 318,  318,  318,  318,  318,  318,  318,  318,  319,  319,  319,  319,  319,  319,  319,  320,
+	 321,  321,  321,  321,  321,  321,  321,  322,  323,  323,  323,  323,  323,  323,  323,  323,
+	 324,  324,  324,  324,  324,  324,  324,  324,  325,  326,  327,  328,  329,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 382,  382,  382,  382,  382,  382,  382,  382,  383,  383,  383,  383,  383,  383,  383,  383,
+	 384,  384,  384,  384,  384,  384,  384,  384,  385,  385,  385,  385,  385,  385,  385,  385,
+	 386,  386,  386,  386,  386,  386,  386,  386,  387,  387,  387,  387,  387,  387,  387,  387,
+	 388,  388,  388,  388,  388,  388,  388,  388,  389,  390,  391,  392,  393,    1,    1,    1,
+	 394,  394,  394,  394,  394,  394,  394,  394,  395,  395,  395,  395,  395,  395,  395,  395,
+	 396,  396,  396,  396,  396,  396,  396,  396,  397,  397,  397,  397,  397,  397,  397,  397,
+	 398,  398,  398,  398,  398,  398,  398,  398,  399,  399,  399,  399,  399,  399,  399,  399,
+	 400,  400,  400,  400,  400,  400,  400,  400,  401,  402,  403,  404,  405,    1,    1,    1,
+	 406,  406,  406,  406,  406,  406,  406,  406,  407,  407,  407,  407,  407,  407,  407,  407,
+	 408,  408,  408,  408,  408,  408,  408,  408,  409,  409,  409,  409,  409,  409,  409,  409,
+	 410,  410,  410,  410,  410,  410,  410,  410,  411,  411,  411,  411,  411,  411,  411,  411,
+	 412,  412,  412,  412,  412,  412,  412,  412,  413,  414,  415,  416,  417,    1,    1,    1,
+	 418,  418,  418,  418,  418,  418,  418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+	 420,  420,  420,  420,  420,  420,  420,  420,  421,  421,  421,  421,  421,  421,  421,  421,
+	 422,  422,  422,  422,  422,  422,  422,  422,  423,  423,  423,  423,  423,  423,  423,  423,
+	 424,  424,  424,  424,  424,  424,  424,  424,  425,  426,  427,  428,  429,    1,    1,    1,
+	 430,  430,  430,  430,  430,  430,  430,  430,  431,  431,  431,  431,  431,  431,  431,  431,
+	 432,  432,  432,  432,  432,  432,  432,  432,  433,  433,  433,  433,  433,  433,  433,  433,
+	 434,  434,  434,  434,  434,  434,  434,  434,  435,  435,  435,  435,  435,  435,  435,  435,
+	 436,  436,  436,  436,  436,  436,  436,  436,  437,  438,  439,  440,  441,    1,    1,    1,
+	 442,  442,  442,  442,  442,  442,  442,  442,  443,  443,  443,  443,  443,  443,  443,  443,
+	 444,  444,  444,  444,  444,  444,  444,  444,  445,  445,  445,  445,  445,  445,  445,  445,
+	 446,  446,  446,  446,  446,  446,  446,  446,  447,  447,  447,  447,  447,  447,  447,  447,
+	 448,  448,  448,  448,  448,  448,  448,  448,  449,  450,  451,  452,  453,    1,    1,    1,
+	 454,  454,  454,  454,  454,  454,  454,  454,  455,  455,  455,  455,  455,  455,  455,  455,
+	 456,  456,  456,  456,  456,  456,  456,  456,  457,  457,  457,  457,  457,  457,  457,  457,
+	 458,  458,  458,  458,  458,  458,  458,  458,  459,  459,  459,  459,  459,  459,  459,  459,
+	 460,  460,  460,  460,  460,  460,  460,  460,  461,  462,  463,  464,  465,    1,    1,    1,
+	 466,  466,  466,  466,  466,  466,  466,  466,  467,  467,  467,  467,  467,  467,  467,  467,
+	 468,  468,  468,  468,  468,  468,  468,  468,  469,  469,  469,  469,  469,  469,  469,  469,
+	 470,  470,  470,  470,  470,  470,  470,  470,  471,  471,  471,  471,  471,  471,  471,  471,
+	 472,  472,  472,  472,  472,  472,  472,  472,  473,  474,  475,  476,  477,    1,    1,    1,
+	 382,  382,  382,  382,  382,  382,  382,  382,  383,  383,  383,  383,  383,  383,  383,  383,
+	 384,  384,  384,  384,  384,  384,  384,  384,  385,  385,  385,  385,  385,  385,  385,  385,
+	 386,  386,  386,  386,  386,  386,  386,  386,  387,  387,  387,  387,  387,  387,  387,  387,
+	 388,  388,  388,  388,  388,  388,  388,  388,  389,  390,  391,  392,  393,    1,    1,    1,
+	 394,  394,  394,  394,  394,  394,  394,  394,  395,  395,  395,  395,  395,  395,  395,  395,
+	 396,  396,  396,  396,  396,  396,  396,  396,  397,  397,  397,  397,  397,  397,  397,  397,
+	 398,  398,  398,  398,  398,  398,  398,  398,  399,  399,  399,  399,  399,  399,  399,  399,
+	 400,  400,  400,  400,  400,  400,  400,  400,  401,  402,  403,  404,  405,    1,    1,    1,
+	 406,  406,  406,  406,  406,  406,  406,  406,  407,  407,  407,  407,  407,  407,  407,  407,
+	 408,  408,  408,  408,  408,  408,  408,  408,  409,  409,  409,  409,  409,  409,  409,  409,
+	 410,  410,  410,  410,  410,  410,  410,  410,  411,  411,  411,  411,  411,  411,  411,  411,
+	 412,  412,  412,  412,  412,  412,  412,  412,  413,  414,  415,  416,  417,    1,    1,    1,
+	 418,  418,  418,  418,  418,  418,  418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+	 420,  420,  420,  420,  420,  420,  420,  420,  421,  421,  421,  421,  421,  421,  421,  421,
+	 422,  422,  422,  422,  422,  422,  422,  422,  423,  423,  423,  423,  423,  423,  423,  423,
+	 424,  424,  424,  424,  424,  424,  424,  424,  425,  426,  427,  428,  429,    1,    1,    1,
+	 430,  430,  430,  430,  430,  430,  430,  430,  431,  431,  431,  431,  431,  431,  431,  431,
+	 432,  432,  432,  432,  432,  432,  432,  432,  433,  433,  433,  433,  433,  433,  433,  433,
+	 434,  434,  434,  434,  434,  434,  434,  434,  435,  435,  435,  435,  435,  435,  435,  435,
+	 436,  436,  436,  436,  436,  436,  436,  436,  437,  438,  439,  440,  441,    1,    1,    1,
+	 442,  442,  442,  442,  442,  442,  442,  442,  443,  443,  443,  443,  443,  443,  443,  443,
+	 444,  444,  444,  444,  444,  444,  444,  444,  445,  445,  445,  445,  445,  445,  445,  445,
+	 446,  446,  446,  446,  446,  446,  446,  446,  447,  447,  447,  447,  447,  447,  447,  447,
+	 448,  448,  448,  448,  448,  448,  448,  448,  449,  450,  451,  452,  453,    1,    1,    1,
+	 454,  454,  454,  454,  454,  454,  454,  454,  455,  455,  455,  455,  455,  455,  455,  455,
+	 456,  456,  456,  456,  456,  456,  456,  456,  457,  457,  457,  457,  457,  457,  457,  457,
+	 458,  458,  458,  458,  458,  458,  458,  458,  459,  459,  459,  459,  459,  459,  459,  459,
+	 460,  460,  460,  460,  460,  460,  460,  460,  461,  462,  463,  464,  465,    1,    1,    1,
+	 478,  478,  478,  478,  478,  478,  478,  478,  479,  479,  479,  479,  479,  479,  479,  479,
+	 480,  480,  480,  480,  480,  480,  480,  480,  481,  481,  481,  481,  481,  481,  481,  481,
+	 482,  482,  482,  482,  482,  482,  482,  482,  483,  483,  483,  483,  483,  483,  483,  483,
+	 484,  484,  484,  484,  484,  484,  484,  484,  485,  486,  487,  488,  489,    1,    1,    1,
+	 382,  382,  382,  382,  382,  382,  382,  382,  383,  383,  383,  383,  383,  383,  383,  383,
+	 384,  384,  384,  384,  384,  384,  384,  384,  385,  385,  385,  385,  385,  385,  385,  385,
+	 386,  386,  386,  386,  386,  386,  386,  386,  387,  387,  387,  387,  387,  387,  387,  387,
+	 388,  388,  388,  388,  388,  388,  388,  388,  389,  390,  391,  392,  393,    1,    1,    1,
+	 394,  394,  394,  394,  394,  394,  394,  394,  395,  395,  395,  395,  395,  395,  395,  395,
+	 396,  396,  396,  396,  396,  396,  396,  396,  397,  397,  397,  397,  397,  397,  397,  397,
+	 398,  398,  398,  398,  398,  398,  398,  398,  399,  399,  399,  399,  399,  399,  399,  399,
+	 400,  400,  400,  400,  400,  400,  400,  400,  401,  402,  403,  404,  405,    1,    1,    1,
+	 406,  406,  406,  406,  406,  406,  406,  406,  407,  407,  407,  407,  407,  407,  407,  407,
+	 408,  408,  408,  408,  408,  408,  408,  408,  409,  409,  409,  409,  409,  409,  409,  409,
+	 410,  410,  410,  410,  410,  410,  410,  410,  411,  411,  411,  411,  411,  411,  411,  411,
+	 412,  412,  412,  412,  412,  412,  412,  412,  413,  414,  415,  416,  417,    1,    1,    1,
+	 418,  418,  418,  418,  418,  418,  418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+	 420,  420,  420,  420,  420,  420,  420,  420,  421,  421,  421,  421,  421,  421,  421,  421,
+	 422,  422,  422,  422,  422,  422,  422,  422,  423,  423,  423,  423,  423,  423,  423,  423,
+	 424,  424,  424,  424,  424,  424,  424,  424,  425,  426,  427,  428,  429,    1,    1,    1,
+	 430,  430,  430,  430,  430,  430,  430,  430,  431,  431,  431,  431,  431,  431,  431,  431,
+	 432,  432,  432,  432,  432,  432,  432,  432,  433,  433,  433,  433,  433,  433,  433,  433,
+	 434,  434,  434,  434,  434,  434,  434,  434,  435,  435,  435,  435,  435,  435,  435,  435,
+	 436,  436,  436,  436,  436,  436,  436,  436,  437,  438,  439,  440,  441,    1,    1,    1,
+	 442,  442,  442,  442,  442,  442,  442,  442,  443,  443,  443,  443,  443,  443,  443,  443,
+	 444,  444,  444,  444,  444,  444,  444,  444,  445,  445,  445,  445,  445,  445,  445,  445,
+	 446,  446,  446,  446,  446,  446,  446,  446,  447,  447,  447,  447,  447,  447,  447,  447,
+	 448,  448,  448,  448,  448,  448,  448,  448,  449,  450,  451,  452,  453,    1,    1,    1,
+	 454,  454,  454,  454,  454,  454,  454,  454,  455,  455,  455,  455,  455,  455,  455,  455,
+	 456,  456,  456,  456,  456,  456,  456,  456,  457,  457,  457,  457,  457,  457,  457,  457,
+	 458,  458,  458,  458,  458,  458,  458,  458,  459,  459,  459,  459,  459,  459,  459,  459,
+	 460,  460,  460,  460,  460,  460,  460,  460,  461,  462,  463,  464,  465,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 382,  382,  382,  382,  382,  382,  382,  382,  383,  383,  383,  383,  383,  383,  383,  383,
+	 384,  384,  384,  384,  384,  384,  384,  384,  385,  385,  385,  385,  385,  385,  385,  385,
+	 386,  386,  386,  386,  386,  386,  386,  386,  387,  387,  387,  387,  387,  387,  387,  387,
+	 388,  388,  388,  388,  388,  388,  388,  388,  389,  390,  391,  392,  393,    1,    1,    1,
+	 394,  394,  394,  394,  394,  394,  394,  394,  395,  395,  395,  395,  395,  395,  395,  395,
+	 396,  396,  396,  396,  396,  396,  396,  396,  397,  397,  397,  397,  397,  397,  397,  397,
+	 398,  398,  398,  398,  398,  398,  398,  398,  399,  399,  399,  399,  399,  399,  399,  399,
+	 400,  400,  400,  400,  400,  400,  400,  400,  401,  402,  403,  404,  405,    1,    1,    1,
+	 406,  406,  406,  406,  406,  406,  406,  406,  407,  407,  407,  407,  407,  407,  407,  407,
+	 408,  408,  408,  408,  408,  408,  408,  408,  409,  409,  409,  409,  409,  409,  409,  409,
+	 410,  410,  410,  410,  410,  410,  410,  410,  411,  411,  411,  411,  411,  411,  411,  411,
+	 412,  412,  412,  412,  412,  412,  412,  412,  413,  414,  415,  416,  417,    1,    1,    1,
+	 418,  418,  418,  418,  418,  418,  418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+	 420,  420,  420,  420,  420,  420,  420,  420,  421,  421,  421,  421,  421,  421,  421,  421,
+	 422,  422,  422,  422,  422,  422,  422,  422,  423,  423,  423,  423,  423,  423,  423,  423,
+	 424,  424,  424,  424,  424,  424,  424,  424,  425,  426,  427,  428,  429,    1,    1,    1,
+	 430,  430,  430,  430,  430,  430,  430,  430,  431,  431,  431,  431,  431,  431,  431,  431,
+	 432,  432,  432,  432,  432,  432,  432,  432,  433,  433,  433,  433,  433,  433,  433,  433,
+	 434,  434,  434,  434,  434,  434,  434,  434,  435,  435,  435,  435,  435,  435,  435,  435,
+	 436,  436,  436,  436,  436,  436,  436,  436,  437,  438,  439,  440,  441,    1,    1,    1,
+	 442,  442,  442,  442,  442,  442,  442,  442,  443,  443,  443,  443,  443,  443,  443,  443,
+	 444,  444,  444,  444,  444,  444,  444,  444,  445,  445,  445,  445,  445,  445,  445,  445,
+	 446,  446,  446,  446,  446,  446,  446,  446,  447,  447,  447,  447,  447,  447,  447,  447,
+	 448,  448,  448,  448,  448,  448,  448,  448,  449,  450,  451,  452,  453,    1,    1,    1,
+	 454,  454,  454,  454,  454,  454,  454,  454,  455,  455,  455,  455,  455,  455,  455,  455,
+	 456,  456,  456,  456,  456,  456,  456,  456,  457,  457,  457,  457,  457,  457,  457,  457,
+	 458,  458,  458,  458,  458,  458,  458,  458,  459,  459,  459,  459,  459,  459,  459,  459,
+	 460,  460,  460,  460,  460,  460,  460,  460,  461,  462,  463,  464,  465,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 382,  382,  382,  382,  382,  382,  382,  382,  383,  383,  383,  383,  383,  383,  383,  383,
+	 384,  384,  384,  384,  384,  384,  384,  384,  385,  385,  385,  385,  385,  385,  385,  385,
+	 386,  386,  386,  386,  386,  386,  386,  386,  387,  387,  387,  387,  387,  387,  387,  387,
+	 388,  388,  388,  388,  388,  388,  388,  388,  389,  390,  391,  392,  393,    1,    1,    1,
+	 394,  394,  394,  394,  394,  394,  394,  394,  395,  395,  395,  395,  395,  395,  395,  395,
+	 396,  396,  396,  396,  396,  396,  396,  396,  397,  397,  397,  397,  397,  397,  397,  397,
+	 398,  398,  398,  398,  398,  398,  398,  398,  399,  399,  399,  399,  399,  399,  399,  399,
+	 400,  400,  400,  400,  400,  400,  400,  400,  401,  402,  403,  404,  405,    1,    1,    1,
+	 406,  406,  406,  406,  406,  406,  406,  406,  407,  407,  407,  407,  407,  407,  407,  407,
+	 408,  408,  408,  408,  408,  408,  408,  408,  409,  409,  409,  409,  409,  409,  409,  409,
+	 410,  410,  410,  410,  410,  410,  410,  410,  411,  411,  411,  411,  411,  411,  411,  411,
+	 412,  412,  412,  412,  412,  412,  412,  412,  413,  414,  415,  416,  417,    1,    1,    1,
+	 418,  418,  418,  418,  418,  418,  418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+	 420,  420,  420,  420,  420,  420,  420,  420,  421,  421,  421,  421,  421,  421,  421,  421,
+	 422,  422,  422,  422,  422,  422,  422,  422,  423,  423,  423,  423,  423,  423,  423,  423,
+	 424,  424,  424,  424,  424,  424,  424,  424,  425,  426,  427,  428,  429,    1,    1,    1,
+	 430,  430,  430,  430,  430,  430,  430,  430,  431,  431,  431,  431,  431,  431,  431,  431,
+	 432,  432,  432,  432,  432,  432,  432,  432,  433,  433,  433,  433,  433,  433,  433,  433,
+	 434,  434,  434,  434,  434,  434,  434,  434,  435,  435,  435,  435,  435,  435,  435,  435,
+	 436,  436,  436,  436,  436,  436,  436,  436,  437,  438,  439,  440,  441,    1,    1,    1,
+	 442,  442,  442,  442,  442,  442,  442,  442,  443,  443,  443,  443,  443,  443,  443,  443,
+	 444,  444,  444,  444,  444,  444,  444,  444,  445,  445,  445,  445,  445,  445,  445,  445,
+	 446,  446,  446,  446,  446,  446,  446,  446,  447,  447,  447,  447,  447,  447,  447,  447,
+	 448,  448,  448,  448,  448,  448,  448,  448,  449,  450,  451,  452,  453,    1,    1,    1,
+	 454,  454,  454,  454,  454,  454,  454,  454,  455,  455,  455,  455,  455,  455,  455,  455,
+	 456,  456,  456,  456,  456,  456,  456,  456,  457,  457,  457,  457,  457,  457,  457,  457,
+	 458,  458,  458,  458,  458,  458,  458,  458,  459,  459,  459,  459,  459,  459,  459,  459,
+	 460,  460,  460,  460,  460,  460,  460,  460,  461,  462,  463,  464,  465,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 382,  382,  382,  382,  382,  382,  382,  382,  383,  383,  383,  383,  383,  383,  383,  383,
+	 384,  384,  384,  384,  384,  384,  384,  384,  385,  385,  385,  385,  385,  385,  385,  385,
+	 386,  386,  386,  386,  386,  386,  386,  386,  387,  387,  387,  387,  387,  387,  387,  387,
+	 388,  388,  388,  388,  388,  388,  388,  388,  389,  390,  391,  392,  393,    1,    1,    1,
+	 394,  394,  394,  394,  394,  394,  394,  394,  395,  395,  395,  395,  395,  395,  395,  395,
+	 396,  396,  396,  396,  396,  396,  396,  396,  397,  397,  397,  397,  397,  397,  397,  397,
+	 398,  398,  398,  398,  398,  398,  398,  398,  399,  399,  399,  399,  399,  399,  399,  399,
+	 400,  400,  400,  400,  400,  400,  400,  400,  401,  402,  403,  404,  405,    1,    1,    1,
+	 406,  406,  406,  406,  406,  406,  406,  406,  407,  407,  407,  407,  407,  407,  407,  407,
+	 408,  408,  408,  408,  408,  408,  408,  408,  409,  409,  409,  409,  409,  409,  409,  409,
+	 410,  410,  410,  410,  410,  410,  410,  410,  411,  411,  411,  411,  411,  411,  411,  411,
+	 412,  412,  412,  412,  412,  412,  412,  412,  413,  414,  415,  416,  417,    1,    1,    1,
+	 418,  418,  418,  418,  418,  418,  418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+	 420,  420,  420,  420,  420,  420,  420,  420,  421,  421,  421,  421,  421,  421,  421,  421,
+	 422,  422,  422,  422,  422,  422,  422,  422,  423,  423,  423,  423,  423,  423,  423,  423,
+	 424,  424,  424,  424,  424,  424,  424,  424,  425,  426,  427,  428,  429,    1,    1,    1,
+	 430,  430,  430,  430,  430,  430,  430,  430,  431,  431,  431,  431,  431,  431,  431,  431,
+	 432,  432,  432,  432,  432,  432,  432,  432,  433,  433,  433,  433,  433,  433,  433,  433,
+	 434,  434,  434,  434,  434,  434,  434,  434,  435,  435,  435,  435,  435,  435,  435,  435,
+	 436,  436,  436,  436,  436,  436,  436,  436,  437,  438,  439,  440,  441,    1,    1,    1,
+	 442,  442,  442,  442,  442,  442,  442,  442,  443,  443,  443,  443,  443,  443,  443,  443,
+	 444,  444,  444,  444,  444,  444,  444,  444,  445,  445,  445,  445,  445,  445,  445,  445,
+	 446,  446,  446,  446,  446,  446,  446,  446,  447,  447,  447,  447,  447,  447,  447,  447,
+	 448,  448,  448,  448,  448,  448,  448,  448,  449,  450,  451,  452,  453,    1,    1,    1,
+	 454,  454,  454,  454,  454,  454,  454,  454,  455,  455,  455,  455,  455,  455,  455,  455,
+	 456,  456,  456,  456,  456,  456,  456,  456,  457,  457,  457,  457,  457,  457,  457,  457,
+	 458,  458,  458,  458,  458,  458,  458,  458,  459,  459,  459,  459,  459,  459,  459,  459,
+	 460,  460,  460,  460,  460,  460,  460,  460,  461,  462,  463,  464,  465,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 382,  382,  382,  382,  382,  382,  382,  382,  383,  383,  383,  383,  383,  383,  383,  383,
+	 384,  384,  384,  384,  384,  384,  384,  384,  385,  385,  385,  385,  385,  385,  385,  385,
+	 386,  386,  386,  386,  386,  386,  386,  386,  387,  387,  387,  387,  387,  387,  387,  387,
+	 388,  388,  388,  388,  388,  388,  388,  388,  389,  390,  391,  392,  393,    1,    1,    1,
+	 394,  394,  394,  394,  394,  394,  394,  394,  395,  395,  395,  395,  395,  395,  395,  395,
+	 396,  396,  396,  396,  396,  396,  396,  396,  397,  397,  397,  397,  397,  397,  397,  397,
+	 398,  398,  398,  398,  398,  398,  398,  398,  399,  399,  399,  399,  399,  399,  399,  399,
+	 400,  400,  400,  400,  400,  400,  400,  400,  401,  402,  403,  404,  405,    1,    1,    1,
+	 406,  406,  406,  406,  406,  406,  406,  406,  407,  407,  407,  407,  407,  407,  407,  407,
+	 408,  408,  408,  408,  408,  408,  408,  408,  409,  409,  409,  409,  409,  409,  409,  409,
+	 410,  410,  410,  410,  410,  410,  410,  410,  411,  411,  411,  411,  411,  411,  411,  411,
+	 412,  412,  412,  412,  412,  412,  412,  412,  413,  414,  415,  416,  417,    1,    1,    1,
+	 418,  418,  418,  418,  418,  418,  418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+	 420,  420,  420,  420,  420,  420,  420,  420,  421,  421,  421,  421,  421,  421,  421,  421,
+	 422,  422,  422,  422,  422,  422,  422,  422,  423,  423,  423,  423,  423,  423,  423,  423,
+	 424,  424,  424,  424,  424,  424,  424,  424,  425,  426,  427,  428,  429,    1,    1,    1,
+	 430,  430,  430,  430,  430,  430,  430,  430,  431,  431,  431,  431,  431,  431,  431,  431,
+	 432,  432,  432,  432,  432,  432,  432,  432,  433,  433,  433,  433,  433,  433,  433,  433,
+	 434,  434,  434,  434,  434,  434,  434,  434,  435,  435,  435,  435,  435,  435,  435,  435,
+	 436,  436,  436,  436,  436,  436,  436,  436,  437,  438,  439,  440,  441,    1,    1,    1,
+	 442,  442,  442,  442,  442,  442,  442,  442,  443,  443,  443,  443,  443,  443,  443,  443,
+	 444,  444,  444,  444,  444,  444,  444,  444,  445,  445,  445,  445,  445,  445,  445,  445,
+	 446,  446,  446,  446,  446,  446,  446,  446,  447,  447,  447,  447,  447,  447,  447,  447,
+	 448,  448,  448,  448,  448,  448,  448,  448,  449,  450,  451,  452,  453,    1,    1,    1,
+	 454,  454,  454,  454,  454,  454,  454,  454,  455,  455,  455,  455,  455,  455,  455,  455,
+	 456,  456,  456,  456,  456,  456,  456,  456,  457,  457,  457,  457,  457,  457,  457,  457,
+	 458,  458,  458,  458,  458,  458,  458,  458,  459,  459,  459,  459,  459,  459,  459,  459,
+	 460,  460,  460,  460,  460,  460,  460,  460,  461,  462,  463,  464,  465,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 382,  382,  382,  382,  382,  382,  382,  382,  383,  383,  383,  383,  383,  383,  383,  383,
+	 384,  384,  384,  384,  384,  384,  384,  384,  385,  385,  385,  385,  385,  385,  385,  385,
+	 386,  386,  386,  386,  386,  386,  386,  386,  387,  387,  387,  387,  387,  387,  387,  387,
+	 388,  388,  388,  388,  388,  388,  388,  388,  389,  390,  391,  392,  393,    1,    1,    1,
+	 394,  394,  394,  394,  394,  394,  394,  394,  395,  395,  395,  395,  395,  395,  395,  395,
+	 396,  396,  396,  396,  396,  396,  396,  396,  397,  397,  397,  397,  397,  397,  397,  397,
+	 398,  398,  398,  398,  398,  398,  398,  398,  399,  399,  399,  399,  399,  399,  399,  399,
+	 400,  400,  400,  400,  400,  400,  400,  400,  401,  402,  403,  404,  405,    1,    1,    1,
+	 406,  406,  406,  406,  406,  406,  406,  406,  407,  407,  407,  407,  407,  407,  407,  407,
+	 408,  408,  408,  408,  408,  408,  408,  408,  409,  409,  409,  409,  409,  409,  409,  409,
+	 410,  410,  410,  410,  410,  410,  410,  410,  411,  411,  411,  411,  411,  411,  411,  411,
+	 412,  412,  412,  412,  412,  412,  412,  412,  413,  414,  415,  416,  417,    1,    1,    1,
+	 418,  418,  418,  418,  418,  418,  418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+	 420,  420,  420,  420,  420,  420,  420,  420,  421,  421,  421,  421,  421,  421,  421,  421,
+	 422,  422,  422,  422,  422,  422,  422,  422,  423,  423,  423,  423,  423,  423,  423,  423,
+	 424,  424,  424,  424,  424,  424,  424,  424,  425,  426,  427,  428,  429,    1,    1,    1,
+	 430,  430,  430,  430,  430,  430,  430,  430,  431,  431,  431,  431,  431,  431,  431,  431,
+	 432,  432,  432,  432,  432,  432,  432,  432,  433,  433,  433,  433,  433,  433,  433,  433,
+	 434,  434,  434,  434,  434,  434,  434,  434,  435,  435,  435,  435,  435,  435,  435,  435,
+	 436,  436,  436,  436,  436,  436,  436,  436,  437,  438,  439,  440,  441,    1,    1,    1,
+	 442,  442,  442,  442,  442,  442,  442,  442,  443,  443,  443,  443,  443,  443,  443,  443,
+	 444,  444,  444,  444,  444,  444,  444,  444,  445,  445,  445,  445,  445,  445,  445,  445,
+	 446,  446,  446,  446,  446,  446,  446,  446,  447,  447,  447,  447,  447,  447,  447,  447,
+	 448,  448,  448,  448,  448,  448,  448,  448,  449,  450,  451,  452,  453,    1,    1,    1,
+	 454,  454,  454,  454,  454,  454,  454,  454,  455,  455,  455,  455,  455,  455,  455,  455,
+	 456,  456,  456,  456,  456,  456,  456,  456,  457,  457,  457,  457,  457,  457,  457,  457,
+	 458,  458,  458,  458,  458,  458,  458,  458,  459,  459,  459,  459,  459,  459,  459,  459,
+	 460,  460,  460,  460,  460,  460,  460,  460,  461,  462,  463,  464,  465,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 490,  490,  490,  490,  490,  490,  490,  490,  491,  491,  491,  491,  491,  491,  491,  491,
+	 492,  492,  492,  492,  492,  492,  492,  492,  493,  493,  493,  493,  493,  493,  493,  493,
+	 494,  494,  494,  494,  494,  494,  494,  494,  495,  495,  495,  495,  495,  495,  495,  495,
+	 496,  496,  496,  496,  496,  496,  496,  496,  497,  498,  499,  500,  501,    1,    1,    1,
+	 502,  502,  502,  502,  502,  502,  502,  502,  503,  503,  503,  503,  503,  503,  503,  503,
+	 504,  504,  504,  504,  504,  504,  504,  504,  505,  505,  505,  505,  505,  505,  505,  505,
+	 506,  506,  506,  506,  506,  506,  506,  506,  507,  507,  507,  507,  507,  507,  507,  507,
+	 508,  508,  508,  508,  508,  508,  508,  508,  509,  510,  511,  512,  513,    1,    1,    1,
+	 514,  514,  514,  514,  514,  514,  514,  514,  515,  515,  515,  515,  515,  515,  515,  515,
+	 516,  516,  516,  516,  516,  516,  516,  516,  517,  517,  517,  517,  517,  517,  517,  517,
+	 518,  518,  518,  518,  518,  518,  518,  518,  519,  519,  519,  519,  519,  519,  519,  519,
+	 520,  520,  520,  520,  520,  520,  520,  520,  521,  522,  523,  524,  525,    1,    1,    1,
+	 526,  526,  526,  526,  526,  526,  526,  526,  527,  527,  527,  527,  527,  527,  527,  527,
+	 528,  528,  528,  528,  528,  528,  528,  528,  529,  529,  529,  529,  529,  529,  529,  529,
+	 530,  530,  530,  530,  530,  530,  530,  530,  531,  531,  531,  531,  531,  531,  531,  531,
+	 532,  532,  532,  532,  532,  532,  532,  532,  533,  534,  535,  536,  537,    1,    1,    1,
+	 538,  538,  538,  538,  538,  538,  538,  538,  539,  539,  539,  539,  539,  539,  539,  539,
+	 540,  540,  540,  540,  540,  540,  540,  540,  541,  541,  541,  541,  541,  541,  541,  541,
+	 542,  542,  542,  542,  542,  542,  542,  542,  543,  543,  543,  543,  543,  543,  543,  543,
+	 544,  544,  544,  544,  544,  544,  544,  544,  545,  546,  547,  548,  549,    1,    1,    1,
+	 550,  550,  550,  550,  550,  550,  550,  550,  551,  551,  551,  551,  551,  551,  551,  551,
+	 552,  552,  552,  552,  552,  552,  552,  552,  553,  553,  553,  553,  553,  553,  553,  553,
+	 554,  554,  554,  554,  554,  554,  554,  554,  555,  555,  555,  555,  555,  555,  555,  555,
+	 556,  556,  556,  556,  556,  556,  556,  556,  557,  558,  559,  560,  561,    1,    1,    1,
+	 562,  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,  563,  563,  563,  563,  563,
+	 564,  564,  564,  564,  564,  564,  564,  564,  565,  565,  565,  565,  565,  565,  565,  565,
+	 566,  566,  566,  566,  566,  566,  566,  566,  567,  567,  567,  567,  567,  567,  567,  567,
+	 568,  568,  568,  568,  568,  568,  568,  568,  569,  570,  571,  572,  573,    1,    1,    1,
+	 574,  574,  574,  574,  574,  574,  574,  574,  575,  575,  575,  575,  575,  575,  575,  575,
+	 576,  576,  576,  576,  576,  576,  576,  576,  577,  577,  577,  577,  577,  577,  577,  577,
+	 578,  578,  578,  578,  578,  578,  578,  578,  579,  579,  579,  579,  579,  579,  579,  579,
+	 580,  580,  580,  580,  580,  580,  580,  580,  581,  582,  583,  584,  585,    1,    1,    1,
+	 490,  490,  490,  490,  490,  490,  490,  490,  491,  491,  491,  491,  491,  491,  491,  491,
+	 492,  492,  492,  492,  492,  492,  492,  492,  493,  493,  493,  493,  493,  493,  493,  493,
+	 494,  494,  494,  494,  494,  494,  494,  494,  495,  495,  495,  495,  495,  495,  495,  495,
+	 496,  496,  496,  496,  496,  496,  496,  496,  497,  498,  499,  500,  501,    1,    1,    1,
+	 502,  502,  502,  502,  502,  502,  502,  502,  503,  503,  503,  503,  503,  503,  503,  503,
+	 504,  504,  504,  504,  504,  504,  504,  504,  505,  505,  505,  505,  505,  505,  505,  505,
+	 506,  506,  506,  506,  506,  506,  506,  506,  507,  507,  507,  507,  507,  507,  507,  507,
+	 508,  508,  508,  508,  508,  508,  508,  508,  509,  510,  511,  512,  513,    1,    1,    1,
+	 514,  514,  514,  514,  514,  514,  514,  514,  515,  515,  515,  515,  515,  515,  515,  515,
+	 516,  516,  516,  516,  516,  516,  516,  516,  517,  517,  517,  517,  517,  517,  517,  517,
+	 518,  518,  518,  518,  518,  518,  518,  518,  519,  519,  519,  519,  519,  519,  519,  519,
+	 520,  520,  520,  520,  520,  520,  520,  520,  521,  522,  523,  524,  525,    1,    1,    1,
+	 526,  526,  526,  526,  526,  526,  526,  526,  527,  527,  527,  527,  527,  527,  527,  527,
+	 528,  528,  528,  528,  528,  528,  528,  528,  529,  529,  529,  529,  529,  529,  529,  529,
+	 530,  530,  530,  530,  530,  530,  530,  530,  531,  531,  531,  531,  531,  531,  531,  531,
+	 532,  532,  532,  532,  532,  532,  532,  532,  533,  534,  535,  536,  537,    1,    1,    1,
+	 538,  538,  538,  538,  538,  538,  538,  538,  539,  539,  539,  539,  539,  539,  539,  539,
+	 540,  540,  540,  540,  540,  540,  540,  540,  541,  541,  541,  541,  541,  541,  541,  541,
+	 542,  542,  542,  542,  542,  542,  542,  542,  543,  543,  543,  543,  543,  543,  543,  543,
+	 544,  544,  544,  544,  544,  544,  544,  544,  545,  546,  547,  548,  549,    1,    1,    1,
+	 550,  550,  550,  550,  550,  550,  550,  550,  551,  551,  551,  551,  551,  551,  551,  551,
+	 552,  552,  552,  552,  552,  552,  552,  552,  553,  553,  553,  553,  553,  553,  553,  553,
+	 554,  554,  554,  554,  554,  554,  554,  554,  555,  555,  555,  555,  555,  555,  555,  555,
+	 556,  556,  556,  556,  556,  556,  556,  556,  557,  558,  559,  560,  561,    1,    1,    1,
+	 562,  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,  563,  563,  563,  563,  563,
+	 564,  564,  564,  564,  564,  564,  564,  564,  565,  565,  565,  565,  565,  565,  565,  565,
+	 566,  566,  566,  566,  566,  566,  566,  566,  567,  567,  567,  567,  567,  567,  567,  567,
+	 568,  568,  568,  568,  568,  568,  568,  568,  569,  570,  571,  572,  573,    1,    1,    1,
+	 586,  586,  586,  586,  586,  586,  586,  586,  587,  587,  587,  587,  587,  587,  587,  587,
+	 588,  588,  588,  588,  588,  588,  588,  588,  589,  589,  589,  589,  589,  589,  589,  589,
+	 590,  590,  590,  590,  590,  590,  590,  590,  591,  591,  591,  591,  591,  591,  591,  591,
+	 592,  592,  592,  592,  592,  592,  592,  592,  593,  594,  595,  596,  597,    1,    1,    1,
+	 490,  490,  490,  490,  490,  490,  490,  490,  491,  491,  491,  491,  491,  491,  491,  491,
+	 492,  492,  492,  492,  492,  492,  492,  492,  493,  493,  493,  493,  493,  493,  493,  493,
+	 494,  494,  494,  494,  494,  494,  494,  494,  495,  495,  495,  495,  495,  495,  495,  495,
+	 496,  496,  496,  496,  496,  496,  496,  496,  497,  498,  499,  500,  501,    1,    1,    1,
+	 502,  502,  502,  502,  502,  502,  502,  502,  503,  503,  503,  503,  503,  503,  503,  503,
+	 504,  504,  504,  504,  504,  504,  504,  504,  505,  505,  505,  505,  505,  505,  505,  505,
+	 506,  506,  506,  506,  506,  506,  506,  506,  507,  507,  507,  507,  507,  507,  507,  507,
+	 508,  508,  508,  508,  508,  508,  508,  508,  509,  510,  511,  512,  513,    1,    1,    1,
+	 514,  514,  514,  514,  514,  514,  514,  514,  515,  515,  515,  515,  515,  515,  515,  515,
+	 516,  516,  516,  516,  516,  516,  516,  516,  517,  517,  517,  517,  517,  517,  517,  517,
+	 518,  518,  518,  518,  518,  518,  518,  518,  519,  519,  519,  519,  519,  519,  519,  519,
+	 520,  520,  520,  520,  520,  520,  520,  520,  521,  522,  523,  524,  525,    1,    1,    1,
+	 526,  526,  526,  526,  526,  526,  526,  526,  527,  527,  527,  527,  527,  527,  527,  527,
+	 528,  528,  528,  528,  528,  528,  528,  528,  529,  529,  529,  529,  529,  529,  529,  529,
+	 530,  530,  530,  530,  530,  530,  530,  530,  531,  531,  531,  531,  531,  531,  531,  531,
+	 532,  532,  532,  532,  532,  532,  532,  532,  533,  534,  535,  536,  537,    1,    1,    1,
+	 538,  538,  538,  538,  538,  538,  538,  538,  539,  539,  539,  539,  539,  539,  539,  539,
+	 540,  540,  540,  540,  540,  540,  540,  540,  541,  541,  541,  541,  541,  541,  541,  541,
+	 542,  542,  542,  542,  542,  542,  542,  542,  543,  543,  543,  543,  543,  543,  543,  543,
+	 544,  544,  544,  544,  544,  544,  544,  544,  545,  546,  547,  548,  549,    1,    1,    1,
+	 550,  550,  550,  550,  550,  550,  550,  550,  551,  551,  551,  551,  551,  551,  551,  551,
+	 552,  552,  552,  552,  552,  552,  552,  552,  553,  553,  553,  553,  553,  553,  553,  553,
+	 554,  554,  554,  554,  554,  554,  554,  554,  555,  555,  555,  555,  555,  555,  555,  555,
+	 556,  556,  556,  556,  556,  556,  556,  556,  557,  558,  559,  560,  561,    1,    1,    1,
+	 562,  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,  563,  563,  563,  563,  563,
+	 564,  564,  564,  564,  564,  564,  564,  564,  565,  565,  565,  565,  565,  565,  565,  565,
+	 566,  566,  566,  566,  566,  566,  566,  566,  567,  567,  567,  567,  567,  567,  567,  567,
+	 568,  568,  568,  568,  568,  568,  568,  568,  569,  570,  571,  572,  573,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 490,  490,  490,  490,  490,  490,  490,  490,  491,  491,  491,  491,  491,  491,  491,  491,
+	 492,  492,  492,  492,  492,  492,  492,  492,  493,  493,  493,  493,  493,  493,  493,  493,
+	 494,  494,  494,  494,  494,  494,  494,  494,  495,  495,  495,  495,  495,  495,  495,  495,
+	 496,  496,  496,  496,  496,  496,  496,  496,  497,  498,  499,  500,  501,    1,    1,    1,
+	 502,  502,  502,  502,  502,  502,  502,  502,  503,  503,  503,  503,  503,  503,  503,  503,
+	 504,  504,  504,  504,  504,  504,  504,  504,  505,  505,  505,  505,  505,  505,  505,  505,
+	 506,  506,  506,  506,  506,  506,  506,  506,  507,  507,  507,  507,  507,  507,  507,  507,
+	 508,  508,  508,  508,  508,  508,  508,  508,  509,  510,  511,  512,  513,    1,    1,    1,
+	 514,  514,  514,  514,  514,  514,  514,  514,  515,  515,  515,  515,  515,  515,  515,  515,
+	 516,  516,  516,  516,  516,  516,  516,  516,  517,  517,  517,  517,  517,  517,  517,  517,
+	 518,  518,  518,  518,  518,  518,  518,  518,  519,  519,  519,  519,  519,  519,  519,  519,
+	 520,  520,  520,  520,  520,  520,  520,  520,  521,  522,  523,  524,  525,    1,    1,    1,
+	 526,  526,  526,  526,  526,  526,  526,  526,  527,  527,  527,  527,  527,  527,  527,  527,
+	 528,  528,  528,  528,  528,  528,  528,  528,  529,  529,  529,  529,  529,  529,  529,  529,
+	 530,  530,  530,  530,  530,  530,  530,  530,  531,  531,  531,  531,  531,  531,  531,  531,
+	 532,  532,  532,  532,  532,  532,  532,  532,  533,  534,  535,  536,  537,    1,    1,    1,
+	 538,  538,  538,  538,  538,  538,  538,  538,  539,  539,  539,  539,  539,  539,  539,  539,
+	 540,  540,  540,  540,  540,  540,  540,  540,  541,  541,  541,  541,  541,  541,  541,  541,
+	 542,  542,  542,  542,  542,  542,  542,  542,  543,  543,  543,  543,  543,  543,  543,  543,
+	 544,  544,  544,  544,  544,  544,  544,  544,  545,  546,  547,  548,  549,    1,    1,    1,
+	 550,  550,  550,  550,  550,  550,  550,  550,  551,  551,  551,  551,  551,  551,  551,  551,
+	 552,  552,  552,  552,  552,  552,  552,  552,  553,  553,  553,  553,  553,  553,  553,  553,
+	 554,  554,  554,  554,  554,  554,  554,  554,  555,  555,  555,  555,  555,  555,  555,  555,
+	 556,  556,  556,  556,  556,  556,  556,  556,  557,  558,  559,  560,  561,    1,    1,    1,
+	 562,  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,  563,  563,  563,  563,  563,
+	 564,  564,  564,  564,  564,  564,  564,  564,  565,  565,  565,  565,  565,  565,  565,  565,
+	 566,  566,  566,  566,  566,  566,  566,  566,  567,  567,  567,  567,  567,  567,  567,  567,
+	 568,  568,  568,  568,  568,  568,  568,  568,  569,  570,  571,  572,  573,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 490,  490,  490,  490,  490,  490,  490,  490,  491,  491,  491,  491,  491,  491,  491,  491,
+	 492,  492,  492,  492,  492,  492,  492,  492,  493,  493,  493,  493,  493,  493,  493,  493,
+	 494,  494,  494,  494,  494,  494,  494,  494,  495,  495,  495,  495,  495,  495,  495,  495,
+	 496,  496,  496,  496,  496,  496,  496,  496,  497,  498,  499,  500,  501,    1,    1,    1,
+	 502,  502,  502,  502,  502,  502,  502,  502,  503,  503,  503,  503,  503,  503,  503,  503,
+	 504,  504,  504,  504,  504,  504,  504,  504,  505,  505,  505,  505,  505,  505,  505,  505,
+	 506,  506,  506,  506,  506,  506,  506,  506,  507,  507,  507,  507,  507,  507,  507,  507,
+	 508,  508,  508,  508,  508,  508,  508,  508,  509,  510,  511,  512,  513,    1,    1,    1,
+	 514,  514,  514,  514,  514,  514,  514,  514,  515,  515,  515,  515,  515,  515,  515,  515,
+	 516,  516,  516,  516,  516,  516,  516,  516,  517,  517,  517,  517,  517,  517,  517,  517,
+	 518,  518,  518,  518,  518,  518,  518,  518,  519,  519,  519,  519,  519,  519,  519,  519,
+	 520,  520,  520,  520,  520,  520,  520,  520,  521,  522,  523,  524,  525,    1,    1,    1,
+	 526,  526,  526,  526,  526,  526,  526,  526,  527,  527,  527,  527,  527,  527,  527,  527,
+	 528,  528,  528,  528,  528,  528,  528,  528,  529,  529,  529,  529,  529,  529,  529,  529,
+	 530,  530,  530,  530,  530,  530,  530,  530,  531,  531,  531,  531,  531,  531,  531,  531,
+	 532,  532,  532,  532,  532,  532,  532,  532,  533,  534,  535,  536,  537,    1,    1,    1,
+	 538,  538,  538,  538,  538,  538,  538,  538,  539,  539,  539,  539,  539,  539,  539,  539,
+	 540,  540,  540,  540,  540,  540,  540,  540,  541,  541,  541,  541,  541,  541,  541,  541,
+	 542,  542,  542,  542,  542,  542,  542,  542,  543,  543,  543,  543,  543,  543,  543,  543,
+	 544,  544,  544,  544,  544,  544,  544,  544,  545,  546,  547,  548,  549,    1,    1,    1,
+	 550,  550,  550,  550,  550,  550,  550,  550,  551,  551,  551,  551,  551,  551,  551,  551,
+	 552,  552,  552,  552,  552,  552,  552,  552,  553,  553,  553,  553,  553,  553,  553,  553,
+	 554,  554,  554,  554,  554,  554,  554,  554,  555,  555,  555,  555,  555,  555,  555,  555,
+	 556,  556,  556,  556,  556,  556,  556,  556,  557,  558,  559,  560,  561,    1,    1,    1,
+	 562,  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,  563,  563,  563,  563,  563,
+	 564,  564,  564,  564,  564,  564,  564,  564,  565,  565,  565,  565,  565,  565,  565,  565,
+	 566,  566,  566,  566,  566,  566,  566,  566,  567,  567,  567,  567,  567,  567,  567,  567,
+	 568,  568,  568,  568,  568,  568,  568,  568,  569,  570,  571,  572,  573,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 490,  490,  490,  490,  490,  490,  490,  490,  491,  491,  491,  491,  491,  491,  491,  491,
+	 492,  492,  492,  492,  492,  492,  492,  492,  493,  493,  493,  493,  493,  493,  493,  493,
+	 494,  494,  494,  494,  494,  494,  494,  494,  495,  495,  495,  495,  495,  495,  495,  495,
+	 496,  496,  496,  496,  496,  496,  496,  496,  497,  498,  499,  500,  501,    1,    1,    1,
+	 502,  502,  502,  502,  502,  502,  502,  502,  503,  503,  503,  503,  503,  503,  503,  503,
+	 504,  504,  504,  504,  504,  504,  504,  504,  505,  505,  505,  505,  505,  505,  505,  505,
+	 506,  506,  506,  506,  506,  506,  506,  506,  507,  507,  507,  507,  507,  507,  507,  507,
+	 508,  508,  508,  508,  508,  508,  508,  508,  509,  510,  511,  512,  513,    1,    1,    1,
+	 514,  514,  514,  514,  514,  514,  514,  514,  515,  515,  515,  515,  515,  515,  515,  515,
+	 516,  516,  516,  516,  516,  516,  516,  516,  517,  517,  517,  517,  517,  517,  517,  517,
+	 518,  518,  518,  518,  518,  518,  518,  518,  519,  519,  519,  519,  519,  519,  519,  519,
+	 520,  520,  520,  520,  520,  520,  520,  520,  521,  522,  523,  524,  525,    1,    1,    1,
+	 526,  526,  526,  526,  526,  526,  526,  526,  527,  527,  527,  527,  527,  527,  527,  527,
+	 528,  528,  528,  528,  528,  528,  528,  528,  529,  529,  529,  529,  529,  529,  529,  529,
+	 530,  530,  530,  530,  530,  530,  530,  530,  531,  531,  531,  531,  531,  531,  531,  531,
+	 532,  532,  532,  532,  532,  532,  532,  532,  533,  534,  535,  536,  537,    1,    1,    1,
+	 538,  538,  538,  538,  538,  538,  538,  538,  539,  539,  539,  539,  539,  539,  539,  539,
+	 540,  540,  540,  540,  540,  540,  540,  540,  541,  541,  541,  541,  541,  541,  541,  541,
+	 542,  542,  542,  542,  542,  542,  542,  542,  543,  543,  543,  543,  543,  543,  543,  543,
+	 544,  544,  544,  544,  544,  544,  544,  544,  545,  546,  547,  548,  549,    1,    1,    1,
+	 550,  550,  550,  550,  550,  550,  550,  550,  551,  551,  551,  551,  551,  551,  551,  551,
+	 552,  552,  552,  552,  552,  552,  552,  552,  553,  553,  553,  553,  553,  553,  553,  553,
+	 554,  554,  554,  554,  554,  554,  554,  554,  555,  555,  555,  555,  555,  555,  555,  555,
+	 556,  556,  556,  556,  556,  556,  556,  556,  557,  558,  559,  560,  561,    1,    1,    1,
+	 562,  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,  563,  563,  563,  563,  563,
+	 564,  564,  564,  564,  564,  564,  564,  564,  565,  565,  565,  565,  565,  565,  565,  565,
+	 566,  566,  566,  566,  566,  566,  566,  566,  567,  567,  567,  567,  567,  567,  567,  567,
+	 568,  568,  568,  568,  568,  568,  568,  568,  569,  570,  571,  572,  573,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 490,  490,  490,  490,  490,  490,  490,  490,  491,  491,  491,  491,  491,  491,  491,  491,
+	 492,  492,  492,  492,  492,  492,  492,  492,  493,  493,  493,  493,  493,  493,  493,  493,
+	 494,  494,  494,  494,  494,  494,  494,  494,  495,  495,  495,  495,  495,  495,  495,  495,
+	 496,  496,  496,  496,  496,  496,  496,  496,  497,  498,  499,  500,  501,    1,    1,    1,
+	 502,  502,  502,  502,  502,  502,  502,  502,  503,  503,  503,  503,  503,  503,  503,  503,
+	 504,  504,  504,  504,  504,  504,  504,  504,  505,  505,  505,  505,  505,  505,  505,  505,
+	 506,  506,  506,  506,  506,  506,  506,  506,  507,  507,  507,  507,  507,  507,  507,  507,
+	 508,  508,  508,  508,  508,  508,  508,  508,  509,  510,  511,  512,  513,    1,    1,    1,
+	 514,  514,  514,  514,  514,  514,  514,  514,  515,  515,  515,  515,  515,  515,  515,  515,
+	 516,  516,  516,  516,  516,  516,  516,  516,  517,  517,  517,  517,  517,  517,  517,  517,
+	 518,  518,  518,  518,  518,  518,  518,  518,  519,  519,  519,  519,  519,  519,  519,  519,
+	 520,  520,  520,  520,  520,  520,  520,  520,  521,  522,  523,  524,  525,    1,    1,    1,
+	 526,  526,  526,  526,  526,  526,  526,  526,  527,  527,  527,  527,  527,  527,  527,  527,
+	 528,  528,  528,  528,  528,  528,  528,  528,  529,  529,  529,  529,  529,  529,  529,  529,
+	 530,  530,  530,  530,  530,  530,  530,  530,  531,  531,  531,  531,  531,  531,  531,  531,
+	 532,  532,  532,  532,  532,  532,  532,  532,  533,  534,  535,  536,  537,    1,    1,    1,
+	 538,  538,  538,  538,  538,  538,  538,  538,  539,  539,  539,  539,  539,  539,  539,  539,
+	 540,  540,  540,  540,  540,  540,  540,  540,  541,  541,  541,  541,  541,  541,  541,  541,
+	 542,  542,  542,  542,  542,  542,  542,  542,  543,  543,  543,  543,  543,  543,  543,  543,
+	 544,  544,  544,  544,  544,  544,  544,  544,  545,  546,  547,  548,  549,    1,    1,    1,
+	 550,  550,  550,  550,  550,  550,  550,  550,  551,  551,  551,  551,  551,  551,  551,  551,
+	 552,  552,  552,  552,  552,  552,  552,  552,  553,  553,  553,  553,  553,  553,  553,  553,
+	 554,  554,  554,  554,  554,  554,  554,  554,  555,  555,  555,  555,  555,  555,  555,  555,
+	 556,  556,  556,  556,  556,  556,  556,  556,  557,  558,  559,  560,  561,    1,    1,    1,
+	 562,  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,  563,  563,  563,  563,  563,
+	 564,  564,  564,  564,  564,  564,  564,  564,  565,  565,  565,  565,  565,  565,  565,  565,
+	 566,  566,  566,  566,  566,  566,  566,  566,  567,  567,  567,  567,  567,  567,  567,  567,
+	 568,  568,  568,  568,  568,  568,  568,  568,  569,  570,  571,  572,  573,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 490,  490,  490,  490,  490,  490,  490,  490,  491,  491,  491,  491,  491,  491,  491,  491,
+	 492,  492,  492,  492,  492,  492,  492,  492,  493,  493,  493,  493,  493,  493,  493,  493,
+	 494,  494,  494,  494,  494,  494,  494,  494,  495,  495,  495,  495,  495,  495,  495,  495,
+	 496,  496,  496,  496,  496,  496,  496,  496,  497,  498,  499,  500,  501,    1,    1,    1,
+	 502,  502,  502,  502,  502,  502,  502,  502,  503,  503,  503,  503,  503,  503,  503,  503,
+	 504,  504,  504,  504,  504,  504,  504,  504,  505,  505,  505,  505,  505,  505,  505,  505,
+	 506,  506,  506,  506,  506,  506,  506,  506,  507,  507,  507,  507,  507,  507,  507,  507,
+	 508,  508,  508,  508,  508,  508,  508,  508,  509,  510,  511,  512,  513,    1,    1,    1,
+	 514,  514,  514,  514,  514,  514,  514,  514,  515,  515,  515,  515,  515,  515,  515,  515,
+	 516,  516,  516,  516,  516,  516,  516,  516,  517,  517,  517,  517,  517,  517,  517,  517,
+	 518,  518,  518,  518,  518,  518,  518,  518,  519,  519,  519,  519,  519,  519,  519,  519,
+	 520,  520,  520,  520,  520,  520,  520,  520,  521,  522,  523,  524,  525,    1,    1,    1,
+	 526,  526,  526,  526,  526,  526,  526,  526,  527,  527,  527,  527,  527,  527,  527,  527,
+	 528,  528,  528,  528,  528,  528,  528,  528,  529,  529,  529,  529,  529,  529,  529,  529,
+	 530,  530,  530,  530,  530,  530,  530,  530,  531,  531,  531,  531,  531,  531,  531,  531,
+	 532,  532,  532,  532,  532,  532,  532,  532,  533,  534,  535,  536,  537,    1,    1,    1,
+	 538,  538,  538,  538,  538,  538,  538,  538,  539,  539,  539,  539,  539,  539,  539,  539,
+	 540,  540,  540,  540,  540,  540,  540,  540,  541,  541,  541,  541,  541,  541,  541,  541,
+	 542,  542,  542,  542,  542,  542,  542,  542,  543,  543,  543,  543,  543,  543,  543,  543,
+	 544,  544,  544,  544,  544,  544,  544,  544,  545,  546,  547,  548,  549,    1,    1,    1,
+	 550,  550,  550,  550,  550,  550,  550,  550,  551,  551,  551,  551,  551,  551,  551,  551,
+	 552,  552,  552,  552,  552,  552,  552,  552,  553,  553,  553,  553,  553,  553,  553,  553,
+	 554,  554,  554,  554,  554,  554,  554,  554,  555,  555,  555,  555,  555,  555,  555,  555,
+	 556,  556,  556,  556,  556,  556,  556,  556,  557,  558,  559,  560,  561,    1,    1,    1,
+	 562,  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,  563,  563,  563,  563,  563,
+	 564,  564,  564,  564,  564,  564,  564,  564,  565,  565,  565,  565,  565,  565,  565,  565,
+	 566,  566,  566,  566,  566,  566,  566,  566,  567,  567,  567,  567,  567,  567,  567,  567,
+	 568,  568,  568,  568,  568,  568,  568,  568,  569,  570,  571,  572,  573,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 598,  598,  598,  598,  598,  598,  598,  598,    1,    1,    1,    1,    1,    1,    1,    1,
+	 599,  599,  599,  599,  599,  599,  599,  599,  600,  600,  600,  600,  600,  600,  600,  601,
+	 602,  602,  602,  602,  602,  602,  602,  603,  604,  604,  604,  604,  604,  604,  604,  604,
+	 605,  605,  605,  605,  605,  605,  605,  605,  606,  607,    1,    1,    1,    1,    1,    1,
+	 608,  608,  608,  608,  608,  608,  608,  608,    1,    1,    1,    1,    1,    1,    1,    1,
+	 609,  609,  609,  609,  609,  609,  609,  609,  610,  610,  610,  610,  610,  610,  610,  610,
+	 611,  611,  611,  611,  611,  611,  611,  611,  612,  612,  612,  612,  612,  612,  612,  612,
+	 613,  613,  613,  613,  613,  613,  613,  613,  614,  615,    1,    1,    1,    1,    1,    1,
+	 616,  616,  616,  616,  616,  616,  616,  616,    1,    1,    1,    1,    1,    1,    1,    1,
+	 617,  617,  617,  617,  617,  617,  617,  617,  618,  618,  618,  618,  618,  618,  618,  618,
+	 619,  619,  619,  619,  619,  619,  619,  619,  620,  620,  620,  620,  620,  620,  620,  620,
+	 621,  621,  621,  621,  621,  621,  621,  621,  622,  623,    1,    1,    1,    1,    1,    1,
+	 624,  624,  624,  624,  624,  624,  624,  624,    1,    1,    1,    1,    1,    1,    1,    1,
+	 625,  625,  625,  625,  625,  625,  625,  625,  626,  626,  626,  626,  626,  626,  626,  626,
+	 627,  627,  627,  627,  627,  627,  627,  627,  628,  628,  628,  628,  628,  628,  628,  628,
+	 629,  629,  629,  629,  629,  629,  629,  629,  630,  631,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 632,  632,  632,  632,  632,  632,  632,  632,    1,    1,    1,    1,    1,    1,    1,    1,
+	 633,  633,  633,  633,  633,  633,  633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
+	 635,  635,  635,  635,  635,  635,  635,  635,  636,  636,  636,  636,  636,  636,  636,  636,
+	 637,  637,  637,  637,  637,  637,  637,  637,  638,  639,  640,  641,  642,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 643,  643,  643,  643,  643,  643,  643,  643,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  644,  644,  644,  644,  644,  644,  644,  644,
+	 645,  645,  645,  645,  645,  645,  645,  645,  646,  647,  648,  649,    1,    1,    1,    1,
+	 650,  650,  650,  650,  650,  650,  650,  650,    1,    1,    1,    1,    1,    1,    1,    1,
+	 651,  651,  651,  651,  651,  651,  651,  651,  652,  652,  652,  652,  652,  652,  652,  653,
+	 654,  654,  654,  654,  654,  654,  654,  655,  656,  656,  656,  656,  656,  656,  656,  656,
+	 657,  657,  657,  657,  657,  657,  657,  657,  658,  659,    1,    1,    1,    1,    1,    1,
+	 660,  660,  660,  660,  660,  660,  660,  660,    1,    1,    1,    1,    1,    1,    1,    1,
+	 661,  661,  661,  661,  661,  661,  661,  661,  662,  662,  662,  662,  662,  662,  662,  662,
+	 663,  663,  663,  663,  663,  663,  663,  663,  664,  664,  664,  664,  664,  664,  664,  664,
+	 665,  665,  665,  665,  665,  665,  665,  665,  666,  667,    1,    1,    1,    1,    1,    1,
+	 668,  668,  668,  668,  668,  668,  668,  668,    1,    1,    1,    1,    1,    1,    1,    1,
+	 669,  669,  669,  669,  669,  669,  669,  669,  670,  670,  670,  670,  670,  670,  670,  670,
+	 671,  671,  671,  671,  671,  671,  671,  671,  672,  672,  672,  672,  672,  672,  672,  672,
+	 673,  673,  673,  673,  673,  673,  673,  673,  674,  675,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 632,  632,  632,  632,  632,  632,  632,  632,    1,    1,    1,    1,    1,    1,    1,    1,
+	 633,  633,  633,  633,  633,  633,  633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
+	 635,  635,  635,  635,  635,  635,  635,  635,  636,  636,  636,  636,  636,  636,  636,  636,
+	 637,  637,  637,  637,  637,  637,  637,  637,  638,  639,  640,  641,  642,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 643,  643,  643,  643,  643,  643,  643,  643,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  644,  644,  644,  644,  644,  644,  644,  644,
+	 645,  645,  645,  645,  645,  645,  645,  645,  646,  647,  648,  649,    1,    1,    1,    1,
+	 676,  676,  676,  676,  676,  676,  676,  676,    1,    1,    1,    1,    1,    1,    1,    1,
+	 677,  677,  677,  677,  677,  677,  677,  677,  678,  678,  678,  678,  678,  678,  678,  679,
+	 680,  680,  680,  680,  680,  680,  680,  681,  682,  682,  682,  682,  682,  682,  682,  682,
+	 683,  683,  683,  683,  683,  683,  683,  683,  684,  685,    1,    1,    1,    1,    1,    1,
+	 686,  686,  686,  686,  686,  686,  686,  686,    1,    1,    1,    1,    1,    1,    1,    1,
+	 687,  687,  687,  687,  687,  687,  687,  687,  688,  688,  688,  688,  688,  688,  688,  688,
+	 689,  689,  689,  689,  689,  689,  689,  689,  690,  690,  690,  690,  690,  690,  690,  690,
+	 691,  691,  691,  691,  691,  691,  691,  691,  692,  693,    1,    1,    1,    1,    1,    1,
+	 694,  694,  694,  694,  694,  694,  694,  694,    1,    1,    1,    1,    1,    1,    1,    1,
+	 695,  695,  695,  695,  695,  695,  695,  695,  696,  696,  696,  696,  696,  696,  696,  696,
+	 697,  697,  697,  697,  697,  697,  697,  697,  698,  698,  698,  698,  698,  698,  698,  698,
+	 699,  699,  699,  699,  699,  699,  699,  699,  700,  701,    1,    1,    1,    1,    1,    1,
+	 702,  702,  702,  702,  702,  702,  702,  702,    1,    1,    1,    1,    1,    1,    1,    1,
+	 703,  703,  703,  703,  703,  703,  703,  703,  704,  704,  704,  704,  704,  704,  704,  704,
+	 705,  705,  705,  705,  705,  705,  705,  705,  706,  706,  706,  706,  706,  706,  706,  706,
+	 707,  707,  707,  707,  707,  707,  707,  707,  708,  709,  710,  711,  712,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 632,  632,  632,  632,  632,  632,  632,  632,    1,    1,    1,    1,    1,    1,    1,    1,
+	 633,  633,  633,  633,  633,  633,  633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
+	 635,  635,  635,  635,  635,  635,  635,  635,  636,  636,  636,  636,  636,  636,  636,  636,
+	 637,  637,  637,  637,  637,  637,  637,  637,  638,  639,  640,  641,  642,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 643,  643,  643,  643,  643,  643,  643,  643,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  644,  644,  644,  644,  644,  644,  644,  644,
+	 645,  645,  645,  645,  645,  645,  645,  645,  646,  647,  648,  649,    1,    1,    1,    1,
+	 713,  713,  713,  713,  713,  713,  713,  713,    1,    1,    1,    1,    1,    1,    1,    1,
+	 714,  714,  714,  714,  714,  714,  714,  714,  715,  715,  715,  715,  715,  715,  715,  716,
+	 717,  717,  717,  717,  717,  717,  717,  718,  719,  719,  719,  719,  719,  719,  719,  719,
+	 720,  720,  720,  720,  720,  720,  720,  720,  721,  722,    1,    1,    1,    1,    1,    1,
+	 723,  723,  723,  723,  723,  723,  723,  723,    1,    1,    1,    1,    1,    1,    1,    1,
+	 724,  724,  724,  724,  724,  724,  724,  724,  725,  725,  725,  725,  725,  725,  725,  725,
+	 726,  726,  726,  726,  726,  726,  726,  726,  727,  727,  727,  727,  727,  727,  727,  727,
+	 728,  728,  728,  728,  728,  728,  728,  728,  729,  730,    1,    1,    1,    1,    1,    1,
+	 731,  731,  731,  731,  731,  731,  731,  731,    1,    1,    1,    1,    1,    1,    1,    1,
+	 732,  732,  732,  732,  732,  732,  732,  732,  733,  733,  733,  733,  733,  733,  733,  733,
+	 734,  734,  734,  734,  734,  734,  734,  734,  735,  735,  735,  735,  735,  735,  735,  735,
+	 736,  736,  736,  736,  736,  736,  736,  736,  737,  738,    1,    1,    1,    1,    1,    1,
+	 739,  739,  739,  739,  739,  739,  739,  739,    1,    1,    1,    1,    1,    1,    1,    1,
+	 740,  740,  740,  740,  740,  740,  740,  740,  741,  741,  741,  741,  741,  741,  741,  741,
+	 742,  742,  742,  742,  742,  742,  742,  742,  743,  743,  743,  743,  743,  743,  743,  743,
+	 744,  744,  744,  744,  744,  744,  744,  744,  745,  746,  747,  748,  749,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 632,  632,  632,  632,  632,  632,  632,  632,    1,    1,    1,    1,    1,    1,    1,    1,
+	 633,  633,  633,  633,  633,  633,  633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
+	 635,  635,  635,  635,  635,  635,  635,  635,  636,  636,  636,  636,  636,  636,  636,  636,
+	 637,  637,  637,  637,  637,  637,  637,  637,  638,  639,  640,  641,  642,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 643,  643,  643,  643,  643,  643,  643,  643,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  644,  644,  644,  644,  644,  644,  644,  644,
+	 645,  645,  645,  645,  645,  645,  645,  645,  646,  647,  648,  649,    1,    1,    1,    1,
+	 750,  750,  750,  750,  750,  750,  750,  750,    1,    1,    1,    1,    1,    1,    1,    1,
+	 751,  751,  751,  751,  751,  751,  751,  751,  752,  752,  752,  752,  752,  752,  752,  753,
+	 754,  754,  754,  754,  754,  754,  754,  755,  756,  756,  756,  756,  756,  756,  756,  756,
+	 757,  757,  757,  757,  757,  757,  757,  757,  758,  759,    1,    1,    1,    1,    1,    1,
+	 760,  760,  760,  760,  760,  760,  760,  760,    1,    1,    1,    1,    1,    1,    1,    1,
+	 761,  761,  761,  761,  761,  761,  761,  761,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  762,  762,  762,  762,  762,  762,  762,  762,
+	 763,  763,  763,  763,  763,  763,  763,  763,  764,  765,  766,  767,    1,    1,    1,    1,
+	 768,  768,  768,  768,  768,  768,  768,  768,    1,    1,    1,    1,    1,    1,    1,    1,
+	 769,  769,  769,  769,  769,  769,  769,  769,    1,    1,    1,    1,    1,    1,    1,    1,
+	 770,  770,  770,  770,  770,  770,  770,  770,  771,  771,  771,  771,  771,  771,  771,  771,
+	 772,  772,  772,  772,  772,  772,  772,  772,  773,  774,    1,    1,    1,    1,    1,    1,
+	 775,  775,  775,  775,  775,  775,  775,  775,    1,    1,    1,    1,    1,    1,    1,    1,
+	 776,  776,  776,  776,  776,  776,  776,  776,    1,    1,    1,    1,    1,    1,    1,    1,
+	 777,  777,  777,  777,  777,  777,  777,  777,  778,  778,  778,  778,  778,  778,  778,  778,
+	 779,  779,  779,  779,  779,  779,  779,  779,  780,  781,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 632,  632,  632,  632,  632,  632,  632,  632,    1,    1,    1,    1,    1,    1,    1,    1,
+	 633,  633,  633,  633,  633,  633,  633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
+	 635,  635,  635,  635,  635,  635,  635,  635,  636,  636,  636,  636,  636,  636,  636,  636,
+	 637,  637,  637,  637,  637,  637,  637,  637,  638,  639,  640,  641,  642,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 643,  643,  643,  643,  643,  643,  643,  643,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  644,  644,  644,  644,  644,  644,  644,  644,
+	 645,  645,  645,  645,  645,  645,  645,  645,  646,  647,  648,  649,    1,    1,    1,    1,
+	 782,  782,  782,  782,  782,  782,  782,  782,    1,    1,    1,    1,    1,    1,    1,    1,
+	 783,  783,  783,  783,  783,  783,  783,  783,  784,  784,  784,  784,  784,  784,  784,  785,
+	 786,  786,  786,  786,  786,  786,  786,  787,  788,  788,  788,  788,  788,  788,  788,  788,
+	 789,  789,  789,  789,  789,  789,  789,  789,  790,  791,    1,    1,    1,    1,    1,    1,
+	 792,  792,  792,  792,  792,  792,  792,  792,    1,    1,    1,    1,    1,    1,    1,    1,
+	 793,  793,  793,  793,  793,  793,  793,  793,  794,  794,  794,  794,  794,  794,  794,  794,
+	 795,  795,  795,  795,  795,  795,  795,  795,  796,  796,  796,  796,  796,  796,  796,  796,
+	 797,  797,  797,  797,  797,  797,  797,  797,  798,  799,    1,    1,    1,    1,    1,    1,
+	 800,  800,  800,  800,  800,  800,  800,  800,    1,    1,    1,    1,    1,    1,    1,    1,
+	 801,  801,  801,  801,  801,  801,  801,  801,  802,  802,  802,  802,  802,  802,  802,  802,
+	 803,  803,  803,  803,  803,  803,  803,  803,  804,  804,  804,  804,  804,  804,  804,  804,
+	 805,  805,  805,  805,  805,  805,  805,  805,  806,  807,    1,    1,    1,    1,    1,    1,
+	 808,  808,  808,  808,  808,  808,  808,  808,    1,    1,    1,    1,    1,    1,    1,    1,
+	 809,  809,  809,  809,  809,  809,  809,  809,  810,  810,  810,  810,  810,  810,  810,  811,
+	 812,  812,  812,  812,  812,  812,  812,  813,  814,  814,  814,  814,  814,  814,  814,  814,
+	 815,  815,  815,  815,  815,  815,  815,  815,  816,  817,    1,    1,  818,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 632,  632,  632,  632,  632,  632,  632,  632,    1,    1,    1,    1,    1,    1,    1,    1,
+	 633,  633,  633,  633,  633,  633,  633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
+	 635,  635,  635,  635,  635,  635,  635,  635,  636,  636,  636,  636,  636,  636,  636,  636,
+	 637,  637,  637,  637,  637,  637,  637,  637,  638,  639,  640,  641,  642,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 643,  643,  643,  643,  643,  643,  643,  643,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  644,  644,  644,  644,  644,  644,  644,  644,
+	 645,  645,  645,  645,  645,  645,  645,  645,  646,  647,  648,  649,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 819,  819,  819,  819,  819,  819,  819,  819,  820,  820,  820,  820,  820,  820,  820,  820,
+	   1,    1,    1,    1,    1,    1,    1,    1,  821,  821,  821,  821,  821,  821,  821,  821,
+	 822,  822,  822,  822,  822,  822,  822,  822,  823,  824,  825,  826,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 827,  827,  827,  827,  827,  827,  827,  827,  828,  828,  828,  828,  828,  828,  828,  828,
+	   1,    1,    1,    1,    1,    1,    1,    1,  829,  829,  829,  829,  829,  829,  829,  829,
+	 830,  830,  830,  830,  830,  830,  830,  830,  831,  832,  833,  834,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 632,  632,  632,  632,  632,  632,  632,  632,    1,    1,    1,    1,    1,    1,    1,    1,
+	 633,  633,  633,  633,  633,  633,  633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
+	 635,  635,  635,  635,  635,  635,  635,  635,  636,  636,  636,  636,  636,  636,  636,  636,
+	 637,  637,  637,  637,  637,  637,  637,  637,  638,  639,  640,  641,  642,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 643,  643,  643,  643,  643,  643,  643,  643,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  644,  644,  644,  644,  644,  644,  644,  644,
+	 645,  645,  645,  645,  645,  645,  645,  645,  646,  647,  648,  649,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 835,  835,  835,  835,  835,  835,  835,  835,  835,  835,  835,  835,  835,  835,  835,  835,
+	 836,  836,  836,  836,  836,  836,  836,  837,  838,  838,  838,  838,  838,  838,  838,  839,
+	 840,  840,  840,  840,  840,  840,  840,  840,  841,  841,  841,  841,  841,  841,  841,  841,
+	 842,  843,  844,  845,    1,  846,  847,  848,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 849,  849,  849,  849,  849,  849,  849,  849,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  850,  850,  850,  850,  850,  850,  850,  850,
+	 851,  851,  851,  851,  851,  851,  851,  851,  852,  853,  854,  855,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 856,  856,  856,  856,  856,  856,  856,  856,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  857,  857,  857,  857,  857,  857,  857,  857,
+	 858,  858,  858,  858,  858,  858,  858,  858,  859,  860,  861,  862,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 632,  632,  632,  632,  632,  632,  632,  632,    1,    1,    1,    1,    1,    1,    1,    1,
+	 633,  633,  633,  633,  633,  633,  633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
+	 635,  635,  635,  635,  635,  635,  635,  635,  636,  636,  636,  636,  636,  636,  636,  636,
+	 637,  637,  637,  637,  637,  637,  637,  637,  638,  639,  640,  641,  642,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	 643,  643,  643,  643,  643,  643,  643,  643,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,  644,  644,  644,  644,  644,  644,  644,  644,
+	 645,  645,  645,  645,  645,  645,  645,  645,  646,  647,  648,  649,    1,    1,    1,    1,
+	 863,  863,  863,  863,  863,  863,  863,  863,    1,    1,    1,    1,    1,    1,    1,    1,
+	 864,  864,  864,  864,  864,  864,  864,  864,  865,  865,  865,  865,  865,  865,  865,  866,
+	 867,  867,  867,  867,  867,  867,  867,  868,  869,  869,  869,  869,  869,  869,  869,  869,
+	 870,  870,  870,  870,  870,  870,  870,  870,  871,  872,    1,    1,    1,    1,    1,    1,
+	 873,  873,  873,  873,  873,  873,  873,  873,  874,  874,  874,  874,  874,  874,  874,  874,
+	 875,  875,  875,  875,  875,  875,  875,  875,  876,  876,  876,  876,  876,  876,  876,  876,
+	 877,  877,  877,  877,  877,  877,  877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+	 879,  879,  879,  879,  879,  879,  879,  879,  880,  881,    1,    1,    1,    1,    1,    1,
+	 882,  882,  882,  882,  882,  882,  882,  882,  883,  883,  883,  883,  883,  883,  883,  883,
+	 884,  884,  884,  884,  884,  884,  884,  884,  885,  885,  885,  885,  885,  885,  885,  885,
+	 886,  886,  886,  886,  886,  886,  886,  886,  887,  887,  887,  887,  887,  887,  887,  887,
+	 888,  888,  888,  888,  888,  888,  888,  888,  889,  890,    1,    1,    1,    1,    1,    1,
+	 891,  891,  891,  891,  891,  891,  891,  891,  892,  892,  892,  892,  892,  892,  892,  892,
+	 893,  893,  893,  893,  893,  893,  893,  893,  894,  894,  894,  894,  894,  894,  894,  895,
+	 896,  896,  896,  896,  896,  896,  896,  897,  898,  898,  898,  898,  898,  898,  898,  898,
+	 899,  899,  899,  899,  899,  899,  899,  899,  900,  901,    1,    1,    1,    1,    1,    1,
+	 902,  902,  902,  902,  902,  902,  902,  902,    1,    1,    1,    1,    1,    1,    1,    1,
+	 903,  903,  903,  903,  903,  903,  903,  903,  904,  904,  904,  904,  904,  904,  904,  905,
+	 906,  906,  906,  906,  906,  906,  906,  907,  908,  908,  908,  908,  908,  908,  908,  908,
+	 909,  909,  909,  909,  909,  909,  909,  909,  910,  911,    1,    1,    1,    1,    1,    1,
+	 912,  912,  912,  912,  912,  912,  912,  912,  913,  913,  913,  913,  913,  913,  913,  913,
+	 914,  914,  914,  914,  914,  914,  914,  914,  915,  915,  915,  915,  915,  915,  915,  915,
+	 916,  916,  916,  916,  916,  916,  916,  916,  917,  917,  917,  917,  917,  917,  917,  917,
+	 918,  918,  918,  918,  918,  918,  918,  918,  919,  920,    1,    1,    1,    1,    1,    1,
+	 921,  921,  921,  921,  921,  921,  921,  921,  922,  922,  922,  922,  922,  922,  922,  922,
+	 923,  923,  923,  923,  923,  923,  923,  923,  924,  924,  924,  924,  924,  924,  924,  924,
+	 925,  925,  925,  925,  925,  925,  925,  925,  926,  926,  926,  926,  926,  926,  926,  926,
+	 927,  927,  927,  927,  927,  927,  927,  927,  928,  929,    1,    1,    1,    1,    1,    1,
+	 930,  930,  930,  930,  930,  930,  930,  930,  931,  931,  931,  931,  931,  931,  931,  931,
+	 932,  932,  932,  932,  932,  932,  932,  932,  933,  933,  933,  933,  933,  933,  933,  934,
+	 935,  935,  935,  935,  935,  935,  935,  936,  937,  937,  937,  937,  937,  937,  937,  937,
+	 938,  938,  938,  938,  938,  938,  938,  938,  939,  940,    1,    1,    1,    1,    1,    1,
+	 863,  863,  863,  863,  863,  863,  863,  863,    1,    1,    1,    1,    1,    1,    1,    1,
+	 864,  864,  864,  864,  864,  864,  864,  864,  865,  865,  865,  865,  865,  865,  865,  866,
+	 867,  867,  867,  867,  867,  867,  867,  868,  869,  869,  869,  869,  869,  869,  869,  869,
+	 870,  870,  870,  870,  870,  870,  870,  870,  871,  872,    1,    1,    1,    1,    1,    1,
+	 873,  873,  873,  873,  873,  873,  873,  873,  874,  874,  874,  874,  874,  874,  874,  874,
+	 875,  875,  875,  875,  875,  875,  875,  875,  876,  876,  876,  876,  876,  876,  876,  876,
+	 877,  877,  877,  877,  877,  877,  877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+	 879,  879,  879,  879,  879,  879,  879,  879,  880,  881,    1,    1,    1,    1,    1,    1,
+	 882,  882,  882,  882,  882,  882,  882,  882,  883,  883,  883,  883,  883,  883,  883,  883,
+	 884,  884,  884,  884,  884,  884,  884,  884,  885,  885,  885,  885,  885,  885,  885,  885,
+	 886,  886,  886,  886,  886,  886,  886,  886,  887,  887,  887,  887,  887,  887,  887,  887,
+	 888,  888,  888,  888,  888,  888,  888,  888,  889,  890,    1,    1,    1,    1,    1,    1,
+	 941,  941,  941,  941,  941,  941,  941,  941,  942,  942,  942,  942,  942,  942,  942,  942,
+	 943,  943,  943,  943,  943,  943,  943,  943,  944,  944,  944,  944,  944,  944,  944,  945,
+	 946,  946,  946,  946,  946,  946,  946,  947,  948,  948,  948,  948,  948,  948,  948,  948,
+	 949,  949,  949,  949,  949,  949,  949,  949,  950,  951,    1,    1,    1,    1,    1,    1,
+	 902,  902,  902,  902,  902,  902,  902,  902,    1,    1,    1,    1,    1,    1,    1,    1,
+	 903,  903,  903,  903,  903,  903,  903,  903,  904,  904,  904,  904,  904,  904,  904,  905,
+	 906,  906,  906,  906,  906,  906,  906,  907,  908,  908,  908,  908,  908,  908,  908,  908,
+	 909,  909,  909,  909,  909,  909,  909,  909,  910,  911,    1,    1,    1,    1,    1,    1,
+	 912,  912,  912,  912,  912,  912,  912,  912,  913,  913,  913,  913,  913,  913,  913,  913,
+	 914,  914,  914,  914,  914,  914,  914,  914,  915,  915,  915,  915,  915,  915,  915,  915,
+	 916,  916,  916,  916,  916,  916,  916,  916,  917,  917,  917,  917,  917,  917,  917,  917,
+	 918,  918,  918,  918,  918,  918,  918,  918,  919,  920,    1,    1,    1,    1,    1,    1,
+	 921,  921,  921,  921,  921,  921,  921,  921,  922,  922,  922,  922,  922,  922,  922,  922,
+	 923,  923,  923,  923,  923,  923,  923,  923,  924,  924,  924,  924,  924,  924,  924,  924,
+	 925,  925,  925,  925,  925,  925,  925,  925,  926,  926,  926,  926,  926,  926,  926,  926,
+	 927,  927,  927,  927,  927,  927,  927,  927,  928,  929,    1,    1,    1,    1,    1,    1,
+	 952,  952,  952,  952,  952,  952,  952,  952,  953,  953,  953,  953,  953,  953,  953,  953,
+	 954,  954,  954,  954,  954,  954,  954,  954,  955,  955,  955,  955,  955,  955,  955,  956,
+	 957,  957,  957,  957,  957,  957,  957,  958,  959,  959,  959,  959,  959,  959,  959,  959,
+	 960,  960,  960,  960,  960,  960,  960,  960,  961,  962,    1,    1,    1,    1,    1,    1,
+	 863,  863,  863,  863,  863,  863,  863,  863,    1,    1,    1,    1,    1,    1,    1,    1,
+	 864,  864,  864,  864,  864,  864,  864,  864,  865,  865,  865,  865,  865,  865,  865,  866,
+	 867,  867,  867,  867,  867,  867,  867,  868,  869,  869,  869,  869,  869,  869,  869,  869,
+	 870,  870,  870,  870,  870,  870,  870,  870,  871,  872,    1,    1,    1,    1,    1,    1,
+	 873,  873,  873,  873,  873,  873,  873,  873,  874,  874,  874,  874,  874,  874,  874,  874,
+	 875,  875,  875,  875,  875,  875,  875,  875,  876,  876,  876,  876,  876,  876,  876,  876,
+	 877,  877,  877,  877,  877,  877,  877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+	 879,  879,  879,  879,  879,  879,  879,  879,  880,  881,    1,    1,    1,    1,    1,    1,
+	 882,  882,  882,  882,  882,  882,  882,  882,  883,  883,  883,  883,  883,  883,  883,  883,
+	 884,  884,  884,  884,  884,  884,  884,  884,  885,  885,  885,  885,  885,  885,  885,  885,
+	 886,  886,  886,  886,  886,  886,  886,  886,  887,  887,  887,  887,  887,  887,  887,  887,
+	 888,  888,  888,  888,  888,  888,  888,  888,  889,  890,    1,    1,    1,    1,    1,    1,
+	 963,  963,  963,  963,  963,  963,  963,  963,  964,  964,  964,  964,  964,  964,  964,  964,
+	 965,  965,  965,  965,  965,  965,  965,  965,  966,  966,  966,  966,  966,  966,  966,  967,
+	 968,  968,  968,  968,  968,  968,  968,  969,  970,  970,  970,  970,  970,  970,  970,  970,
+	 971,  971,  971,  971,  971,  971,  971,  971,  972,  973,    1,    1,    1,    1,    1,    1,
+	 902,  902,  902,  902,  902,  902,  902,  902,    1,    1,    1,    1,    1,    1,    1,    1,
+	 903,  903,  903,  903,  903,  903,  903,  903,  904,  904,  904,  904,  904,  904,  904,  905,
+	 906,  906,  906,  906,  906,  906,  906,  907,  908,  908,  908,  908,  908,  908,  908,  908,
+	 909,  909,  909,  909,  909,  909,  909,  909,  910,  911,    1,    1,    1,    1,    1,    1,
+	 912,  912,  912,  912,  912,  912,  912,  912,  913,  913,  913,  913,  913,  913,  913,  913,
+	 914,  914,  914,  914,  914,  914,  914,  914,  915,  915,  915,  915,  915,  915,  915,  915,
+	 916,  916,  916,  916,  916,  916,  916,  916,  917,  917,  917,  917,  917,  917,  917,  917,
+	 918,  918,  918,  918,  918,  918,  918,  918,  919,  920,    1,    1,    1,    1,    1,    1,
+	 921,  921,  921,  921,  921,  921,  921,  921,  922,  922,  922,  922,  922,  922,  922,  922,
+	 923,  923,  923,  923,  923,  923,  923,  923,  924,  924,  924,  924,  924,  924,  924,  924,
+	 925,  925,  925,  925,  925,  925,  925,  925,  926,  926,  926,  926,  926,  926,  926,  926,
+	 927,  927,  927,  927,  927,  927,  927,  927,  928,  929,    1,    1,    1,    1,    1,    1,
+	 974,  974,  974,  974,  974,  974,  974,  974,  975,  975,  975,  975,  975,  975,  975,  975,
+	 976,  976,  976,  976,  976,  976,  976,  976,  977,  977,  977,  977,  977,  977,  977,  978,
+	 979,  979,  979,  979,  979,  979,  979,  980,  981,  981,  981,  981,  981,  981,  981,  981,
+	 982,  982,  982,  982,  982,  982,  982,  982,  983,  984,    1,    1,    1,    1,    1,    1,
+	 863,  863,  863,  863,  863,  863,  863,  863,    1,    1,    1,    1,    1,    1,    1,    1,
+	 864,  864,  864,  864,  864,  864,  864,  864,  865,  865,  865,  865,  865,  865,  865,  866,
+	 867,  867,  867,  867,  867,  867,  867,  868,  869,  869,  869,  869,  869,  869,  869,  869,
+	 870,  870,  870,  870,  870,  870,  870,  870,  871,  872,    1,    1,    1,    1,    1,    1,
+	 873,  873,  873,  873,  873,  873,  873,  873,  874,  874,  874,  874,  874,  874,  874,  874,
+	 875,  875,  875,  875,  875,  875,  875,  875,  876,  876,  876,  876,  876,  876,  876,  876,
+	 877,  877,  877,  877,  877,  877,  877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+	 879,  879,  879,  879,  879,  879,  879,  879,  880,  881,    1,    1,    1,    1,    1,    1,
+	 882,  882,  882,  882,  882,  882,  882,  882,  883,  883,  883,  883,  883,  883,  883,  883,
+	 884,  884,  884,  884,  884,  884,  884,  884,  885,  885,  885,  885,  885,  885,  885,  885,
+	 886,  886,  886,  886,  886,  886,  886,  886,  887,  887,  887,  887,  887,  887,  887,  887,
+	 888,  888,  888,  888,  888,  888,  888,  888,  889,  890,    1,    1,    1,    1,    1,    1,
+	 985,  985,  985,  985,  985,  985,  985,  985,  986,  986,  986,  986,  986,  986,  986,  986,
+	 987,  987,  987,  987,  987,  987,  987,  987,  988,  988,  988,  988,  988,  988,  988,  989,
+	 990,  990,  990,  990,  990,  990,  990,  991,  992,  992,  992,  992,  992,  992,  992,  992,
+	 993,  993,  993,  993,  993,  993,  993,  993,  994,  995,    1,    1,    1,    1,    1,    1,
+	 902,  902,  902,  902,  902,  902,  902,  902,    1,    1,    1,    1,    1,    1,    1,    1,
+	 903,  903,  903,  903,  903,  903,  903,  903,  904,  904,  904,  904,  904,  904,  904,  905,
+	 906,  906,  906,  906,  906,  906,  906,  907,  908,  908,  908,  908,  908,  908,  908,  908,
+	 909,  909,  909,  909,  909,  909,  909,  909,  910,  911,    1,    1,    1,    1,    1,    1,
+	 912,  912,  912,  912,  912,  912,  912,  912,  913,  913,  913,  913,  913,  913,  913,  913,
+	 914,  914,  914,  914,  914,  914,  914,  914,  915,  915,  915,  915,  915,  915,  915,  915,
+	 916,  916,  916,  916,  916,  916,  916,  916,  917,  917,  917,  917,  917,  917,  917,  917,
+	 918,  918,  918,  918,  918,  918,  918,  918,  919,  920,    1,    1,    1,    1,    1,    1,
+	 921,  921,  921,  921,  921,  921,  921,  921,  922,  922,  922,  922,  922,  922,  922,  922,
+	 923,  923,  923,  923,  923,  923,  923,  923,  924,  924,  924,  924,  924,  924,  924,  924,
+	 925,  925,  925,  925,  925,  925,  925,  925,  926,  926,  926,  926,  926,  926,  926,  926,
+	 927,  927,  927,  927,  927,  927,  927,  927,  928,  929,    1,    1,    1,    1,    1,    1,
+	 996,  996,  996,  996,  996,  996,  996,  996,  997,  997,  997,  997,  997,  997,  997,  997,
+	 998,  998,  998,  998,  998,  998,  998,  998,  999,  999,  999,  999,  999,  999,  999, 1000,
+	1001, 1001, 1001, 1001, 1001, 1001, 1001, 1002, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+	1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1005, 1006,    1,    1,    1,    1,    1,    1,
+	 863,  863,  863,  863,  863,  863,  863,  863,    1,    1,    1,    1,    1,    1,    1,    1,
+	 864,  864,  864,  864,  864,  864,  864,  864,  865,  865,  865,  865,  865,  865,  865,  866,
+	 867,  867,  867,  867,  867,  867,  867,  868,  869,  869,  869,  869,  869,  869,  869,  869,
+	 870,  870,  870,  870,  870,  870,  870,  870,  871,  872,    1,    1,    1,    1,    1,    1,
+	 873,  873,  873,  873,  873,  873,  873,  873,  874,  874,  874,  874,  874,  874,  874,  874,
+	 875,  875,  875,  875,  875,  875,  875,  875,  876,  876,  876,  876,  876,  876,  876,  876,
+	 877,  877,  877,  877,  877,  877,  877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+	 879,  879,  879,  879,  879,  879,  879,  879,  880,  881,    1,    1,    1,    1,    1,    1,
+	 882,  882,  882,  882,  882,  882,  882,  882,  883,  883,  883,  883,  883,  883,  883,  883,
+	 884,  884,  884,  884,  884,  884,  884,  884,  885,  885,  885,  885,  885,  885,  885,  885,
+	 886,  886,  886,  886,  886,  886,  886,  886,  887,  887,  887,  887,  887,  887,  887,  887,
+	 888,  888,  888,  888,  888,  888,  888,  888,  889,  890,    1,    1,    1,    1,    1,    1,
+	1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+	1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1011,
+	1012, 1012, 1012, 1012, 1012, 1012, 1012, 1013, 1014, 1014, 1014, 1014, 1014, 1014, 1014, 1014,
+	1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1016, 1017,    1,    1,    1,    1,    1,    1,
+	 902,  902,  902,  902,  902,  902,  902,  902,    1,    1,    1,    1,    1,    1,    1,    1,
+	 903,  903,  903,  903,  903,  903,  903,  903,  904,  904,  904,  904,  904,  904,  904,  905,
+	 906,  906,  906,  906,  906,  906,  906,  907,  908,  908,  908,  908,  908,  908,  908,  908,
+	 909,  909,  909,  909,  909,  909,  909,  909,  910,  911,    1,    1,    1,    1,    1,    1,
+	 912,  912,  912,  912,  912,  912,  912,  912,  913,  913,  913,  913,  913,  913,  913,  913,
+	 914,  914,  914,  914,  914,  914,  914,  914,  915,  915,  915,  915,  915,  915,  915,  915,
+	 916,  916,  916,  916,  916,  916,  916,  916,  917,  917,  917,  917,  917,  917,  917,  917,
+	 918,  918,  918,  918,  918,  918,  918,  918,  919,  920,    1,    1,    1,    1,    1,    1,
+	 921,  921,  921,  921,  921,  921,  921,  921,  922,  922,  922,  922,  922,  922,  922,  922,
+	 923,  923,  923,  923,  923,  923,  923,  923,  924,  924,  924,  924,  924,  924,  924,  924,
+	 925,  925,  925,  925,  925,  925,  925,  925,  926,  926,  926,  926,  926,  926,  926,  926,
+	 927,  927,  927,  927,  927,  927,  927,  927,  928,  929,    1,    1,    1,    1,    1,    1,
+	1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019,
+	1020, 1020, 1020, 1020, 1020, 1020, 1020, 1020, 1021, 1021, 1021, 1021, 1021, 1021, 1021, 1022,
+	1023, 1023, 1023, 1023, 1023, 1023, 1023, 1024, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025,
+	1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1027, 1028,    1,    1,    1,    1,    1,    1,
+	 863,  863,  863,  863,  863,  863,  863,  863,    1,    1,    1,    1,    1,    1,    1,    1,
+	 864,  864,  864,  864,  864,  864,  864,  864,  865,  865,  865,  865,  865,  865,  865,  866,
+	 867,  867,  867,  867,  867,  867,  867,  868,  869,  869,  869,  869,  869,  869,  869,  869,
+	 870,  870,  870,  870,  870,  870,  870,  870,  871,  872,    1,    1,    1,    1,    1,    1,
+	 873,  873,  873,  873,  873,  873,  873,  873,  874,  874,  874,  874,  874,  874,  874,  874,
+	 875,  875,  875,  875,  875,  875,  875,  875,  876,  876,  876,  876,  876,  876,  876,  876,
+	 877,  877,  877,  877,  877,  877,  877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+	 879,  879,  879,  879,  879,  879,  879,  879,  880,  881,    1,    1,    1,    1,    1,    1,
+	 882,  882,  882,  882,  882,  882,  882,  882,  883,  883,  883,  883,  883,  883,  883,  883,
+	 884,  884,  884,  884,  884,  884,  884,  884,  885,  885,  885,  885,  885,  885,  885,  885,
+	 886,  886,  886,  886,  886,  886,  886,  886,  887,  887,  887,  887,  887,  887,  887,  887,
+	 888,  888,  888,  888,  888,  888,  888,  888,  889,  890,    1,    1,    1,    1,    1,    1,
+	1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030,
+	1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1032, 1032, 1032, 1032, 1032, 1032, 1032, 1033,
+	1034, 1034, 1034, 1034, 1034, 1034, 1034, 1035, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036,
+	1037, 1037, 1037, 1037, 1037, 1037, 1037, 1037, 1038, 1039,    1,    1,    1,    1,    1,    1,
+	 902,  902,  902,  902,  902,  902,  902,  902,    1,    1,    1,    1,    1,    1,    1,    1,
+	 903,  903,  903,  903,  903,  903,  903,  903,  904,  904,  904,  904,  904,  904,  904,  905,
+	 906,  906,  906,  906,  906,  906,  906,  907,  908,  908,  908,  908,  908,  908,  908,  908,
+	 909,  909,  909,  909,  909,  909,  909,  909,  910,  911,    1,    1,    1,    1,    1,    1,
+	 912,  912,  912,  912,  912,  912,  912,  912,  913,  913,  913,  913,  913,  913,  913,  913,
+	 914,  914,  914,  914,  914,  914,  914,  914,  915,  915,  915,  915,  915,  915,  915,  915,
+	 916,  916,  916,  916,  916,  916,  916,  916,  917,  917,  917,  917,  917,  917,  917,  917,
+	 918,  918,  918,  918,  918,  918,  918,  918,  919,  920,    1,    1,    1,    1,    1,    1,
+	 921,  921,  921,  921,  921,  921,  921,  921,  922,  922,  922,  922,  922,  922,  922,  922,
+	 923,  923,  923,  923,  923,  923,  923,  923,  924,  924,  924,  924,  924,  924,  924,  924,
+	 925,  925,  925,  925,  925,  925,  925,  925,  926,  926,  926,  926,  926,  926,  926,  926,
+	 927,  927,  927,  927,  927,  927,  927,  927,  928,  929,    1,    1,    1,    1,    1,    1,
+	1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1041, 1041, 1041, 1041, 1041, 1041, 1041, 1041,
+	1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1043, 1043, 1043, 1043, 1043, 1043, 1043, 1044,
+	1045, 1045, 1045, 1045, 1045, 1045, 1045, 1046, 1047, 1047, 1047, 1047, 1047, 1047, 1047, 1047,
+	1048, 1048, 1048, 1048, 1048, 1048, 1048, 1048, 1049, 1050,    1,    1,    1,    1,    1,    1,
+	 863,  863,  863,  863,  863,  863,  863,  863,    1,    1,    1,    1,    1,    1,    1,    1,
+	 864,  864,  864,  864,  864,  864,  864,  864,  865,  865,  865,  865,  865,  865,  865,  866,
+	 867,  867,  867,  867,  867,  867,  867,  868,  869,  869,  869,  869,  869,  869,  869,  869,
+	 870,  870,  870,  870,  870,  870,  870,  870,  871,  872,    1,    1,    1,    1,    1,    1,
+	 873,  873,  873,  873,  873,  873,  873,  873,  874,  874,  874,  874,  874,  874,  874,  874,
+	 875,  875,  875,  875,  875,  875,  875,  875,  876,  876,  876,  876,  876,  876,  876,  876,
+	 877,  877,  877,  877,  877,  877,  877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+	 879,  879,  879,  879,  879,  879,  879,  879,  880,  881,    1,    1,    1,    1,    1,    1,
+	 882,  882,  882,  882,  882,  882,  882,  882,  883,  883,  883,  883,  883,  883,  883,  883,
+	 884,  884,  884,  884,  884,  884,  884,  884,  885,  885,  885,  885,  885,  885,  885,  885,
+	 886,  886,  886,  886,  886,  886,  886,  886,  887,  887,  887,  887,  887,  887,  887,  887,
+	 888,  888,  888,  888,  888,  888,  888,  888,  889,  890,    1,    1,    1,    1,    1,    1,
+	1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052,
+	1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1055,
+	1056, 1056, 1056, 1056, 1056, 1056, 1056, 1057, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058,
+	1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1060, 1061,    1,    1,    1,    1,    1,    1,
+	 902,  902,  902,  902,  902,  902,  902,  902,    1,    1,    1,    1,    1,    1,    1,    1,
+	 903,  903,  903,  903,  903,  903,  903,  903,  904,  904,  904,  904,  904,  904,  904,  905,
+	 906,  906,  906,  906,  906,  906,  906,  907,  908,  908,  908,  908,  908,  908,  908,  908,
+	 909,  909,  909,  909,  909,  909,  909,  909,  910,  911,    1,    1,    1,    1,    1,    1,
+	 912,  912,  912,  912,  912,  912,  912,  912,  913,  913,  913,  913,  913,  913,  913,  913,
+	 914,  914,  914,  914,  914,  914,  914,  914,  915,  915,  915,  915,  915,  915,  915,  915,
+	 916,  916,  916,  916,  916,  916,  916,  916,  917,  917,  917,  917,  917,  917,  917,  917,
+	 918,  918,  918,  918,  918,  918,  918,  918,  919,  920,    1,    1,    1,    1,    1,    1,
+	 921,  921,  921,  921,  921,  921,  921,  921,  922,  922,  922,  922,  922,  922,  922,  922,
+	 923,  923,  923,  923,  923,  923,  923,  923,  924,  924,  924,  924,  924,  924,  924,  924,
+	 925,  925,  925,  925,  925,  925,  925,  925,  926,  926,  926,  926,  926,  926,  926,  926,
+	 927,  927,  927,  927,  927,  927,  927,  927,  928,  929,    1,    1,    1,    1,    1,    1,
+	1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063,
+	1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1065, 1065, 1065, 1065, 1065, 1065, 1065, 1066,
+	1067, 1067, 1067, 1067, 1067, 1067, 1067, 1068, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069,
+	1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1071, 1072,    1,    1,    1,    1,    1,    1,
+	 863,  863,  863,  863,  863,  863,  863,  863,    1,    1,    1,    1,    1,    1,    1,    1,
+	 864,  864,  864,  864,  864,  864,  864,  864,  865,  865,  865,  865,  865,  865,  865,  866,
+	 867,  867,  867,  867,  867,  867,  867,  868,  869,  869,  869,  869,  869,  869,  869,  869,
+	 870,  870,  870,  870,  870,  870,  870,  870,  871,  872,    1,    1,    1,    1,    1,    1,
+	 873,  873,  873,  873,  873,  873,  873,  873,  874,  874,  874,  874,  874,  874,  874,  874,
+	 875,  875,  875,  875,  875,  875,  875,  875,  876,  876,  876,  876,  876,  876,  876,  876,
+	 877,  877,  877,  877,  877,  877,  877,  877,  878,  878,  878,  878,  878,  878,  878,  878,
+	 879,  879,  879,  879,  879,  879,  879,  879,  880,  881,    1,    1,    1,    1,    1,    1,
+	 882,  882,  882,  882,  882,  882,  882,  882,  883,  883,  883,  883,  883,  883,  883,  883,
+	 884,  884,  884,  884,  884,  884,  884,  884,  885,  885,  885,  885,  885,  885,  885,  885,
+	 886,  886,  886,  886,  886,  886,  886,  886,  887,  887,  887,  887,  887,  887,  887,  887,
+	 888,  888,  888,  888,  888,  888,  888,  888,  889,  890,    1,    1,    1,    1,    1,    1,
+	1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074,
+	1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1076, 1076, 1076, 1076, 1076, 1076, 1076, 1077,
+	1078, 1078, 1078, 1078, 1078, 1078, 1078, 1079, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+	1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1082, 1083,    1,    1,    1,    1,    1,    1,
+	 902,  902,  902,  902,  902,  902,  902,  902,    1,    1,    1,    1,    1,    1,    1,    1,
+	 903,  903,  903,  903,  903,  903,  903,  903,  904,  904,  904,  904,  904,  904,  904,  905,
+	 906,  906,  906,  906,  906,  906,  906,  907,  908,  908,  908,  908,  908,  908,  908,  908,
+	 909,  909,  909,  909,  909,  909,  909,  909,  910,  911,    1,    1,    1,    1,    1,    1,
+	 912,  912,  912,  912,  912,  912,  912,  912,  913,  913,  913,  913,  913,  913,  913,  913,
+	 914,  914,  914,  914,  914,  914,  914,  914,  915,  915,  915,  915,  915,  915,  915,  915,
+	 916,  916,  916,  916,  916,  916,  916,  916,  917,  917,  917,  917,  917,  917,  917,  917,
+	 918,  918,  918,  918,  918,  918,  918,  918,  919,  920,    1,    1,    1,    1,    1,    1,
+	 921,  921,  921,  921,  921,  921,  921,  921,  922,  922,  922,  922,  922,  922,  922,  922,
+	 923,  923,  923,  923,  923,  923,  923,  923,  924,  924,  924,  924,  924,  924,  924,  924,
+	 925,  925,  925,  925,  925,  925,  925,  925,  926,  926,  926,  926,  926,  926,  926,  926,
+	 927,  927,  927,  927,  927,  927,  927,  927,  928,  929,    1,    1,    1,    1,    1,    1,
+	1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
+	1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1088,
+	1089, 1089, 1089, 1089, 1089, 1089, 1089, 1090, 1091, 1091, 1091, 1091, 1091, 1091, 1091, 1091,
+	1092, 1092, 1092, 1092, 1092, 1092, 1092, 1092, 1093, 1094,    1,    1,    1,    1,    1,    1,
+	1095, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,
+	1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096, 1096,    1,
+	1097, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+	1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,    1,
+	1099, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,
+	1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100, 1100,    1,
+	1101, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,
+	1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102, 1102,    1,
+	1103, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+	1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,    1,
+	1105, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,
+	1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106, 1106,    1,
+	1107, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,
+	1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108, 1108,    1,
+	1109, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+	1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,    1,
+	1111, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,
+	1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112, 1112,    1,
+	1113, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,
+	1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114, 1114,    1,
+	1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+	1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,    1,
+	1117, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
+	1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,    1,
+	1119, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+	1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,    1,
+	1121, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+	1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,    1,
+	1123, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,
+	1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124, 1124,    1,
+	1125, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,
+	1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126, 1126,    1,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127, 1127,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,    1,    1,    1,    1,    1,    1,    1,    1,
+	1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+	1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1139, 1140,    1,    1,    1,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141,    1,    1,    1,    1,    1,    1,    1,    1,
+	1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+	1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+	1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1147, 1148, 1149, 1150, 1151,    1,    1,    1,
+	1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,    1,    1,    1,    1,    1,    1,    1,    1,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
+	1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1159, 1160, 1161, 1162,    1,    1,    1,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163,    1,    1,    1,    1,    1,    1,    1,    1,
+	1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
+	1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+	1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1170, 1171, 1172, 1173,    1,    1,    1,
+	1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1179,
+	1180, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+	1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184, 1185,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187,
+	1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189,
+	1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1192,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194,
+	1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+	1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1198, 1199,    1,    1,    1,    1,    1,    1,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,    1,    1,    1,    1,    1,    1,    1,    1,
+	1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1207, 1208, 1209, 1210,    1,    1,    1,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,    1,    1,    1,    1,    1,    1,    1,    1,
+	1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+	1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1139, 1140,    1,    1,    1,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141,    1,    1,    1,    1,    1,    1,    1,    1,
+	1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+	1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+	1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1147, 1148, 1149, 1150, 1151,    1,    1,    1,
+	1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,    1,    1,    1,    1,    1,    1,    1,    1,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
+	1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1159, 1160, 1161, 1162,    1,    1,    1,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163,    1,    1,    1,    1,    1,    1,    1,    1,
+	1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
+	1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+	1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1170, 1171, 1172, 1173,    1,    1,    1,
+	1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1179,
+	1180, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+	1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184, 1185,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187,
+	1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189,
+	1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1192,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194,
+	1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+	1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1198, 1199,    1,    1,    1,    1,    1,    1,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,    1,    1,    1,    1,    1,    1,    1,    1,
+	1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1207, 1208, 1209, 1210,    1,    1,    1,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,    1,    1,    1,    1,    1,    1,    1,    1,
+	1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+	1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1139, 1140,    1,    1,    1,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141,    1,    1,    1,    1,    1,    1,    1,    1,
+	1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+	1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+	1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1147, 1148, 1149, 1150, 1151,    1,    1,    1,
+	1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,    1,    1,    1,    1,    1,    1,    1,    1,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
+	1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1159, 1160, 1161, 1162,    1,    1,    1,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163,    1,    1,    1,    1,    1,    1,    1,    1,
+	1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
+	1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+	1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1170, 1171, 1172, 1173,    1,    1,    1,
+	1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1179,
+	1180, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+	1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184, 1185,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187,
+	1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189,
+	1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1192,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194,
+	1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+	1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1198, 1199,    1,    1,    1,    1,    1,    1,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,    1,    1,    1,    1,    1,    1,    1,    1,
+	1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1207, 1208, 1209, 1210,    1,    1,    1,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,    1,    1,    1,    1,    1,    1,    1,    1,
+	1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+	1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1139, 1140,    1,    1,    1,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141,    1,    1,    1,    1,    1,    1,    1,    1,
+	1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+	1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+	1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1147, 1148, 1149, 1150, 1151,    1,    1,    1,
+	1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,    1,    1,    1,    1,    1,    1,    1,    1,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
+	1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1159, 1160, 1161, 1162,    1,    1,    1,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163,    1,    1,    1,    1,    1,    1,    1,    1,
+	1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
+	1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+	1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1170, 1171, 1172, 1173,    1,    1,    1,
+	1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1179,
+	1180, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+	1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184, 1185,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187,
+	1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189,
+	1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1192,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194,
+	1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+	1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1198, 1199,    1,    1,    1,    1,    1,    1,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,    1,    1,    1,    1,    1,    1,    1,    1,
+	1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1207, 1208, 1209, 1210,    1,    1,    1,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,    1,    1,    1,    1,    1,    1,    1,    1,
+	1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+	1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1139, 1140,    1,    1,    1,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141,    1,    1,    1,    1,    1,    1,    1,    1,
+	1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+	1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+	1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1147, 1148, 1149, 1150, 1151,    1,    1,    1,
+	1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,    1,    1,    1,    1,    1,    1,    1,    1,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
+	1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1159, 1160, 1161, 1162,    1,    1,    1,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163,    1,    1,    1,    1,    1,    1,    1,    1,
+	1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
+	1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+	1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1170, 1171, 1172, 1173,    1,    1,    1,
+	1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1179,
+	1180, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+	1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184, 1185,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187,
+	1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189,
+	1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1192,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194,
+	1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+	1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1198, 1199,    1,    1,    1,    1,    1,    1,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,    1,    1,    1,    1,    1,    1,    1,    1,
+	1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1207, 1208, 1209, 1210,    1,    1,    1,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,    1,    1,    1,    1,    1,    1,    1,    1,
+	1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+	1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1139, 1140,    1,    1,    1,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141,    1,    1,    1,    1,    1,    1,    1,    1,
+	1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+	1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+	1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1147, 1148, 1149, 1150, 1151,    1,    1,    1,
+	1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,    1,    1,    1,    1,    1,    1,    1,    1,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
+	1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1159, 1160, 1161, 1162,    1,    1,    1,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163,    1,    1,    1,    1,    1,    1,    1,    1,
+	1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
+	1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+	1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1170, 1171, 1172, 1173,    1,    1,    1,
+	1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1179,
+	1180, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+	1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184, 1185,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187,
+	1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189,
+	1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1192,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194,
+	1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+	1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1198, 1199,    1,    1,    1,    1,    1,    1,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,    1,    1,    1,    1,    1,    1,    1,    1,
+	1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1207, 1208, 1209, 1210,    1,    1,    1,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,    1,    1,    1,    1,    1,    1,    1,    1,
+	1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+	1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1139, 1140,    1,    1,    1,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141,    1,    1,    1,    1,    1,    1,    1,    1,
+	1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+	1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+	1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1147, 1148, 1149, 1150, 1151,    1,    1,    1,
+	1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,    1,    1,    1,    1,    1,    1,    1,    1,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
+	1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1159, 1160, 1161, 1162,    1,    1,    1,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163,    1,    1,    1,    1,    1,    1,    1,    1,
+	1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
+	1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+	1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1170, 1171, 1172, 1173,    1,    1,    1,
+	1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1175, 1175, 1175, 1175, 1175, 1175, 1175, 1176,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1179,
+	1180, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+	1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184, 1185,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187,
+	1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189,
+	1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1192,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194,
+	1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+	1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1198, 1199,    1,    1,    1,    1,    1,    1,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,    1,    1,    1,    1,    1,    1,    1,    1,
+	1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1207, 1208, 1209, 1210,    1,    1,    1,
+	1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,    1,    1,    1,    1,    1,    1,    1,    1,
+	1129, 1129, 1129, 1129, 1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130, 1130, 1131,
+	1132, 1132, 1132, 1132, 1132, 1132, 1132, 1133, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+	1135, 1135, 1135, 1135, 1135, 1135, 1135, 1135, 1136, 1137, 1138, 1139, 1140,    1,    1,    1,
+	1141, 1141, 1141, 1141, 1141, 1141, 1141, 1141,    1,    1,    1,    1,    1,    1,    1,    1,
+	1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,
+	1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1145,
+	1146, 1146, 1146, 1146, 1146, 1146, 1146, 1146, 1147, 1148, 1149, 1150, 1151,    1,    1,    1,
+	1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,    1,    1,    1,    1,    1,    1,    1,    1,
+	1153, 1153, 1153, 1153, 1153, 1153, 1153, 1153, 1154, 1154, 1154, 1154, 1154, 1154, 1154, 1154,
+	1155, 1155, 1155, 1155, 1155, 1155, 1155, 1155, 1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,
+	1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1159, 1160, 1161, 1162,    1,    1,    1,
+	1163, 1163, 1163, 1163, 1163, 1163, 1163, 1163,    1,    1,    1,    1,    1,    1,    1,    1,
+	1164, 1164, 1164, 1164, 1164, 1164, 1164, 1164, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
+	1166, 1166, 1166, 1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,
+	1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1170, 1171, 1172, 1173,    1,    1,    1,
+	1174, 1174, 1174, 1174, 1174, 1174, 1174, 1174, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1212,
+	1177, 1177, 1177, 1177, 1177, 1177, 1177, 1177, 1178, 1178, 1178, 1178, 1178, 1178, 1178, 1179,
+	1180, 1180, 1180, 1180, 1180, 1180, 1180, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+	1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184, 1185,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1186, 1186, 1186, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187, 1187, 1187, 1187, 1187,
+	1188, 1188, 1188, 1188, 1188, 1188, 1188, 1188, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189,
+	1190, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191, 1192,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1193, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1194, 1194, 1194, 1194, 1194, 1194, 1194, 1194,
+	1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+	1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1198, 1199,    1,    1,    1,    1,    1,    1,
+	1200, 1200, 1200, 1200, 1200, 1200, 1200, 1200,    1,    1,    1,    1,    1,    1,    1,    1,
+	1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+	1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+	1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1207, 1208, 1209, 1210,    1,    1,    1,
+	1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,    1,    1,    1,    1,    1,    1,    1,    1,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216,
+	1217, 1217, 1217, 1217, 1217, 1217, 1217, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+	1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1223, 1224, 1225,    1,    1,    1,
+	1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+	1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
+	1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231,
+	1232, 1232, 1232, 1232, 1232, 1232, 1232, 1232, 1233, 1234, 1235, 1236, 1237,    1,    1,    1,
+	1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+	1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+	1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+	1244, 1244, 1244, 1244, 1244, 1244, 1244, 1244, 1245, 1246, 1247, 1248, 1249,    1,    1,    1,
+	1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251,
+	1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253,
+	1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+	1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1257, 1258, 1259, 1260, 1261,    1,    1,    1,
+	1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1267,
+	1268, 1268, 1268, 1268, 1268, 1268, 1268, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1270, 1270,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1273,    1,    1,    1,    1,    1,    1,
+	1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275,
+	1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277,
+	1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1279, 1279,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1282,    1,    1,    1,    1,    1,    1,
+	1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
+	1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286,
+	1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1291,    1,    1,    1,    1,    1,    1,
+	1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+	1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295,
+	1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1300, 1301, 1302, 1303,    1,    1,    1,
+	1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,    1,    1,    1,    1,    1,    1,    1,    1,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216,
+	1217, 1217, 1217, 1217, 1217, 1217, 1217, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+	1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1223, 1224, 1225,    1,    1,    1,
+	1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+	1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
+	1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231,
+	1232, 1232, 1232, 1232, 1232, 1232, 1232, 1232, 1233, 1234, 1235, 1236, 1237,    1,    1,    1,
+	1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+	1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+	1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+	1244, 1244, 1244, 1244, 1244, 1244, 1244, 1244, 1245, 1246, 1247, 1248, 1249,    1,    1,    1,
+	1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251,
+	1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253,
+	1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+	1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1257, 1258, 1259, 1260, 1261,    1,    1,    1,
+	1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1267,
+	1268, 1268, 1268, 1268, 1268, 1268, 1268, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1270, 1270,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1273,    1,    1,    1,    1,    1,    1,
+	1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275,
+	1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277,
+	1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1279, 1279,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1282,    1,    1,    1,    1,    1,    1,
+	1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
+	1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286,
+	1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1291,    1,    1,    1,    1,    1,    1,
+	1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+	1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295,
+	1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1300, 1301, 1302, 1303,    1,    1,    1,
+	1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,    1,    1,    1,    1,    1,    1,    1,    1,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216,
+	1217, 1217, 1217, 1217, 1217, 1217, 1217, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+	1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1223, 1224, 1225,    1,    1,    1,
+	1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+	1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
+	1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231,
+	1232, 1232, 1232, 1232, 1232, 1232, 1232, 1232, 1233, 1234, 1235, 1236, 1237,    1,    1,    1,
+	1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+	1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+	1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+	1244, 1244, 1244, 1244, 1244, 1244, 1244, 1244, 1245, 1246, 1247, 1248, 1249,    1,    1,    1,
+	1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251,
+	1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253,
+	1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+	1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1257, 1258, 1259, 1260, 1261,    1,    1,    1,
+	1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1267,
+	1268, 1268, 1268, 1268, 1268, 1268, 1268, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1270, 1270,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1273,    1,    1,    1,    1,    1,    1,
+	1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275,
+	1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277,
+	1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1279, 1279,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1282,    1,    1,    1,    1,    1,    1,
+	1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
+	1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286,
+	1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1291,    1,    1,    1,    1,    1,    1,
+	1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+	1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295,
+	1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1300, 1301, 1302, 1303,    1,    1,    1,
+	1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,    1,    1,    1,    1,    1,    1,    1,    1,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216,
+	1217, 1217, 1217, 1217, 1217, 1217, 1217, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+	1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1223, 1224, 1225,    1,    1,    1,
+	1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+	1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
+	1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231,
+	1232, 1232, 1232, 1232, 1232, 1232, 1232, 1232, 1233, 1234, 1235, 1236, 1237,    1,    1,    1,
+	1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+	1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+	1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+	1244, 1244, 1244, 1244, 1244, 1244, 1244, 1244, 1245, 1246, 1247, 1248, 1249,    1,    1,    1,
+	1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251,
+	1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253,
+	1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+	1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1257, 1258, 1259, 1260, 1261,    1,    1,    1,
+	1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1267,
+	1268, 1268, 1268, 1268, 1268, 1268, 1268, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1270, 1270,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1273,    1,    1,    1,    1,    1,    1,
+	1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275,
+	1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277,
+	1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1279, 1279,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1282,    1,    1,    1,    1,    1,    1,
+	1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
+	1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286,
+	1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1291,    1,    1,    1,    1,    1,    1,
+	1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+	1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295,
+	1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1300, 1301, 1302, 1303,    1,    1,    1,
+	1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,    1,    1,    1,    1,    1,    1,    1,    1,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216,
+	1217, 1217, 1217, 1217, 1217, 1217, 1217, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+	1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1223, 1224, 1225,    1,    1,    1,
+	1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+	1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
+	1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231,
+	1232, 1232, 1232, 1232, 1232, 1232, 1232, 1232, 1233, 1234, 1235, 1236, 1237,    1,    1,    1,
+	1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+	1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+	1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+	1244, 1244, 1244, 1244, 1244, 1244, 1244, 1244, 1245, 1246, 1247, 1248, 1249,    1,    1,    1,
+	1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251,
+	1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253,
+	1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+	1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1257, 1258, 1259, 1260, 1261,    1,    1,    1,
+	1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1267,
+	1268, 1268, 1268, 1268, 1268, 1268, 1268, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1270, 1270,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1273,    1,    1,    1,    1,    1,    1,
+	1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275,
+	1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277,
+	1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1279, 1279,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1282,    1,    1,    1,    1,    1,    1,
+	1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
+	1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286,
+	1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1291,    1,    1,    1,    1,    1,    1,
+	1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+	1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295,
+	1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1300, 1301, 1302, 1303,    1,    1,    1,
+	1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,    1,    1,    1,    1,    1,    1,    1,    1,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216,
+	1217, 1217, 1217, 1217, 1217, 1217, 1217, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+	1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1223, 1224, 1225,    1,    1,    1,
+	1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+	1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
+	1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231,
+	1232, 1232, 1232, 1232, 1232, 1232, 1232, 1232, 1233, 1234, 1235, 1236, 1237,    1,    1,    1,
+	1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+	1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+	1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+	1244, 1244, 1244, 1244, 1244, 1244, 1244, 1244, 1245, 1246, 1247, 1248, 1249,    1,    1,    1,
+	1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251,
+	1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253,
+	1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+	1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1257, 1258, 1259, 1260, 1261,    1,    1,    1,
+	1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1267,
+	1268, 1268, 1268, 1268, 1268, 1268, 1268, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1270, 1270,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1273,    1,    1,    1,    1,    1,    1,
+	1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275,
+	1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277,
+	1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1279, 1279,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1282,    1,    1,    1,    1,    1,    1,
+	1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
+	1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286,
+	1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1291,    1,    1,    1,    1,    1,    1,
+	1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+	1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295,
+	1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1300, 1301, 1302, 1303,    1,    1,    1,
+	1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,    1,    1,    1,    1,    1,    1,    1,    1,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216,
+	1217, 1217, 1217, 1217, 1217, 1217, 1217, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+	1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1223, 1224, 1225,    1,    1,    1,
+	1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+	1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
+	1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231,
+	1232, 1232, 1232, 1232, 1232, 1232, 1232, 1232, 1233, 1234, 1235, 1236, 1237,    1,    1,    1,
+	1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+	1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+	1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+	1244, 1244, 1244, 1244, 1244, 1244, 1244, 1244, 1245, 1246, 1247, 1248, 1249,    1,    1,    1,
+	1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251,
+	1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253,
+	1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+	1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1257, 1258, 1259, 1260, 1261,    1,    1,    1,
+	1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1264,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1267,
+	1268, 1268, 1268, 1268, 1268, 1268, 1268, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1270, 1270,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1273,    1,    1,    1,    1,    1,    1,
+	1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275,
+	1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277,
+	1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1279, 1279,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1282,    1,    1,    1,    1,    1,    1,
+	1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
+	1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286,
+	1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1291,    1,    1,    1,    1,    1,    1,
+	1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+	1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295,
+	1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1300, 1301, 1302, 1303,    1,    1,    1,
+	1213, 1213, 1213, 1213, 1213, 1213, 1213, 1213,    1,    1,    1,    1,    1,    1,    1,    1,
+	1214, 1214, 1214, 1214, 1214, 1214, 1214, 1214, 1215, 1215, 1215, 1215, 1215, 1215, 1215, 1216,
+	1217, 1217, 1217, 1217, 1217, 1217, 1217, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+	1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1223, 1224, 1225,    1,    1,    1,
+	1226, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227, 1227, 1227, 1227, 1227, 1227, 1227, 1227,
+	1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229,
+	1230, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231, 1231, 1231, 1231, 1231, 1231, 1231, 1231,
+	1232, 1232, 1232, 1232, 1232, 1232, 1232, 1232, 1233, 1234, 1235, 1236, 1237,    1,    1,    1,
+	1238, 1238, 1238, 1238, 1238, 1238, 1238, 1238, 1239, 1239, 1239, 1239, 1239, 1239, 1239, 1239,
+	1240, 1240, 1240, 1240, 1240, 1240, 1240, 1240, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241,
+	1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+	1244, 1244, 1244, 1244, 1244, 1244, 1244, 1244, 1245, 1246, 1247, 1248, 1249,    1,    1,    1,
+	1250, 1250, 1250, 1250, 1250, 1250, 1250, 1250, 1251, 1251, 1251, 1251, 1251, 1251, 1251, 1251,
+	1252, 1252, 1252, 1252, 1252, 1252, 1252, 1252, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253,
+	1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+	1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1257, 1258, 1259, 1260, 1261,    1,    1,    1,
+	1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305,
+	1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1267,
+	1268, 1268, 1268, 1268, 1268, 1268, 1268, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1270, 1270,
+	1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1273,    1,    1,    1,    1,    1,    1,
+	1274, 1274, 1274, 1274, 1274, 1274, 1274, 1274, 1275, 1275, 1275, 1275, 1275, 1275, 1275, 1275,
+	1276, 1276, 1276, 1276, 1276, 1276, 1276, 1276, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277,
+	1278, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279, 1279, 1279, 1279, 1279, 1279, 1279, 1279,
+	1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1282,    1,    1,    1,    1,    1,    1,
+	1283, 1283, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1284, 1284, 1284, 1284, 1284, 1284, 1284,
+	1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286,
+	1287, 1287, 1287, 1287, 1287, 1287, 1287, 1287, 1288, 1288, 1288, 1288, 1288, 1288, 1288, 1288,
+	1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1291,    1,    1,    1,    1,    1,    1,
+	1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293,
+	1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295,
+	1296, 1296, 1296, 1296, 1296, 1296, 1296, 1296, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
+	1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1300, 1301, 1302, 1303,    1,    1,    1,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
+	1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,    1,    1,    1,    1,    1,    1,    1,    1,
+	1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1310,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
+	1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1315, 1316, 1317, 1318, 1319,    1,    1,    1,
+	1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331,    1,    1,    1,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
+	1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
+	1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337,
+	1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1339, 1340, 1341, 1342, 1343,    1,    1,    1,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+	1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1351, 1352, 1353, 1354, 1355,    1,    1,    1,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1358,
+	1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361,
+	1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1367,    1,    1,    1,    1,    1,    1,
+	1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369,
+	1370, 1370, 1370, 1370, 1370, 1370, 1370, 1370, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+	1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+	1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1376,    1,    1,    1,    1,    1,    1,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+	1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1385,    1,    1,    1,    1,    1,    1,
+	1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+	1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389,
+	1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1394, 1395, 1396, 1397,    1,    1,    1,
+	1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,    1,    1,    1,    1,    1,    1,    1,    1,
+	1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1310,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
+	1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1315, 1316, 1317, 1318, 1319,    1,    1,    1,
+	1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331,    1,    1,    1,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
+	1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
+	1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337,
+	1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1339, 1340, 1341, 1342, 1343,    1,    1,    1,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+	1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1351, 1352, 1353, 1354, 1355,    1,    1,    1,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1358,
+	1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361,
+	1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1367,    1,    1,    1,    1,    1,    1,
+	1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369,
+	1370, 1370, 1370, 1370, 1370, 1370, 1370, 1370, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+	1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+	1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1376,    1,    1,    1,    1,    1,    1,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+	1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1385,    1,    1,    1,    1,    1,    1,
+	1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+	1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389,
+	1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1394, 1395, 1396, 1397,    1,    1,    1,
+	1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,    1,    1,    1,    1,    1,    1,    1,    1,
+	1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1310,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
+	1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1315, 1316, 1317, 1318, 1319,    1,    1,    1,
+	1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331,    1,    1,    1,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
+	1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
+	1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337,
+	1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1339, 1340, 1341, 1342, 1343,    1,    1,    1,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+	1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1351, 1352, 1353, 1354, 1355,    1,    1,    1,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1358,
+	1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361,
+	1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1367,    1,    1,    1,    1,    1,    1,
+	1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369,
+	1370, 1370, 1370, 1370, 1370, 1370, 1370, 1370, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+	1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+	1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1376,    1,    1,    1,    1,    1,    1,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+	1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1385,    1,    1,    1,    1,    1,    1,
+	1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+	1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389,
+	1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1394, 1395, 1396, 1397,    1,    1,    1,
+	1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,    1,    1,    1,    1,    1,    1,    1,    1,
+	1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1310,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
+	1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1315, 1316, 1317, 1318, 1319,    1,    1,    1,
+	1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331,    1,    1,    1,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
+	1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
+	1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337,
+	1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1339, 1340, 1341, 1342, 1343,    1,    1,    1,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+	1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1351, 1352, 1353, 1354, 1355,    1,    1,    1,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1358,
+	1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361,
+	1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1367,    1,    1,    1,    1,    1,    1,
+	1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369,
+	1370, 1370, 1370, 1370, 1370, 1370, 1370, 1370, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+	1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+	1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1376,    1,    1,    1,    1,    1,    1,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+	1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1385,    1,    1,    1,    1,    1,    1,
+	1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+	1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389,
+	1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1394, 1395, 1396, 1397,    1,    1,    1,
+	1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,    1,    1,    1,    1,    1,    1,    1,    1,
+	1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1310,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
+	1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1315, 1316, 1317, 1318, 1319,    1,    1,    1,
+	1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331,    1,    1,    1,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
+	1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
+	1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337,
+	1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1339, 1340, 1341, 1342, 1343,    1,    1,    1,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+	1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1351, 1352, 1353, 1354, 1355,    1,    1,    1,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1358,
+	1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361,
+	1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1367,    1,    1,    1,    1,    1,    1,
+	1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369,
+	1370, 1370, 1370, 1370, 1370, 1370, 1370, 1370, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+	1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+	1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1376,    1,    1,    1,    1,    1,    1,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+	1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1385,    1,    1,    1,    1,    1,    1,
+	1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+	1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389,
+	1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1394, 1395, 1396, 1397,    1,    1,    1,
+	1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,    1,    1,    1,    1,    1,    1,    1,    1,
+	1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1310,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
+	1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1315, 1316, 1317, 1318, 1319,    1,    1,    1,
+	1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331,    1,    1,    1,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
+	1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
+	1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337,
+	1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1339, 1340, 1341, 1342, 1343,    1,    1,    1,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+	1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1351, 1352, 1353, 1354, 1355,    1,    1,    1,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1358,
+	1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361,
+	1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1367,    1,    1,    1,    1,    1,    1,
+	1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369,
+	1370, 1370, 1370, 1370, 1370, 1370, 1370, 1370, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+	1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+	1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1376,    1,    1,    1,    1,    1,    1,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+	1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1385,    1,    1,    1,    1,    1,    1,
+	1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+	1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389,
+	1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1394, 1395, 1396, 1397,    1,    1,    1,
+	1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,    1,    1,    1,    1,    1,    1,    1,    1,
+	1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1310,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
+	1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1315, 1316, 1317, 1318, 1319,    1,    1,    1,
+	1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331,    1,    1,    1,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
+	1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
+	1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337,
+	1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1339, 1340, 1341, 1342, 1343,    1,    1,    1,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+	1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1351, 1352, 1353, 1354, 1355,    1,    1,    1,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1357, 1357, 1357, 1357, 1357, 1357, 1357, 1358,
+	1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361,
+	1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1367,    1,    1,    1,    1,    1,    1,
+	1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369,
+	1370, 1370, 1370, 1370, 1370, 1370, 1370, 1370, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+	1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+	1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1376,    1,    1,    1,    1,    1,    1,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+	1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1385,    1,    1,    1,    1,    1,    1,
+	1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+	1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389,
+	1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1394, 1395, 1396, 1397,    1,    1,    1,
+	1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307,    1,    1,    1,    1,    1,    1,    1,    1,
+	1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1310,
+	1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
+	1314, 1314, 1314, 1314, 1314, 1314, 1314, 1314, 1315, 1316, 1317, 1318, 1319,    1,    1,    1,
+	1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321,
+	1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
+	1324, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325, 1325, 1325, 1325, 1325, 1325, 1325, 1325,
+	1326, 1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1329, 1330, 1331,    1,    1,    1,
+	1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
+	1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
+	1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337,
+	1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1339, 1340, 1341, 1342, 1343,    1,    1,    1,
+	1344, 1344, 1344, 1344, 1344, 1344, 1344, 1344, 1345, 1345, 1345, 1345, 1345, 1345, 1345, 1345,
+	1346, 1346, 1346, 1346, 1346, 1346, 1346, 1346, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347,
+	1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+	1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1351, 1352, 1353, 1354, 1355,    1,    1,    1,
+	1356, 1356, 1356, 1356, 1356, 1356, 1356, 1356, 1398, 1398, 1398, 1398, 1398, 1398, 1398, 1399,
+	1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1361,
+	1362, 1362, 1362, 1362, 1362, 1362, 1362, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+	1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1367,    1,    1,    1,    1,    1,    1,
+	1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1369, 1369, 1369, 1369, 1369, 1369, 1369, 1369,
+	1370, 1370, 1370, 1370, 1370, 1370, 1370, 1370, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371,
+	1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1373, 1373, 1373, 1373, 1373, 1373, 1373, 1373,
+	1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1376,    1,    1,    1,    1,    1,    1,
+	1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
+	1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
+	1381, 1381, 1381, 1381, 1381, 1381, 1381, 1381, 1382, 1382, 1382, 1382, 1382, 1382, 1382, 1382,
+	1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1385,    1,    1,    1,    1,    1,    1,
+	1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
+	1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389,
+	1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391,
+	1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1394, 1395, 1396, 1397,    1,    1,    1,
+	1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400,    1,    1,    1,    1,    1,    1,    1,    1,
+	1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+	1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 1409, 1410, 1411, 1412,    1,    1,    1,
+	1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,    1,    1,    1,    1,    1,    1,    1,    1,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1420, 1421, 1422, 1423,    1,    1,    1,
+	1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,    1,    1,    1,    1,    1,    1,    1,    1,
+	1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
+	1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
+	1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1431, 1432, 1433, 1434,    1,    1,    1,
+	1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,    1,    1,    1,    1,    1,    1,    1,    1,
+	1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1442, 1443, 1444, 1445,    1,    1,    1,
+	1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451,
+	1452, 1452, 1452, 1452, 1452, 1452, 1452, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+	1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1457,    1,    1,    1,    1,    1,    1,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
+	1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1465, 1466,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+	1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
+	1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+	1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1473, 1474,    1,    1,    1,    1,    1,    1,
+	1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,    1,    1,    1,    1,    1,    1,    1,    1,
+	1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+	1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+	1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1481, 1482, 1483, 1484, 1485,    1,    1,    1,
+	1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400,    1,    1,    1,    1,    1,    1,    1,    1,
+	1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+	1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 1409, 1410, 1411, 1412,    1,    1,    1,
+	1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,    1,    1,    1,    1,    1,    1,    1,    1,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1420, 1421, 1422, 1423,    1,    1,    1,
+	1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,    1,    1,    1,    1,    1,    1,    1,    1,
+	1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
+	1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
+	1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1431, 1432, 1433, 1434,    1,    1,    1,
+	1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,    1,    1,    1,    1,    1,    1,    1,    1,
+	1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1442, 1443, 1444, 1445,    1,    1,    1,
+	1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451,
+	1452, 1452, 1452, 1452, 1452, 1452, 1452, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+	1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1457,    1,    1,    1,    1,    1,    1,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
+	1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1465, 1466,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+	1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
+	1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+	1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1473, 1474,    1,    1,    1,    1,    1,    1,
+	1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,    1,    1,    1,    1,    1,    1,    1,    1,
+	1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+	1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+	1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1481, 1482, 1483, 1484, 1485,    1,    1,    1,
+	1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400,    1,    1,    1,    1,    1,    1,    1,    1,
+	1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+	1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 1409, 1410, 1411, 1412,    1,    1,    1,
+	1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,    1,    1,    1,    1,    1,    1,    1,    1,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1420, 1421, 1422, 1423,    1,    1,    1,
+	1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,    1,    1,    1,    1,    1,    1,    1,    1,
+	1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
+	1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
+	1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1431, 1432, 1433, 1434,    1,    1,    1,
+	1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,    1,    1,    1,    1,    1,    1,    1,    1,
+	1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1442, 1443, 1444, 1445,    1,    1,    1,
+	1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451,
+	1452, 1452, 1452, 1452, 1452, 1452, 1452, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+	1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1457,    1,    1,    1,    1,    1,    1,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
+	1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1465, 1466,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+	1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
+	1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+	1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1473, 1474,    1,    1,    1,    1,    1,    1,
+	1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,    1,    1,    1,    1,    1,    1,    1,    1,
+	1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+	1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+	1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1481, 1482, 1483, 1484, 1485,    1,    1,    1,
+	1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400,    1,    1,    1,    1,    1,    1,    1,    1,
+	1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+	1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 1409, 1410, 1411, 1412,    1,    1,    1,
+	1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,    1,    1,    1,    1,    1,    1,    1,    1,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1420, 1421, 1422, 1423,    1,    1,    1,
+	1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,    1,    1,    1,    1,    1,    1,    1,    1,
+	1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
+	1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
+	1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1431, 1432, 1433, 1434,    1,    1,    1,
+	1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,    1,    1,    1,    1,    1,    1,    1,    1,
+	1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1442, 1443, 1444, 1445,    1,    1,    1,
+	1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451,
+	1452, 1452, 1452, 1452, 1452, 1452, 1452, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+	1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1457,    1,    1,    1,    1,    1,    1,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
+	1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1465, 1466,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+	1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
+	1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+	1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1473, 1474,    1,    1,    1,    1,    1,    1,
+	1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,    1,    1,    1,    1,    1,    1,    1,    1,
+	1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+	1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+	1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1481, 1482, 1483, 1484, 1485,    1,    1,    1,
+	1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400,    1,    1,    1,    1,    1,    1,    1,    1,
+	1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+	1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 1409, 1410, 1411, 1412,    1,    1,    1,
+	1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,    1,    1,    1,    1,    1,    1,    1,    1,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1420, 1421, 1422, 1423,    1,    1,    1,
+	1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,    1,    1,    1,    1,    1,    1,    1,    1,
+	1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
+	1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
+	1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1431, 1432, 1433, 1434,    1,    1,    1,
+	1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,    1,    1,    1,    1,    1,    1,    1,    1,
+	1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1442, 1443, 1444, 1445,    1,    1,    1,
+	1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451,
+	1452, 1452, 1452, 1452, 1452, 1452, 1452, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+	1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1457,    1,    1,    1,    1,    1,    1,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
+	1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1465, 1466,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+	1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
+	1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+	1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1473, 1474,    1,    1,    1,    1,    1,    1,
+	1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,    1,    1,    1,    1,    1,    1,    1,    1,
+	1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+	1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+	1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1481, 1482, 1483, 1484, 1485,    1,    1,    1,
+	1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400,    1,    1,    1,    1,    1,    1,    1,    1,
+	1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+	1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 1409, 1410, 1411, 1412,    1,    1,    1,
+	1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,    1,    1,    1,    1,    1,    1,    1,    1,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1420, 1421, 1422, 1423,    1,    1,    1,
+	1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,    1,    1,    1,    1,    1,    1,    1,    1,
+	1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
+	1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
+	1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1431, 1432, 1433, 1434,    1,    1,    1,
+	1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,    1,    1,    1,    1,    1,    1,    1,    1,
+	1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1442, 1443, 1444, 1445,    1,    1,    1,
+	1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451,
+	1452, 1452, 1452, 1452, 1452, 1452, 1452, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+	1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1457,    1,    1,    1,    1,    1,    1,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
+	1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1465, 1466,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+	1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
+	1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+	1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1473, 1474,    1,    1,    1,    1,    1,    1,
+	1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,    1,    1,    1,    1,    1,    1,    1,    1,
+	1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+	1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+	1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1481, 1482, 1483, 1484, 1485,    1,    1,    1,
+	1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400,    1,    1,    1,    1,    1,    1,    1,    1,
+	1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+	1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 1409, 1410, 1411, 1412,    1,    1,    1,
+	1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,    1,    1,    1,    1,    1,    1,    1,    1,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1420, 1421, 1422, 1423,    1,    1,    1,
+	1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,    1,    1,    1,    1,    1,    1,    1,    1,
+	1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
+	1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
+	1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1431, 1432, 1433, 1434,    1,    1,    1,
+	1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,    1,    1,    1,    1,    1,    1,    1,    1,
+	1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1442, 1443, 1444, 1445,    1,    1,    1,
+	1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1447, 1447, 1447, 1447, 1447, 1447, 1447, 1448,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451,
+	1452, 1452, 1452, 1452, 1452, 1452, 1452, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+	1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1457,    1,    1,    1,    1,    1,    1,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
+	1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1465, 1466,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+	1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
+	1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+	1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1473, 1474,    1,    1,    1,    1,    1,    1,
+	1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,    1,    1,    1,    1,    1,    1,    1,    1,
+	1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+	1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+	1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1481, 1482, 1483, 1484, 1485,    1,    1,    1,
+	1400, 1400, 1400, 1400, 1400, 1400, 1400, 1400,    1,    1,    1,    1,    1,    1,    1,    1,
+	1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1403,
+	1404, 1404, 1404, 1404, 1404, 1404, 1404, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+	1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 1409, 1410, 1411, 1412,    1,    1,    1,
+	1413, 1413, 1413, 1413, 1413, 1413, 1413, 1413,    1,    1,    1,    1,    1,    1,    1,    1,
+	1414, 1414, 1414, 1414, 1414, 1414, 1414, 1414, 1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,
+	1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1417,
+	1418, 1418, 1418, 1418, 1418, 1418, 1418, 1418, 1419, 1420, 1421, 1422, 1423,    1,    1,    1,
+	1424, 1424, 1424, 1424, 1424, 1424, 1424, 1424,    1,    1,    1,    1,    1,    1,    1,    1,
+	1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1426, 1426, 1426, 1426, 1426, 1426, 1426, 1426,
+	1427, 1427, 1427, 1427, 1427, 1427, 1427, 1427, 1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,
+	1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1431, 1432, 1433, 1434,    1,    1,    1,
+	1435, 1435, 1435, 1435, 1435, 1435, 1435, 1435,    1,    1,    1,    1,    1,    1,    1,    1,
+	1436, 1436, 1436, 1436, 1436, 1436, 1436, 1436, 1437, 1437, 1437, 1437, 1437, 1437, 1437, 1437,
+	1438, 1438, 1438, 1438, 1438, 1438, 1438, 1438, 1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,
+	1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1442, 1443, 1444, 1445,    1,    1,    1,
+	1446, 1446, 1446, 1446, 1446, 1446, 1446, 1446, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1487,
+	1449, 1449, 1449, 1449, 1449, 1449, 1449, 1449, 1450, 1450, 1450, 1450, 1450, 1450, 1450, 1451,
+	1452, 1452, 1452, 1452, 1452, 1452, 1452, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+	1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1457,    1,    1,    1,    1,    1,    1,
+	1458, 1458, 1458, 1458, 1458, 1458, 1458, 1458, 1459, 1459, 1459, 1459, 1459, 1459, 1459, 1459,
+	1460, 1460, 1460, 1460, 1460, 1460, 1460, 1460, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461,
+	1462, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463, 1463, 1463, 1463, 1463, 1463, 1463, 1463,
+	1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1465, 1466,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
+	1468, 1468, 1468, 1468, 1468, 1468, 1468, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
+	1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1471, 1471, 1471, 1471, 1471, 1471, 1471, 1471,
+	1472, 1472, 1472, 1472, 1472, 1472, 1472, 1472, 1473, 1474,    1,    1,    1,    1,    1,    1,
+	1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475,    1,    1,    1,    1,    1,    1,    1,    1,
+	1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477,
+	1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+	1480, 1480, 1480, 1480, 1480, 1480, 1480, 1480, 1481, 1482, 1483, 1484, 1485,    1,    1,    1,
+	1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,    1,    1,    1,    1,    1,    1,    1,    1,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1491,
+	1492, 1492, 1492, 1492, 1492, 1492, 1492, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1497, 1498, 1499, 1500,    1,    1,    1,
+	1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
+	1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+	1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+	1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1509, 1510, 1511, 1512,    1,    1,    1,
+	1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+	1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+	1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+	1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1520, 1521, 1522, 1523, 1524,    1,    1,    1,
+	1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526,
+	1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528,
+	1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530,
+	1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1532, 1533, 1534, 1535, 1536,    1,    1,    1,
+	1537, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1539,
+	1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542,
+	1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1545, 1545, 1545, 1545, 1545, 1545, 1545, 1545,
+	1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1548,    1,    1,    1,    1,    1,    1,
+	1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+	1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+	1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+	1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1557,    1,    1,    1,    1,    1,    1,
+	1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+	1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+	1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563,
+	1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1566,    1,    1,    1,    1,    1,    1,
+	1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+	1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+	1571, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572,
+	1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1575, 1576, 1577, 1578,    1,    1,    1,
+	1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,    1,    1,    1,    1,    1,    1,    1,    1,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1491,
+	1492, 1492, 1492, 1492, 1492, 1492, 1492, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1497, 1498, 1499, 1500,    1,    1,    1,
+	1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
+	1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+	1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+	1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1509, 1510, 1511, 1512,    1,    1,    1,
+	1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+	1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+	1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+	1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1520, 1521, 1522, 1523, 1524,    1,    1,    1,
+	1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526,
+	1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528,
+	1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530,
+	1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1532, 1533, 1534, 1535, 1536,    1,    1,    1,
+	1537, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1539,
+	1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542,
+	1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1545, 1545, 1545, 1545, 1545, 1545, 1545, 1545,
+	1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1548,    1,    1,    1,    1,    1,    1,
+	1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+	1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+	1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+	1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1557,    1,    1,    1,    1,    1,    1,
+	1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+	1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+	1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563,
+	1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1566,    1,    1,    1,    1,    1,    1,
+	1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+	1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+	1571, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572,
+	1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1575, 1576, 1577, 1578,    1,    1,    1,
+	1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,    1,    1,    1,    1,    1,    1,    1,    1,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1491,
+	1492, 1492, 1492, 1492, 1492, 1492, 1492, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1497, 1498, 1499, 1500,    1,    1,    1,
+	1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
+	1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+	1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+	1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1509, 1510, 1511, 1512,    1,    1,    1,
+	1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+	1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+	1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+	1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1520, 1521, 1522, 1523, 1524,    1,    1,    1,
+	1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526,
+	1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528,
+	1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530,
+	1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1532, 1533, 1534, 1535, 1536,    1,    1,    1,
+	1537, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1539,
+	1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542,
+	1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1545, 1545, 1545, 1545, 1545, 1545, 1545, 1545,
+	1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1548,    1,    1,    1,    1,    1,    1,
+	1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+	1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+	1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+	1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1557,    1,    1,    1,    1,    1,    1,
+	1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+	1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+	1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563,
+	1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1566,    1,    1,    1,    1,    1,    1,
+	1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+	1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+	1571, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572,
+	1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1575, 1576, 1577, 1578,    1,    1,    1,
+	1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,    1,    1,    1,    1,    1,    1,    1,    1,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1491,
+	1492, 1492, 1492, 1492, 1492, 1492, 1492, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1497, 1498, 1499, 1500,    1,    1,    1,
+	1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
+	1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+	1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+	1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1509, 1510, 1511, 1512,    1,    1,    1,
+	1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+	1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+	1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+	1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1520, 1521, 1522, 1523, 1524,    1,    1,    1,
+	1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526,
+	1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528,
+	1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530,
+	1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1532, 1533, 1534, 1535, 1536,    1,    1,    1,
+	1537, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1539,
+	1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542,
+	1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1545, 1545, 1545, 1545, 1545, 1545, 1545, 1545,
+	1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1548,    1,    1,    1,    1,    1,    1,
+	1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+	1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+	1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+	1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1557,    1,    1,    1,    1,    1,    1,
+	1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+	1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+	1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563,
+	1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1566,    1,    1,    1,    1,    1,    1,
+	1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+	1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+	1571, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572,
+	1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1575, 1576, 1577, 1578,    1,    1,    1,
+	1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,    1,    1,    1,    1,    1,    1,    1,    1,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1491,
+	1492, 1492, 1492, 1492, 1492, 1492, 1492, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1497, 1498, 1499, 1500,    1,    1,    1,
+	1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
+	1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+	1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+	1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1509, 1510, 1511, 1512,    1,    1,    1,
+	1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+	1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+	1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+	1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1520, 1521, 1522, 1523, 1524,    1,    1,    1,
+	1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526,
+	1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528,
+	1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530,
+	1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1532, 1533, 1534, 1535, 1536,    1,    1,    1,
+	1537, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1539,
+	1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542,
+	1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1545, 1545, 1545, 1545, 1545, 1545, 1545, 1545,
+	1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1548,    1,    1,    1,    1,    1,    1,
+	1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+	1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+	1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+	1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1557,    1,    1,    1,    1,    1,    1,
+	1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+	1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+	1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563,
+	1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1566,    1,    1,    1,    1,    1,    1,
+	1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+	1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+	1571, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572,
+	1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1575, 1576, 1577, 1578,    1,    1,    1,
+	1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,    1,    1,    1,    1,    1,    1,    1,    1,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1491,
+	1492, 1492, 1492, 1492, 1492, 1492, 1492, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1497, 1498, 1499, 1500,    1,    1,    1,
+	1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
+	1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+	1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+	1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1509, 1510, 1511, 1512,    1,    1,    1,
+	1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+	1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+	1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+	1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1520, 1521, 1522, 1523, 1524,    1,    1,    1,
+	1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526,
+	1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528,
+	1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530,
+	1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1532, 1533, 1534, 1535, 1536,    1,    1,    1,
+	1537, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1539,
+	1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542,
+	1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1545, 1545, 1545, 1545, 1545, 1545, 1545, 1545,
+	1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1548,    1,    1,    1,    1,    1,    1,
+	1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+	1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+	1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+	1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1557,    1,    1,    1,    1,    1,    1,
+	1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+	1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+	1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563,
+	1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1566,    1,    1,    1,    1,    1,    1,
+	1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+	1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+	1571, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572,
+	1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1575, 1576, 1577, 1578,    1,    1,    1,
+	1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,    1,    1,    1,    1,    1,    1,    1,    1,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1491,
+	1492, 1492, 1492, 1492, 1492, 1492, 1492, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1497, 1498, 1499, 1500,    1,    1,    1,
+	1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
+	1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+	1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+	1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1509, 1510, 1511, 1512,    1,    1,    1,
+	1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+	1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+	1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+	1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1520, 1521, 1522, 1523, 1524,    1,    1,    1,
+	1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526,
+	1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528,
+	1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530,
+	1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1532, 1533, 1534, 1535, 1536,    1,    1,    1,
+	1537, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1538, 1538, 1538, 1538, 1538, 1538, 1538, 1539,
+	1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542,
+	1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1545, 1545, 1545, 1545, 1545, 1545, 1545, 1545,
+	1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1548,    1,    1,    1,    1,    1,    1,
+	1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+	1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+	1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+	1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1557,    1,    1,    1,    1,    1,    1,
+	1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+	1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+	1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563,
+	1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1566,    1,    1,    1,    1,    1,    1,
+	1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+	1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+	1571, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572,
+	1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1575, 1576, 1577, 1578,    1,    1,    1,
+	1488, 1488, 1488, 1488, 1488, 1488, 1488, 1488,    1,    1,    1,    1,    1,    1,    1,    1,
+	1489, 1489, 1489, 1489, 1489, 1489, 1489, 1489, 1490, 1490, 1490, 1490, 1490, 1490, 1490, 1491,
+	1492, 1492, 1492, 1492, 1492, 1492, 1492, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+	1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1497, 1498, 1499, 1500,    1,    1,    1,
+	1501, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502, 1502, 1502, 1502, 1502, 1502, 1502, 1502,
+	1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504,
+	1505, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506, 1506, 1506, 1506, 1506, 1506, 1506, 1506,
+	1507, 1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1509, 1510, 1511, 1512,    1,    1,    1,
+	1513, 1513, 1513, 1513, 1513, 1513, 1513, 1513, 1514, 1514, 1514, 1514, 1514, 1514, 1514, 1514,
+	1515, 1515, 1515, 1515, 1515, 1515, 1515, 1515, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516,
+	1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+	1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1520, 1521, 1522, 1523, 1524,    1,    1,    1,
+	1525, 1525, 1525, 1525, 1525, 1525, 1525, 1525, 1526, 1526, 1526, 1526, 1526, 1526, 1526, 1526,
+	1527, 1527, 1527, 1527, 1527, 1527, 1527, 1527, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528,
+	1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530,
+	1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1532, 1533, 1534, 1535, 1536,    1,    1,    1,
+	1537, 1537, 1537, 1537, 1537, 1537, 1537, 1537, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1580,
+	1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1542,
+	1543, 1543, 1543, 1543, 1543, 1543, 1543, 1544, 1545, 1545, 1545, 1545, 1545, 1545, 1545, 1545,
+	1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1548,    1,    1,    1,    1,    1,    1,
+	1549, 1549, 1549, 1549, 1549, 1549, 1549, 1549, 1550, 1550, 1550, 1550, 1550, 1550, 1550, 1550,
+	1551, 1551, 1551, 1551, 1551, 1551, 1551, 1551, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552,
+	1553, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+	1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1557,    1,    1,    1,    1,    1,    1,
+	1558, 1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1559, 1559, 1559, 1559, 1559, 1559, 1559,
+	1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561,
+	1562, 1562, 1562, 1562, 1562, 1562, 1562, 1562, 1563, 1563, 1563, 1563, 1563, 1563, 1563, 1563,
+	1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1566,    1,    1,    1,    1,    1,    1,
+	1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568,
+	1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570,
+	1571, 1571, 1571, 1571, 1571, 1571, 1571, 1571, 1572, 1572, 1572, 1572, 1572, 1572, 1572, 1572,
+	1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1575, 1576, 1577, 1578,    1,    1,    1,
+	1581, 1581, 1581, 1581, 1581, 1581, 1581, 1581, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582,
+	1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584,
+	1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586,
+	1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
+	1589, 1589, 1589, 1589, 1589, 1589, 1589, 1589, 1590, 1590, 1590, 1590, 1590, 1590, 1590, 1590,
+	1591, 1591, 1591, 1591, 1591, 1591, 1591, 1591, 1592, 1592, 1592, 1592, 1592, 1592, 1592, 1592,
+	1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594, 1594, 1594, 1594, 1594,
+	1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596,
+	1597, 1597, 1597, 1597, 1597, 1597, 1597, 1597, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 1598,
+	1599, 1599, 1599, 1599, 1599, 1599, 1599, 1599, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600,
+	1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602,
+	1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606,
+	1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608,
+	1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1610, 1611,    1,    1,    1,    1,    1,    1,
+	1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613,
+	1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615,
+	1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+	1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+	1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+	1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623,
+	1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+	1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+	1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629,
+	1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631,
+	1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
+	1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1637,
+	1638, 1638, 1638, 1638, 1638, 1638, 1638, 1638, 1639, 1639, 1639, 1639, 1639, 1639, 1639, 1639,
+	1640, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1641, 1642,    1,    1,    1,    1,    1,    1,
+	1643, 1643, 1643, 1643, 1643, 1643, 1643, 1643, 1644, 1644, 1644, 1644, 1644, 1644, 1644, 1644,
+	1645, 1645, 1645, 1645, 1645, 1645, 1645, 1645, 1646, 1646, 1646, 1646, 1646, 1646, 1646, 1646,
+	1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586,
+	1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
+	1647, 1647, 1647, 1647, 1647, 1647, 1647, 1647, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648,
+	1649, 1649, 1649, 1649, 1649, 1649, 1649, 1649, 1650, 1650, 1650, 1650, 1650, 1650, 1650, 1650,
+	1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594, 1594, 1594, 1594, 1594,
+	1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596,
+	1651, 1651, 1651, 1651, 1651, 1651, 1651, 1651, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+	1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654,
+	1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602,
+	1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656,
+	1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658,
+	1659, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1660, 1661,    1,    1,    1,    1,    1,    1,
+	1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1663, 1663, 1663, 1663, 1663, 1663, 1663, 1663,
+	1664, 1664, 1664, 1664, 1664, 1664, 1664, 1664, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 1665,
+	1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+	1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+	1666, 1666, 1666, 1666, 1666, 1666, 1666, 1666, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667,
+	1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1669, 1669, 1669, 1669, 1669, 1669, 1669, 1669,
+	1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+	1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+	1670, 1670, 1670, 1670, 1670, 1670, 1670, 1670, 1671, 1671, 1671, 1671, 1671, 1671, 1671, 1671,
+	1672, 1672, 1672, 1672, 1672, 1672, 1672, 1672, 1673, 1673, 1673, 1673, 1673, 1673, 1673, 1673,
+	1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
+	1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1674, 1674, 1674, 1674, 1674, 1674, 1674, 1674, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
+	1676, 1676, 1676, 1676, 1676, 1676, 1676, 1676, 1677, 1677, 1677, 1677, 1677, 1677, 1677, 1677,
+	1678, 1678, 1678, 1678, 1678, 1678, 1678, 1678, 1679, 1680,    1,    1,    1,    1,    1,    1,
+	1681, 1681, 1681, 1681, 1681, 1681, 1681, 1681, 1682, 1682, 1682, 1682, 1682, 1682, 1682, 1682,
+	1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1684, 1684, 1684, 1684, 1684, 1684, 1684, 1684,
+	1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586,
+	1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
+	1685, 1685, 1685, 1685, 1685, 1685, 1685, 1685, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686,
+	1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688,
+	1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594, 1594, 1594, 1594, 1594,
+	1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596,
+	1689, 1689, 1689, 1689, 1689, 1689, 1689, 1689, 1690, 1690, 1690, 1690, 1690, 1690, 1690, 1690,
+	1691, 1691, 1691, 1691, 1691, 1691, 1691, 1691, 1692, 1692, 1692, 1692, 1692, 1692, 1692, 1692,
+	1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602,
+	1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1693, 1693, 1693, 1693, 1693, 1693, 1693, 1693, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694,
+	1695, 1695, 1695, 1695, 1695, 1695, 1695, 1695, 1696, 1696, 1696, 1696, 1696, 1696, 1696, 1696,
+	1697, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1698, 1699,    1,    1,    1,    1,    1,    1,
+	1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1701, 1701, 1701, 1701, 1701, 1701, 1701, 1701,
+	1702, 1702, 1702, 1702, 1702, 1702, 1702, 1702, 1703, 1703, 1703, 1703, 1703, 1703, 1703, 1703,
+	1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+	1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+	1704, 1704, 1704, 1704, 1704, 1704, 1704, 1704, 1705, 1705, 1705, 1705, 1705, 1705, 1705, 1705,
+	1706, 1706, 1706, 1706, 1706, 1706, 1706, 1706, 1707, 1707, 1707, 1707, 1707, 1707, 1707, 1707,
+	1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+	1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+	1708, 1708, 1708, 1708, 1708, 1708, 1708, 1708, 1709, 1709, 1709, 1709, 1709, 1709, 1709, 1709,
+	1710, 1710, 1710, 1710, 1710, 1710, 1710, 1710, 1711, 1711, 1711, 1711, 1711, 1711, 1711, 1711,
+	1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
+	1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1712, 1712, 1712, 1712, 1712, 1712, 1712, 1712, 1713, 1713, 1713, 1713, 1713, 1713, 1713, 1713,
+	1714, 1714, 1714, 1714, 1714, 1714, 1714, 1714, 1715, 1715, 1715, 1715, 1715, 1715, 1715, 1715,
+	1716, 1716, 1716, 1716, 1716, 1716, 1716, 1716, 1717, 1718,    1,    1,    1,    1,    1,    1,
+	1719, 1719, 1719, 1719, 1719, 1719, 1719, 1719, 1720, 1720, 1720, 1720, 1720, 1720, 1720, 1720,
+	1721, 1721, 1721, 1721, 1721, 1721, 1721, 1721, 1722, 1722, 1722, 1722, 1722, 1722, 1722, 1722,
+	1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586,
+	1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
+	1723, 1723, 1723, 1723, 1723, 1723, 1723, 1723, 1724, 1724, 1724, 1724, 1724, 1724, 1724, 1724,
+	1725, 1725, 1725, 1725, 1725, 1725, 1725, 1725, 1726, 1726, 1726, 1726, 1726, 1726, 1726, 1726,
+	1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594, 1594, 1594, 1594, 1594,
+	1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596,
+	1727, 1727, 1727, 1727, 1727, 1727, 1727, 1727, 1728, 1728, 1728, 1728, 1728, 1728, 1728, 1728,
+	1729, 1729, 1729, 1729, 1729, 1729, 1729, 1729, 1730, 1730, 1730, 1730, 1730, 1730, 1730, 1730,
+	1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602,
+	1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1731, 1731, 1731, 1731, 1731, 1731, 1731, 1731, 1732, 1732, 1732, 1732, 1732, 1732, 1732, 1732,
+	1733, 1733, 1733, 1733, 1733, 1733, 1733, 1733, 1734, 1734, 1734, 1734, 1734, 1734, 1734, 1734,
+	1735, 1735, 1735, 1735, 1735, 1735, 1735, 1735, 1736, 1737,    1,    1,    1,    1,    1,    1,
+	1738, 1738, 1738, 1738, 1738, 1738, 1738, 1738, 1739, 1739, 1739, 1739, 1739, 1739, 1739, 1739,
+	1740, 1740, 1740, 1740, 1740, 1740, 1740, 1740, 1741, 1741, 1741, 1741, 1741, 1741, 1741, 1741,
+	1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+	1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+	1742, 1742, 1742, 1742, 1742, 1742, 1742, 1742, 1743, 1743, 1743, 1743, 1743, 1743, 1743, 1743,
+	1744, 1744, 1744, 1744, 1744, 1744, 1744, 1744, 1745, 1745, 1745, 1745, 1745, 1745, 1745, 1745,
+	1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+	1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+	1746, 1746, 1746, 1746, 1746, 1746, 1746, 1746, 1747, 1747, 1747, 1747, 1747, 1747, 1747, 1747,
+	1748, 1748, 1748, 1748, 1748, 1748, 1748, 1748, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749,
+	1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
+	1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1750, 1750, 1750, 1750, 1750, 1750, 1750, 1750, 1751, 1751, 1751, 1751, 1751, 1751, 1751, 1751,
+	1752, 1752, 1752, 1752, 1752, 1752, 1752, 1752, 1753, 1753, 1753, 1753, 1753, 1753, 1753, 1753,
+	1754, 1754, 1754, 1754, 1754, 1754, 1754, 1754, 1755, 1756,    1,    1,    1,    1,    1,    1,
+	1757, 1757, 1757, 1757, 1757, 1757, 1757, 1757, 1758, 1758, 1758, 1758, 1758, 1758, 1758, 1758,
+	1759, 1759, 1759, 1759, 1759, 1759, 1759, 1759, 1760, 1760, 1760, 1760, 1760, 1760, 1760, 1760,
+	1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586,
+	1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
+	1761, 1761, 1761, 1761, 1761, 1761, 1761, 1761, 1762, 1762, 1762, 1762, 1762, 1762, 1762, 1762,
+	1763, 1763, 1763, 1763, 1763, 1763, 1763, 1763, 1764, 1764, 1764, 1764, 1764, 1764, 1764, 1764,
+	1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594, 1594, 1594, 1594, 1594,
+	1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596,
+	1765, 1765, 1765, 1765, 1765, 1765, 1765, 1765, 1766, 1766, 1766, 1766, 1766, 1766, 1766, 1766,
+	1767, 1767, 1767, 1767, 1767, 1767, 1767, 1767, 1768, 1768, 1768, 1768, 1768, 1768, 1768, 1768,
+	1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602,
+	1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1769, 1769, 1769, 1769, 1769, 1769, 1769, 1769, 1770, 1770, 1770, 1770, 1770, 1770, 1770, 1770,
+	1771, 1771, 1771, 1771, 1771, 1771, 1771, 1771, 1772, 1772, 1772, 1772, 1772, 1772, 1772, 1772,
+	1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+	1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+	1773, 1773, 1773, 1773, 1773, 1773, 1773, 1773, 1774, 1774, 1774, 1774, 1774, 1774, 1774, 1774,
+	1775, 1775, 1775, 1775, 1775, 1775, 1775, 1775, 1776, 1776, 1776, 1776, 1776, 1776, 1776, 1776,
+	1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+	1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+	1777, 1777, 1777, 1777, 1777, 1777, 1777, 1777, 1778, 1778, 1778, 1778, 1778, 1778, 1778, 1778,
+	1779, 1779, 1779, 1779, 1779, 1779, 1779, 1779, 1780, 1780, 1780, 1780, 1780, 1780, 1780, 1780,
+	1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
+	1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1781, 1781, 1781, 1781, 1781, 1781, 1781, 1781, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
+	1783, 1783, 1783, 1783, 1783, 1783, 1783, 1783, 1784, 1784, 1784, 1784, 1784, 1784, 1784, 1784,
+	1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586,
+	1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
+	1785, 1785, 1785, 1785, 1785, 1785, 1785, 1785, 1786, 1786, 1786, 1786, 1786, 1786, 1786, 1786,
+	1787, 1787, 1787, 1787, 1787, 1787, 1787, 1787, 1788, 1788, 1788, 1788, 1788, 1788, 1788, 1788,
+	1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594, 1594, 1594, 1594, 1594,
+	1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596,
+	1789, 1789, 1789, 1789, 1789, 1789, 1789, 1789, 1790, 1790, 1790, 1790, 1790, 1790, 1790, 1790,
+	1791, 1791, 1791, 1791, 1791, 1791, 1791, 1791, 1792, 1792, 1792, 1792, 1792, 1792, 1792, 1792,
+	1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602,
+	1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1793, 1793, 1793, 1793, 1793, 1793, 1793, 1793, 1794, 1794, 1794, 1794, 1794, 1794, 1794, 1794,
+	1795, 1795, 1795, 1795, 1795, 1795, 1795, 1795, 1796, 1796, 1796, 1796, 1796, 1796, 1796, 1796,
+	1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+	1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+	1797, 1797, 1797, 1797, 1797, 1797, 1797, 1797, 1798, 1798, 1798, 1798, 1798, 1798, 1798, 1798,
+	1799, 1799, 1799, 1799, 1799, 1799, 1799, 1799, 1800, 1800, 1800, 1800, 1800, 1800, 1800, 1800,
+	1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+	1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+	1801, 1801, 1801, 1801, 1801, 1801, 1801, 1801, 1802, 1802, 1802, 1802, 1802, 1802, 1802, 1802,
+	1803, 1803, 1803, 1803, 1803, 1803, 1803, 1803, 1804, 1804, 1804, 1804, 1804, 1804, 1804, 1804,
+	1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
+	1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1805, 1805, 1805, 1805, 1805, 1805, 1805, 1805, 1806, 1806, 1806, 1806, 1806, 1806, 1806, 1806,
+	1807, 1807, 1807, 1807, 1807, 1807, 1807, 1807, 1808, 1808, 1808, 1808, 1808, 1808, 1808, 1808,
+	1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586,
+	1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
+	1809, 1809, 1809, 1809, 1809, 1809, 1809, 1809, 1810, 1810, 1810, 1810, 1810, 1810, 1810, 1810,
+	1811, 1811, 1811, 1811, 1811, 1811, 1811, 1811, 1812, 1812, 1812, 1812, 1812, 1812, 1812, 1812,
+	1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594, 1594, 1594, 1594, 1594,
+	1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596,
+	1813, 1813, 1813, 1813, 1813, 1813, 1813, 1813, 1814, 1814, 1814, 1814, 1814, 1814, 1814, 1814,
+	1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1816, 1816, 1816, 1816, 1816, 1816, 1816, 1816,
+	1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602,
+	1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1817, 1817, 1817, 1817, 1817, 1817, 1817, 1817, 1818, 1818, 1818, 1818, 1818, 1818, 1818, 1818,
+	1819, 1819, 1819, 1819, 1819, 1819, 1819, 1819, 1820, 1820, 1820, 1820, 1820, 1820, 1820, 1820,
+	1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+	1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+	1821, 1821, 1821, 1821, 1821, 1821, 1821, 1821, 1822, 1822, 1822, 1822, 1822, 1822, 1822, 1822,
+	1823, 1823, 1823, 1823, 1823, 1823, 1823, 1823, 1824, 1824, 1824, 1824, 1824, 1824, 1824, 1824,
+	1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+	1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+	1825, 1825, 1825, 1825, 1825, 1825, 1825, 1825, 1826, 1826, 1826, 1826, 1826, 1826, 1826, 1826,
+	1827, 1827, 1827, 1827, 1827, 1827, 1827, 1827, 1828, 1828, 1828, 1828, 1828, 1828, 1828, 1828,
+	1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
+	1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1829, 1829, 1829, 1829, 1829, 1829, 1829, 1829, 1830, 1830, 1830, 1830, 1830, 1830, 1830, 1830,
+	1831, 1831, 1831, 1831, 1831, 1831, 1831, 1831, 1832, 1832, 1832, 1832, 1832, 1832, 1832, 1832,
+	1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586,
+	1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588,
+	1833, 1833, 1833, 1833, 1833, 1833, 1833, 1833, 1834, 1834, 1834, 1834, 1834, 1834, 1834, 1834,
+	1835, 1835, 1835, 1835, 1835, 1835, 1835, 1835, 1836, 1836, 1836, 1836, 1836, 1836, 1836, 1836,
+	1593, 1593, 1593, 1593, 1593, 1593, 1593, 1593, 1594, 1594, 1594, 1594, 1594, 1594, 1594, 1594,
+	1595, 1595, 1595, 1595, 1595, 1595, 1595, 1595, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596,
+	1837, 1837, 1837, 1837, 1837, 1837, 1837, 1837, 1838, 1838, 1838, 1838, 1838, 1838, 1838, 1838,
+	1839, 1839, 1839, 1839, 1839, 1839, 1839, 1839, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840,
+	1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602,
+	1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1841, 1841, 1841, 1841, 1841, 1841, 1841, 1841, 1842, 1842, 1842, 1842, 1842, 1842, 1842, 1842,
+	1843, 1843, 1843, 1843, 1843, 1843, 1843, 1843, 1844, 1844, 1844, 1844, 1844, 1844, 1844, 1844,
+	1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+	1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+	1845, 1845, 1845, 1845, 1845, 1845, 1845, 1845, 1846, 1846, 1846, 1846, 1846, 1846, 1846, 1846,
+	1847, 1847, 1847, 1847, 1847, 1847, 1847, 1847, 1848, 1848, 1848, 1848, 1848, 1848, 1848, 1848,
+	1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625, 1625, 1625, 1625, 1625, 1625, 1625, 1625,
+	1626, 1626, 1626, 1626, 1626, 1626, 1626, 1626, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627,
+	1849, 1849, 1849, 1849, 1849, 1849, 1849, 1849, 1850, 1850, 1850, 1850, 1850, 1850, 1850, 1850,
+	1851, 1851, 1851, 1851, 1851, 1851, 1851, 1851, 1852, 1852, 1852, 1852, 1852, 1852, 1852, 1852,
+	1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633,
+	1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	   1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853, 1853,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+	1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854, 1854,
+};
+
+#if M68K_PROFILE_PAIRS
+const char* const m68ki_opcode_names[1855] =
+{
+	"ori_8_d",
+	"illegal",
+	"ori_8_ai",
+	"ori_8_pi",
+	"ori_8_pi7",
+	"ori_8_pd",
+	"ori_8_pd7",
+	"ori_8_di",
+	"ori_8_ix",
+	"ori_8_aw",
+	"ori_8_al",
+	"ori_16_toc",
+	"ori_16_d",
+	"ori_16_ai",
+	"ori_16_pi",
+	"ori_16_pd",
+	"ori_16_di",
+	"ori_16_ix",
+	"ori_16_aw",
+	"ori_16_al",
+	"ori_16_tos",
+	"ori_32_d",
+	"ori_32_ai",
+	"ori_32_pi",
+	"ori_32_pd",
+	"ori_32_di",
+	"ori_32_ix",
+	"ori_32_aw",
+	"ori_32_al",
+	"btst_32_r_d",
+	"movep_16_er",
+	"btst_8_r_ai",
+	"btst_8_r_pi",
+	"btst_8_r_pi7",
+	"btst_8_r_pd",
+	"btst_8_r_pd7",
+	"btst_8_r_di",
+	"btst_8_r_ix",
+	"btst_8_r_aw",
+	"btst_8_r_al",
+	"btst_8_r_pcdi",
+	"btst_8_r_pcix",
+	"btst_8_r_i",
+	"bchg_32_r_d",
+	"movep_32_er",
+	"bchg_8_r_ai",
+	"bchg_8_r_pi",
+	"bchg_8_r_pi7",
+	"bchg_8_r_pd",
+	"bchg_8_r_pd7",
+	"bchg_8_r_di",
+	"bchg_8_r_ix",
+	"bchg_8_r_aw",
+	"bchg_8_r_al",
+	"bclr_32_r_d",
+	"movep_16_re",
+	"bclr_8_r_ai",
+	"bclr_8_r_pi",
+	"bclr_8_r_pi7",
+	"bclr_8_r_pd",
+	"bclr_8_r_pd7",
+	"bclr_8_r_di",
+	"bclr_8_r_ix",
+	"bclr_8_r_aw",
+	"bclr_8_r_al",
+	"bset_32_r_d",
+	"movep_32_re",
+	"bset_8_r_ai",
+	"bset_8_r_pi",
+	"bset_8_r_pi7",
+	"bset_8_r_pd",
+	"bset_8_r_pd7",
+	"bset_8_r_di",
+	"bset_8_r_ix",
+	"bset_8_r_aw",
+	"bset_8_r_al",
+	"andi_8_d",
+	"andi_8_ai",
+	"andi_8_pi",
+	"andi_8_pi7",
+	"andi_8_pd",
+	"andi_8_pd7",
+	"andi_8_di",
+	"andi_8_ix",
+	"andi_8_aw",
+	"andi_8_al",
+	"andi_16_toc",
+	"andi_16_d",
+	"andi_16_ai",
+	"andi_16_pi",
+	"andi_16_pd",
+	"andi_16_di",
+	"andi_16_ix",
+	"andi_16_aw",
+	"andi_16_al",
+	"andi_16_tos",
+	"andi_32_d",
+	"andi_32_ai",
+	"andi_32_pi",
+	"andi_32_pd",
+	"andi_32_di",
+	"andi_32_ix",
+	"andi_32_aw",
+	"andi_32_al",
+	"subi_8_d",
+	"subi_8_ai",
+	"subi_8_pi",
+	"subi_8_pi7",
+	"subi_8_pd",
+	"subi_8_pd7",
+	"subi_8_di",
+	"subi_8_ix",
+	"subi_8_aw",
+	"subi_8_al",
+	"subi_16_d",
+	"subi_16_ai",
+	"subi_16_pi",
+	"subi_16_pd",
+	"subi_16_di",
+	"subi_16_ix",
+	"subi_16_aw",
+	"subi_16_al",
+	"subi_32_d",
+	"subi_32_ai",
+	"subi_32_pi",
+	"subi_32_pd",
+	"subi_32_di",
+	"subi_32_ix",
+	"subi_32_aw",
+	"subi_32_al",
+	"addi_8_d",
+	"addi_8_ai",
+	"addi_8_pi",
+	"addi_8_pi7",
+	"addi_8_pd",
+	"addi_8_pd7",
+	"addi_8_di",
+	"addi_8_ix",
+	"addi_8_aw",
+	"addi_8_al",
+	"addi_16_d",
+	"addi_16_ai",
+	"addi_16_pi",
+	"addi_16_pd",
+	"addi_16_di",
+	"addi_16_ix",
+	"addi_16_aw",
+	"addi_16_al",
+	"addi_32_d",
+	"addi_32_ai",
+	"addi_32_pi",
+	"addi_32_pd",
+	"addi_32_di",
+	"addi_32_ix",
+	"addi_32_aw",
+	"addi_32_al",
+	"btst_32_s_d",
+	"btst_8_s_ai",
+	"btst_8_s_pi",
+	"btst_8_s_pi7",
+	"btst_8_s_pd",
+	"btst_8_s_pd7",
+	"btst_8_s_di",
+	"btst_8_s_ix",
+	"btst_8_s_aw",
+	"btst_8_s_al",
+	"btst_8_s_pcdi",
+	"btst_8_s_pcix",
+	"bchg_32_s_d",
+	"bchg_8_s_ai",
+	"bchg_8_s_pi",
+	"bchg_8_s_pi7",
+	"bchg_8_s_pd",
+	"bchg_8_s_pd7",
+	"bchg_8_s_di",
+	"bchg_8_s_ix",
+	"bchg_8_s_aw",
+	"bchg_8_s_al",
+	"bclr_32_s_d",
+	"bclr_8_s_ai",
+	"bclr_8_s_pi",
+	"bclr_8_s_pi7",
+	"bclr_8_s_pd",
+	"bclr_8_s_pd7",
+	"bclr_8_s_di",
+	"bclr_8_s_ix",
+	"bclr_8_s_aw",
+	"bclr_8_s_al",
+	"bset_32_s_d",
+	"bset_8_s_ai",
+	"bset_8_s_pi",
+	"bset_8_s_pi7",
+	"bset_8_s_pd",
+	"bset_8_s_pd7",
+	"bset_8_s_di",
+	"bset_8_s_ix",
+	"bset_8_s_aw",
+	"bset_8_s_al",
+	"eori_8_d",
+	"eori_8_ai",
+	"eori_8_pi",
+	"eori_8_pi7",
+	"eori_8_pd",
+	"eori_8_pd7",
+	"eori_8_di",
+	"eori_8_ix",
+	"eori_8_aw",
+	"eori_8_al",
+	"eori_16_toc",
+	"eori_16_d",
+	"eori_16_ai",
+	"eori_16_pi",
+	"eori_16_pd",
+	"eori_16_di",
+	"eori_16_ix",
+	"eori_16_aw",
+	"eori_16_al",
+	"eori_16_tos",
+	"eori_32_d",
+	"eori_32_ai",
+	"eori_32_pi",
+	"eori_32_pd",
+	"eori_32_di",
+	"eori_32_ix",
+	"eori_32_aw",
+	"eori_32_al",
+	"cmpi_8_d",
+	"cmpi_8_ai",
+	"cmpi_8_pi",
+	"cmpi_8_pi7",
+	"cmpi_8_pd",
+	"cmpi_8_pd7",
+	"cmpi_8_di",
+	"cmpi_8_ix",
+	"cmpi_8_aw",
+	"cmpi_8_al",
+	"cmpi_16_d",
+	"cmpi_16_ai",
+	"cmpi_16_pi",
+	"cmpi_16_pd",
+	"cmpi_16_di",
+	"cmpi_16_ix",
+	"cmpi_16_aw",
+	"cmpi_16_al",
+	"cmpi_32_d",
+	"cmpi_32_ai",
+	"cmpi_32_pi",
+	"cmpi_32_pd",
+	"cmpi_32_di",
+	"cmpi_32_ix",
+	"cmpi_32_aw",
+	"cmpi_32_al",
+	"move_8_d_d",
+	"move_8_d_ai",
+	"move_8_d_pi",
+	"move_8_d_pi7",
+	"move_8_d_pd",
+	"move_8_d_pd7",
+	"move_8_d_di",
+	"move_8_d_ix",
+	"move_8_d_aw",
+	"move_8_d_al",
+	"move_8_d_pcdi",
+	"move_8_d_pcix",
+	"move_8_d_i",
+	"move_8_ai_d",
+	"move_8_ai_ai",
+	"move_8_ai_pi",
+	"move_8_ai_pi7",
+	"move_8_ai_pd",
+	"move_8_ai_pd7",
+	"move_8_ai_di",
+	"move_8_ai_ix",
+	"move_8_ai_aw",
+	"move_8_ai_al",
+	"move_8_ai_pcdi",
+	"move_8_ai_pcix",
+	"move_8_ai_i",
+	"move_8_pi_d",
+	"move_8_pi_ai",
+	"move_8_pi_pi",
+	"move_8_pi_pi7",
+	"move_8_pi_pd",
+	"move_8_pi_pd7",
+	"move_8_pi_di",
+	"move_8_pi_ix",
+	"move_8_pi_aw",
+	"move_8_pi_al",
+	"move_8_pi_pcdi",
+	"move_8_pi_pcix",
+	"move_8_pi_i",
+	"move_8_pd_d",
+	"move_8_pd_ai",
+	"move_8_pd_pi",
+	"move_8_pd_pi7",
+	"move_8_pd_pd",
+	"move_8_pd_pd7",
+	"move_8_pd_di",
+	"move_8_pd_ix",
+	"move_8_pd_aw",
+	"move_8_pd_al",
+	"move_8_pd_pcdi",
+	"move_8_pd_pcix",
+	"move_8_pd_i",
+	"move_8_di_d",
+	"move_8_di_ai",
+	"move_8_di_pi",
+	"move_8_di_pi7",
+	"move_8_di_pd",
+	"move_8_di_pd7",
+	"move_8_di_di",
+	"move_8_di_ix",
+	"move_8_di_aw",
+	"move_8_di_al",
+	"move_8_di_pcdi",
+	"move_8_di_pcix",
+	"move_8_di_i",
+	"move_8_ix_d",
+	"move_8_ix_ai",
+	"move_8_ix_pi",
+	"move_8_ix_pi7",
+	"move_8_ix_pd",
+	"move_8_ix_pd7",
+	"move_8_ix_di",
+	"move_8_ix_ix",
+	"move_8_ix_aw",
+	"move_8_ix_al",
+	"move_8_ix_pcdi",
+	"move_8_ix_pcix",
+	"move_8_ix_i",
+	"move_8_aw_d",
+	"move_8_aw_ai",
+	"move_8_aw_pi",
+	"move_8_aw_pi7",
+	"move_8_aw_pd",
+	"move_8_aw_pd7",
+	"move_8_aw_di",
+	"move_8_aw_ix",
+	"move_8_aw_aw",
+	"move_8_aw_al",
+	"move_8_aw_pcdi",
+	"move_8_aw_pcix",
+	"move_8_aw_i",
+	"move_8_al_d",
+	"move_8_al_ai",
+	"move_8_al_pi",
+	"move_8_al_pi7",
+	"move_8_al_pd",
+	"move_8_al_pd7",
+	"move_8_al_di",
+	"move_8_al_ix",
+	"move_8_al_aw",
+	"move_8_al_al",
+	"move_8_al_pcdi",
+	"move_8_al_pcix",
+	"move_8_al_i",
+	"move_8_pi7_d",
+	"move_8_pi7_ai",
+	"move_8_pi7_pi",
+	"move_8_pi7_pi7",
+	"move_8_pi7_pd",
+	"move_8_pi7_pd7",
+	"move_8_pi7_di",
+	"move_8_pi7_ix",
+	"move_8_pi7_aw",
+	"move_8_pi7_al",
+	"move_8_pi7_pcdi",
+	"move_8_pi7_pcix",
+	"move_8_pi7_i",
+	"move_8_pd7_d",
+	"move_8_pd7_ai",
+	"move_8_pd7_pi",
+	"move_8_pd7_pi7",
+	"move_8_pd7_pd",
+	"move_8_pd7_pd7",
+	"move_8_pd7_di",
+	"move_8_pd7_ix",
+	"move_8_pd7_aw",
+	"move_8_pd7_al",
+	"move_8_pd7_pcdi",
+	"move_8_pd7_pcix",
+	"move_8_pd7_i",
+	"move_32_d_d",
+	"move_32_d_a",
+	"move_32_d_ai",
+	"move_32_d_pi",
+	"move_32_d_pd",
+	"move_32_d_di",
+	"move_32_d_ix",
+	"move_32_d_aw",
+	"move_32_d_al",
+	"move_32_d_pcdi",
+	"move_32_d_pcix",
+	"move_32_d_i",
+	"movea_32_d",
+	"movea_32_a",
+	"movea_32_ai",
+	"movea_32_pi",
+	"movea_32_pd",
+	"movea_32_di",
+	"movea_32_ix",
+	"movea_32_aw",
+	"movea_32_al",
+	"movea_32_pcdi",
+	"movea_32_pcix",
+	"movea_32_i",
+	"move_32_ai_d",
+	"move_32_ai_a",
+	"move_32_ai_ai",
+	"move_32_ai_pi",
+	"move_32_ai_pd",
+	"move_32_ai_di",
+	"move_32_ai_ix",
+	"move_32_ai_aw",
+	"move_32_ai_al",
+	"move_32_ai_pcdi",
+	"move_32_ai_pcix",
+	"move_32_ai_i",
+	"move_32_pi_d",
+	"move_32_pi_a",
+	"move_32_pi_ai",
+	"move_32_pi_pi",
+	"move_32_pi_pd",
+	"move_32_pi_di",
+	"move_32_pi_ix",
+	"move_32_pi_aw",
+	"move_32_pi_al",
+	"move_32_pi_pcdi",
+	"move_32_pi_pcix",
+	"move_32_pi_i",
+	"move_32_pd_d",
+	"move_32_pd_a",
+	"move_32_pd_ai",
+	"move_32_pd_pi",
+	"move_32_pd_pd",
+	"move_32_pd_di",
+	"move_32_pd_ix",
+	"move_32_pd_aw",
+	"move_32_pd_al",
+	"move_32_pd_pcdi",
+	"move_32_pd_pcix",
+	"move_32_pd_i",
+	"move_32_di_d",
+	"move_32_di_a",
+	"move_32_di_ai",
+	"move_32_di_pi",
+	"move_32_di_pd",
+	"move_32_di_di",
+	"move_32_di_ix",
+	"move_32_di_aw",
+	"move_32_di_al",
+	"move_32_di_pcdi",
+	"move_32_di_pcix",
+	"move_32_di_i",
+	"move_32_ix_d",
+	"move_32_ix_a",
+	"move_32_ix_ai",
+	"move_32_ix_pi",
+	"move_32_ix_pd",
+	"move_32_ix_di",
+	"move_32_ix_ix",
+	"move_32_ix_aw",
+	"move_32_ix_al",
+	"move_32_ix_pcdi",
+	"move_32_ix_pcix",
+	"move_32_ix_i",
+	"move_32_aw_d",
+	"move_32_aw_a",
+	"move_32_aw_ai",
+	"move_32_aw_pi",
+	"move_32_aw_pd",
+	"move_32_aw_di",
+	"move_32_aw_ix",
+	"move_32_aw_aw",
+	"move_32_aw_al",
+	"move_32_aw_pcdi",
+	"move_32_aw_pcix",
+	"move_32_aw_i",
+	"move_32_al_d",
+	"move_32_al_a",
+	"move_32_al_ai",
+	"move_32_al_pi",
+	"move_32_al_pd",
+	"move_32_al_di",
+	"move_32_al_ix",
+	"move_32_al_aw",
+	"move_32_al_al",
+	"move_32_al_pcdi",
+	"move_32_al_pcix",
+	"move_32_al_i",
+	"move_16_d_d",
+	"move_16_d_a",
+	"move_16_d_ai",
+	"move_16_d_pi",
+	"move_16_d_pd",
+	"move_16_d_di",
+	"move_16_d_ix",
+	"move_16_d_aw",
+	"move_16_d_al",
+	"move_16_d_pcdi",
+	"move_16_d_pcix",
+	"move_16_d_i",
+	"movea_16_d",
+	"movea_16_a",
+	"movea_16_ai",
+	"movea_16_pi",
+	"movea_16_pd",
+	"movea_16_di",
+	"movea_16_ix",
+	"movea_16_aw",
+	"movea_16_al",
+	"movea_16_pcdi",
+	"movea_16_pcix",
+	"movea_16_i",
+	"move_16_ai_d",
+	"move_16_ai_a",
+	"move_16_ai_ai",
+	"move_16_ai_pi",
+	"move_16_ai_pd",
+	"move_16_ai_di",
+	"move_16_ai_ix",
+	"move_16_ai_aw",
+	"move_16_ai_al",
+	"move_16_ai_pcdi",
+	"move_16_ai_pcix",
+	"move_16_ai_i",
+	"move_16_pi_d",
+	"move_16_pi_a",
+	"move_16_pi_ai",
+	"move_16_pi_pi",
+	"move_16_pi_pd",
+	"move_16_pi_di",
+	"move_16_pi_ix",
+	"move_16_pi_aw",
+	"move_16_pi_al",
+	"move_16_pi_pcdi",
+	"move_16_pi_pcix",
+	"move_16_pi_i",
+	"move_16_pd_d",
+	"move_16_pd_a",
+	"move_16_pd_ai",
+	"move_16_pd_pi",
+	"move_16_pd_pd",
+	"move_16_pd_di",
+	"move_16_pd_ix",
+	"move_16_pd_aw",
+	"move_16_pd_al",
+	"move_16_pd_pcdi",
+	"move_16_pd_pcix",
+	"move_16_pd_i",
+	"move_16_di_d",
+	"move_16_di_a",
+	"move_16_di_ai",
+	"move_16_di_pi",
+	"move_16_di_pd",
+	"move_16_di_di",
+	"move_16_di_ix",
+	"move_16_di_aw",
+	"move_16_di_al",
+	"move_16_di_pcdi",
+	"move_16_di_pcix",
+	"move_16_di_i",
+	"move_16_ix_d",
+	"move_16_ix_a",
+	"move_16_ix_ai",
+	"move_16_ix_pi",
+	"move_16_ix_pd",
+	"move_16_ix_di",
+	"move_16_ix_ix",
+	"move_16_ix_aw",
+	"move_16_ix_al",
+	"move_16_ix_pcdi",
+	"move_16_ix_pcix",
+	"move_16_ix_i",
+	"move_16_aw_d",
+	"move_16_aw_a",
+	"move_16_aw_ai",
+	"move_16_aw_pi",
+	"move_16_aw_pd",
+	"move_16_aw_di",
+	"move_16_aw_ix",
+	"move_16_aw_aw",
+	"move_16_aw_al",
+	"move_16_aw_pcdi",
+	"move_16_aw_pcix",
+	"move_16_aw_i",
+	"move_16_al_d",
+	"move_16_al_a",
+	"move_16_al_ai",
+	"move_16_al_pi",
+	"move_16_al_pd",
+	"move_16_al_di",
+	"move_16_al_ix",
+	"move_16_al_aw",
+	"move_16_al_al",
+	"move_16_al_pcdi",
+	"move_16_al_pcix",
+	"move_16_al_i",
+	"negx_8_d",
+	"negx_8_ai",
+	"negx_8_pi",
+	"negx_8_pi7",
+	"negx_8_pd",
+	"negx_8_pd7",
+	"negx_8_di",
+	"negx_8_ix",
+	"negx_8_aw",
+	"negx_8_al",
+	"negx_16_d",
+	"negx_16_ai",
+	"negx_16_pi",
+	"negx_16_pd",
+	"negx_16_di",
+	"negx_16_ix",
+	"negx_16_aw",
+	"negx_16_al",
+	"negx_32_d",
+	"negx_32_ai",
+	"negx_32_pi",
+	"negx_32_pd",
+	"negx_32_di",
+	"negx_32_ix",
+	"negx_32_aw",
+	"negx_32_al",
+	"move_16_frs_d",
+	"move_16_frs_ai",
+	"move_16_frs_pi",
+	"move_16_frs_pd",
+	"move_16_frs_di",
+	"move_16_frs_ix",
+	"move_16_frs_aw",
+	"move_16_frs_al",
+	"chk_16_d",
+	"chk_16_ai",
+	"chk_16_pi",
+	"chk_16_pd",
+	"chk_16_di",
+	"chk_16_ix",
+	"chk_16_aw",
+	"chk_16_al",
+	"chk_16_pcdi",
+	"chk_16_pcix",
+	"chk_16_i",
+	"lea_32_ai",
+	"lea_32_di",
+	"lea_32_ix",
+	"lea_32_aw",
+	"lea_32_al",
+	"lea_32_pcdi",
+	"lea_32_pcix",
+	"clr_8_d",
+	"clr_8_ai",
+	"clr_8_pi",
+	"clr_8_pi7",
+	"clr_8_pd",
+	"clr_8_pd7",
+	"clr_8_di",
+	"clr_8_ix",
+	"clr_8_aw",
+	"clr_8_al",
+	"clr_16_d",
+	"clr_16_ai",
+	"clr_16_pi",
+	"clr_16_pd",
+	"clr_16_di",
+	"clr_16_ix",
+	"clr_16_aw",
+	"clr_16_al",
+	"clr_32_d",
+	"clr_32_ai",
+	"clr_32_pi",
+	"clr_32_pd",
+	"clr_32_di",
+	"clr_32_ix",
+	"clr_32_aw",
+	"clr_32_al",
+	"neg_8_d",
+	"neg_8_ai",
+	"neg_8_pi",
+	"neg_8_pi7",
+	"neg_8_pd",
+	"neg_8_pd7",
+	"neg_8_di",
+	"neg_8_ix",
+	"neg_8_aw",
+	"neg_8_al",
+	"neg_16_d",
+	"neg_16_ai",
+	"neg_16_pi",
+	"neg_16_pd",
+	"neg_16_di",
+	"neg_16_ix",
+	"neg_16_aw",
+	"neg_16_al",
+	"neg_32_d",
+	"neg_32_ai",
+	"neg_32_pi",
+	"neg_32_pd",
+	"neg_32_di",
+	"neg_32_ix",
+	"neg_32_aw",
+	"neg_32_al",
+	"move_16_toc_d",
+	"move_16_toc_ai",
+	"move_16_toc_pi",
+	"move_16_toc_pd",
+	"move_16_toc_di",
+	"move_16_toc_ix",
+	"move_16_toc_aw",
+	"move_16_toc_al",
+	"move_16_toc_pcdi",
+	"move_16_toc_pcix",
+	"move_16_toc_i",
+	"not_8_d",
+	"not_8_ai",
+	"not_8_pi",
+	"not_8_pi7",
+	"not_8_pd",
+	"not_8_pd7",
+	"not_8_di",
+	"not_8_ix",
+	"not_8_aw",
+	"not_8_al",
+	"not_16_d",
+	"not_16_ai",
+	"not_16_pi",
+	"not_16_pd",
+	"not_16_di",
+	"not_16_ix",
+	"not_16_aw",
+	"not_16_al",
+	"not_32_d",
+	"not_32_ai",
+	"not_32_pi",
+	"not_32_pd",
+	"not_32_di",
+	"not_32_ix",
+	"not_32_aw",
+	"not_32_al",
+	"move_16_tos_d",
+	"move_16_tos_ai",
+	"move_16_tos_pi",
+	"move_16_tos_pd",
+	"move_16_tos_di",
+	"move_16_tos_ix",
+	"move_16_tos_aw",
+	"move_16_tos_al",
+	"move_16_tos_pcdi",
+	"move_16_tos_pcix",
+	"move_16_tos_i",
+	"nbcd_8_d",
+	"nbcd_8_ai",
+	"nbcd_8_pi",
+	"nbcd_8_pi7",
+	"nbcd_8_pd",
+	"nbcd_8_pd7",
+	"nbcd_8_di",
+	"nbcd_8_ix",
+	"nbcd_8_aw",
+	"nbcd_8_al",
+	"swap_32",
+	"pea_32_ai",
+	"pea_32_di",
+	"pea_32_ix",
+	"pea_32_aw",
+	"pea_32_al",
+	"pea_32_pcdi",
+	"pea_32_pcix",
+	"ext_16",
+	"movem_16_re_ai",
+	"movem_16_re_pd",
+	"movem_16_re_di",
+	"movem_16_re_ix",
+	"movem_16_re_aw",
+	"movem_16_re_al",
+	"ext_32",
+	"movem_32_re_ai",
+	"movem_32_re_pd",
+	"movem_32_re_di",
+	"movem_32_re_ix",
+	"movem_32_re_aw",
+	"movem_32_re_al",
+	"tst_8_d",
+	"tst_8_ai",
+	"tst_8_pi",
+	"tst_8_pi7",
+	"tst_8_pd",
+	"tst_8_pd7",
+	"tst_8_di",
+	"tst_8_ix",
+	"tst_8_aw",
+	"tst_8_al",
+	"tst_16_d",
+	"tst_16_ai",
+	"tst_16_pi",
+	"tst_16_pd",
+	"tst_16_di",
+	"tst_16_ix",
+	"tst_16_aw",
+	"tst_16_al",
+	"tst_32_d",
+	"tst_32_ai",
+	"tst_32_pi",
+	"tst_32_pd",
+	"tst_32_di",
+	"tst_32_ix",
+	"tst_32_aw",
+	"tst_32_al",
+	"tas_8_d",
+	"tas_8_ai",
+	"tas_8_pi",
+	"tas_8_pi7",
+	"tas_8_pd",
+	"tas_8_pd7",
+	"tas_8_di",
+	"tas_8_ix",
+	"tas_8_aw",
+	"tas_8_al",
+	"illegal",
+	"movem_16_er_ai",
+	"movem_16_er_pi",
+	"movem_16_er_di",
+	"movem_16_er_ix",
+	"movem_16_er_aw",
+	"movem_16_er_al",
+	"movem_16_er_pcdi",
+	"movem_16_er_pcix",
+	"movem_32_er_ai",
+	"movem_32_er_pi",
+	"movem_32_er_di",
+	"movem_32_er_ix",
+	"movem_32_er_aw",
+	"movem_32_er_al",
+	"movem_32_er_pcdi",
+	"movem_32_er_pcix",
+	"trap",
+	"link_16",
+	"link_16_a7",
+	"unlk_32",
+	"unlk_32_a7",
+	"move_32_tou",
+	"move_32_fru",
+	"reset",
+	"nop",
+	"stop",
+	"rte_32",
+	"rts_32",
+	"trapv",
+	"rtr_32",
+	"jsr_32_ai",
+	"jsr_32_di",
+	"jsr_32_ix",
+	"jsr_32_aw",
+	"jsr_32_al",
+	"jsr_32_pcdi",
+	"jsr_32_pcix",
+	"jmp_32_ai",
+	"jmp_32_di",
+	"jmp_32_ix",
+	"jmp_32_aw",
+	"jmp_32_al",
+	"jmp_32_pcdi",
+	"jmp_32_pcix",
+	"addq_8_d",
+	"addq_8_ai",
+	"addq_8_pi",
+	"addq_8_pi7",
+	"addq_8_pd",
+	"addq_8_pd7",
+	"addq_8_di",
+	"addq_8_ix",
+	"addq_8_aw",
+	"addq_8_al",
+	"addq_16_d",
+	"addq_16_a",
+	"addq_16_ai",
+	"addq_16_pi",
+	"addq_16_pd",
+	"addq_16_di",
+	"addq_16_ix",
+	"addq_16_aw",
+	"addq_16_al",
+	"addq_32_d",
+	"addq_32_a",
+	"addq_32_ai",
+	"addq_32_pi",
+	"addq_32_pd",
+	"addq_32_di",
+	"addq_32_ix",
+	"addq_32_aw",
+	"addq_32_al",
+	"st_8_d",
+	"dbt_16",
+	"st_8_ai",
+	"st_8_pi",
+	"st_8_pi7",
+	"st_8_pd",
+	"st_8_pd7",
+	"st_8_di",
+	"st_8_ix",
+	"st_8_aw",
+	"st_8_al",
+	"subq_8_d",
+	"subq_8_ai",
+	"subq_8_pi",
+	"subq_8_pi7",
+	"subq_8_pd",
+	"subq_8_pd7",
+	"subq_8_di",
+	"subq_8_ix",
+	"subq_8_aw",
+	"subq_8_al",
+	"subq_16_d",
+	"subq_16_a",
+	"subq_16_ai",
+	"subq_16_pi",
+	"subq_16_pd",
+	"subq_16_di",
+	"subq_16_ix",
+	"subq_16_aw",
+	"subq_16_al",
+	"subq_32_d",
+	"subq_32_a",
+	"subq_32_ai",
+	"subq_32_pi",
+	"subq_32_pd",
+	"subq_32_di",
+	"subq_32_ix",
+	"subq_32_aw",
+	"subq_32_al",
+	"sf_8_d",
+	"dbf_16",
+	"sf_8_ai",
+	"sf_8_pi",
+	"sf_8_pi7",
+	"sf_8_pd",
+	"sf_8_pd7",
+	"sf_8_di",
+	"sf_8_ix",
+	"sf_8_aw",
+	"sf_8_al",
+	"shi_8_d",
+	"dbhi_16",
+	"shi_8_ai",
+	"shi_8_pi",
+	"shi_8_pi7",
+	"shi_8_pd",
+	"shi_8_pd7",
+	"shi_8_di",
+	"shi_8_ix",
+	"shi_8_aw",
+	"shi_8_al",
+	"sls_8_d",
+	"dbls_16",
+	"sls_8_ai",
+	"sls_8_pi",
+	"sls_8_pi7",
+	"sls_8_pd",
+	"sls_8_pd7",
+	"sls_8_di",
+	"sls_8_ix",
+	"sls_8_aw",
+	"sls_8_al",
+	"scc_8_d",
+	"dbcc_16",
+	"scc_8_ai",
+	"scc_8_pi",
+	"scc_8_pi7",
+	"scc_8_pd",
+	"scc_8_pd7",
+	"scc_8_di",
+	"scc_8_ix",
+	"scc_8_aw",
+	"scc_8_al",
+	"scs_8_d",
+	"dbcs_16",
+	"scs_8_ai",
+	"scs_8_pi",
+	"scs_8_pi7",
+	"scs_8_pd",
+	"scs_8_pd7",
+	"scs_8_di",
+	"scs_8_ix",
+	"scs_8_aw",
+	"scs_8_al",
+	"sne_8_d",
+	"dbne_16",
+	"sne_8_ai",
+	"sne_8_pi",
+	"sne_8_pi7",
+	"sne_8_pd",
+	"sne_8_pd7",
+	"sne_8_di",
+	"sne_8_ix",
+	"sne_8_aw",
+	"sne_8_al",
+	"seq_8_d",
+	"dbeq_16",
+	"seq_8_ai",
+	"seq_8_pi",
+	"seq_8_pi7",
+	"seq_8_pd",
+	"seq_8_pd7",
+	"seq_8_di",
+	"seq_8_ix",
+	"seq_8_aw",
+	"seq_8_al",
+	"svc_8_d",
+	"dbvc_16",
+	"svc_8_ai",
+	"svc_8_pi",
+	"svc_8_pi7",
+	"svc_8_pd",
+	"svc_8_pd7",
+	"svc_8_di",
+	"svc_8_ix",
+	"svc_8_aw",
+	"svc_8_al",
+	"svs_8_d",
+	"dbvs_16",
+	"svs_8_ai",
+	"svs_8_pi",
+	"svs_8_pi7",
+	"svs_8_pd",
+	"svs_8_pd7",
+	"svs_8_di",
+	"svs_8_ix",
+	"svs_8_aw",
+	"svs_8_al",
+	"spl_8_d",
+	"dbpl_16",
+	"spl_8_ai",
+	"spl_8_pi",
+	"spl_8_pi7",
+	"spl_8_pd",
+	"spl_8_pd7",
+	"spl_8_di",
+	"spl_8_ix",
+	"spl_8_aw",
+	"spl_8_al",
+	"smi_8_d",
+	"dbmi_16",
+	"smi_8_ai",
+	"smi_8_pi",
+	"smi_8_pi7",
+	"smi_8_pd",
+	"smi_8_pd7",
+	"smi_8_di",
+	"smi_8_ix",
+	"smi_8_aw",
+	"smi_8_al",
+	"sge_8_d",
+	"dbge_16",
+	"sge_8_ai",
+	"sge_8_pi",
+	"sge_8_pi7",
+	"sge_8_pd",
+	"sge_8_pd7",
+	"sge_8_di",
+	"sge_8_ix",
+	"sge_8_aw",
+	"sge_8_al",
+	"slt_8_d",
+	"dblt_16",
+	"slt_8_ai",
+	"slt_8_pi",
+	"slt_8_pi7",
+	"slt_8_pd",
+	"slt_8_pd7",
+	"slt_8_di",
+	"slt_8_ix",
+	"slt_8_aw",
+	"slt_8_al",
+	"sgt_8_d",
+	"dbgt_16",
+	"sgt_8_ai",
+	"sgt_8_pi",
+	"sgt_8_pi7",
+	"sgt_8_pd",
+	"sgt_8_pd7",
+	"sgt_8_di",
+	"sgt_8_ix",
+	"sgt_8_aw",
+	"sgt_8_al",
+	"sle_8_d",
+	"dble_16",
+	"sle_8_ai",
+	"sle_8_pi",
+	"sle_8_pi7",
+	"sle_8_pd",
+	"sle_8_pd7",
+	"sle_8_di",
+	"sle_8_ix",
+	"sle_8_aw",
+	"sle_8_al",
+	"bra_16",
+	"bra_8",
+	"bsr_16",
+	"bsr_8",
+	"bhi_16",
+	"bhi_8",
+	"bls_16",
+	"bls_8",
+	"bcc_16",
+	"bcc_8",
+	"bcs_16",
+	"bcs_8",
+	"bne_16",
+	"bne_8",
+	"beq_16",
+	"beq_8",
+	"bvc_16",
+	"bvc_8",
+	"bvs_16",
+	"bvs_8",
+	"bpl_16",
+	"bpl_8",
+	"bmi_16",
+	"bmi_8",
+	"bge_16",
+	"bge_8",
+	"blt_16",
+	"blt_8",
+	"bgt_16",
+	"bgt_8",
+	"ble_16",
+	"ble_8",
+	"moveq_32",
+	"or_8_er_d",
+	"or_8_er_ai",
+	"or_8_er_pi",
+	"or_8_er_pi7",
+	"or_8_er_pd",
+	"or_8_er_pd7",
+	"or_8_er_di",
+	"or_8_er_ix",
+	"or_8_er_aw",
+	"or_8_er_al",
+	"or_8_er_pcdi",
+	"or_8_er_pcix",
+	"or_8_er_i",
+	"or_16_er_d",
+	"or_16_er_ai",
+	"or_16_er_pi",
+	"or_16_er_pd",
+	"or_16_er_di",
+	"or_16_er_ix",
+	"or_16_er_aw",
+	"or_16_er_al",
+	"or_16_er_pcdi",
+	"or_16_er_pcix",
+	"or_16_er_i",
+	"or_32_er_d",
+	"or_32_er_ai",
+	"or_32_er_pi",
+	"or_32_er_pd",
+	"or_32_er_di",
+	"or_32_er_ix",
+	"or_32_er_aw",
+	"or_32_er_al",
+	"or_32_er_pcdi",
+	"or_32_er_pcix",
+	"or_32_er_i",
+	"divu_16_d",
+	"divu_16_ai",
+	"divu_16_pi",
+	"divu_16_pd",
+	"divu_16_di",
+	"divu_16_ix",
+	"divu_16_aw",
+	"divu_16_al",
+	"divu_16_pcdi",
+	"divu_16_pcix",
+	"divu_16_i",
+	"sbcd_8_rr",
+	"sbcd_8_mm",
+	"sbcd_8_mm_ay7",
+	"or_8_re_ai",
+	"or_8_re_pi",
+	"or_8_re_pi7",
+	"or_8_re_pd",
+	"or_8_re_pd7",
+	"or_8_re_di",
+	"or_8_re_ix",
+	"or_8_re_aw",
+	"or_8_re_al",
+	"or_16_re_ai",
+	"or_16_re_pi",
+	"or_16_re_pd",
+	"or_16_re_di",
+	"or_16_re_ix",
+	"or_16_re_aw",
+	"or_16_re_al",
+	"or_32_re_ai",
+	"or_32_re_pi",
+	"or_32_re_pd",
+	"or_32_re_di",
+	"or_32_re_ix",
+	"or_32_re_aw",
+	"or_32_re_al",
+	"divs_16_d",
+	"divs_16_ai",
+	"divs_16_pi",
+	"divs_16_pd",
+	"divs_16_di",
+	"divs_16_ix",
+	"divs_16_aw",
+	"divs_16_al",
+	"divs_16_pcdi",
+	"divs_16_pcix",
+	"divs_16_i",
+	"sbcd_8_mm_ax7",
+	"sbcd_8_mm_axy7",
+	"sub_8_er_d",
+	"sub_8_er_ai",
+	"sub_8_er_pi",
+	"sub_8_er_pi7",
+	"sub_8_er_pd",
+	"sub_8_er_pd7",
+	"sub_8_er_di",
+	"sub_8_er_ix",
+	"sub_8_er_aw",
+	"sub_8_er_al",
+	"sub_8_er_pcdi",
+	"sub_8_er_pcix",
+	"sub_8_er_i",
+	"sub_16_er_d",
+	"sub_16_er_a",
+	"sub_16_er_ai",
+	"sub_16_er_pi",
+	"sub_16_er_pd",
+	"sub_16_er_di",
+	"sub_16_er_ix",
+	"sub_16_er_aw",
+	"sub_16_er_al",
+	"sub_16_er_pcdi",
+	"sub_16_er_pcix",
+	"sub_16_er_i",
+	"sub_32_er_d",
+	"sub_32_er_a",
+	"sub_32_er_ai",
+	"sub_32_er_pi",
+	"sub_32_er_pd",
+	"sub_32_er_di",
+	"sub_32_er_ix",
+	"sub_32_er_aw",
+	"sub_32_er_al",
+	"sub_32_er_pcdi",
+	"sub_32_er_pcix",
+	"sub_32_er_i",
+	"suba_16_d",
+	"suba_16_a",
+	"suba_16_ai",
+	"suba_16_pi",
+	"suba_16_pd",
+	"suba_16_di",
+	"suba_16_ix",
+	"suba_16_aw",
+	"suba_16_al",
+	"suba_16_pcdi",
+	"suba_16_pcix",
+	"suba_16_i",
+	"subx_8_rr",
+	"subx_8_mm",
+	"subx_8_mm_ay7",
+	"sub_8_re_ai",
+	"sub_8_re_pi",
+	"sub_8_re_pi7",
+	"sub_8_re_pd",
+	"sub_8_re_pd7",
+	"sub_8_re_di",
+	"sub_8_re_ix",
+	"sub_8_re_aw",
+	"sub_8_re_al",
+	"subx_16_rr",
+	"subx_16_mm",
+	"sub_16_re_ai",
+	"sub_16_re_pi",
+	"sub_16_re_pd",
+	"sub_16_re_di",
+	"sub_16_re_ix",
+	"sub_16_re_aw",
+	"sub_16_re_al",
+	"subx_32_rr",
+	"subx_32_mm",
+	"sub_32_re_ai",
+	"sub_32_re_pi",
+	"sub_32_re_pd",
+	"sub_32_re_di",
+	"sub_32_re_ix",
+	"sub_32_re_aw",
+	"sub_32_re_al",
+	"suba_32_d",
+	"suba_32_a",
+	"suba_32_ai",
+	"suba_32_pi",
+	"suba_32_pd",
+	"suba_32_di",
+	"suba_32_ix",
+	"suba_32_aw",
+	"suba_32_al",
+	"suba_32_pcdi",
+	"suba_32_pcix",
+	"suba_32_i",
+	"subx_8_mm_ax7",
+	"subx_8_mm_axy7",
+	"1010",
+	"cmp_8_d",
+	"cmp_8_ai",
+	"cmp_8_pi",
+	"cmp_8_pi7",
+	"cmp_8_pd",
+	"cmp_8_pd7",
+	"cmp_8_di",
+	"cmp_8_ix",
+	"cmp_8_aw",
+	"cmp_8_al",
+	"cmp_8_pcdi",
+	"cmp_8_pcix",
+	"cmp_8_i",
+	"cmp_16_d",
+	"cmp_16_a",
+	"cmp_16_ai",
+	"cmp_16_pi",
+	"cmp_16_pd",
+	"cmp_16_di",
+	"cmp_16_ix",
+	"cmp_16_aw",
+	"cmp_16_al",
+	"cmp_16_pcdi",
+	"cmp_16_pcix",
+	"cmp_16_i",
+	"cmp_32_d",
+	"cmp_32_a",
+	"cmp_32_ai",
+	"cmp_32_pi",
+	"cmp_32_pd",
+	"cmp_32_di",
+	"cmp_32_ix",
+	"cmp_32_aw",
+	"cmp_32_al",
+	"cmp_32_pcdi",
+	"cmp_32_pcix",
+	"cmp_32_i",
+	"cmpa_16_d",
+	"cmpa_16_a",
+	"cmpa_16_ai",
+	"cmpa_16_pi",
+	"cmpa_16_pd",
+	"cmpa_16_di",
+	"cmpa_16_ix",
+	"cmpa_16_aw",
+	"cmpa_16_al",
+	"cmpa_16_pcdi",
+	"cmpa_16_pcix",
+	"cmpa_16_i",
+	"eor_8_d",
+	"cmpm_8",
+	"cmpm_8_ay7",
+	"eor_8_ai",
+	"eor_8_pi",
+	"eor_8_pi7",
+	"eor_8_pd",
+	"eor_8_pd7",
+	"eor_8_di",
+	"eor_8_ix",
+	"eor_8_aw",
+	"eor_8_al",
+	"eor_16_d",
+	"cmpm_16",
+	"eor_16_ai",
+	"eor_16_pi",
+	"eor_16_pd",
+	"eor_16_di",
+	"eor_16_ix",
+	"eor_16_aw",
+	"eor_16_al",
+	"eor_32_d",
+	"cmpm_32",
+	"eor_32_ai",
+	"eor_32_pi",
+	"eor_32_pd",
+	"eor_32_di",
+	"eor_32_ix",
+	"eor_32_aw",
+	"eor_32_al",
+	"cmpa_32_d",
+	"cmpa_32_a",
+	"cmpa_32_ai",
+	"cmpa_32_pi",
+	"cmpa_32_pd",
+	"cmpa_32_di",
+	"cmpa_32_ix",
+	"cmpa_32_aw",
+	"cmpa_32_al",
+	"cmpa_32_pcdi",
+	"cmpa_32_pcix",
+	"cmpa_32_i",
+	"cmpm_8_ax7",
+	"cmpm_8_axy7",
+	"and_8_er_d",
+	"and_8_er_ai",
+	"and_8_er_pi",
+	"and_8_er_pi7",
+	"and_8_er_pd",
+	"and_8_er_pd7",
+	"and_8_er_di",
+	"and_8_er_ix",
+	"and_8_er_aw",
+	"and_8_er_al",
+	"and_8_er_pcdi",
+	"and_8_er_pcix",
+	"and_8_er_i",
+	"and_16_er_d",
+	"and_16_er_ai",
+	"and_16_er_pi",
+	"and_16_er_pd",
+	"and_16_er_di",
+	"and_16_er_ix",
+	"and_16_er_aw",
+	"and_16_er_al",
+	"and_16_er_pcdi",
+	"and_16_er_pcix",
+	"and_16_er_i",
+	"and_32_er_d",
+	"and_32_er_ai",
+	"and_32_er_pi",
+	"and_32_er_pd",
+	"and_32_er_di",
+	"and_32_er_ix",
+	"and_32_er_aw",
+	"and_32_er_al",
+	"and_32_er_pcdi",
+	"and_32_er_pcix",
+	"and_32_er_i",
+	"mulu_16_d",
+	"mulu_16_ai",
+	"mulu_16_pi",
+	"mulu_16_pd",
+	"mulu_16_di",
+	"mulu_16_ix",
+	"mulu_16_aw",
+	"mulu_16_al",
+	"mulu_16_pcdi",
+	"mulu_16_pcix",
+	"mulu_16_i",
+	"abcd_8_rr",
+	"abcd_8_mm",
+	"abcd_8_mm_ay7",
+	"and_8_re_ai",
+	"and_8_re_pi",
+	"and_8_re_pi7",
+	"and_8_re_pd",
+	"and_8_re_pd7",
+	"and_8_re_di",
+	"and_8_re_ix",
+	"and_8_re_aw",
+	"and_8_re_al",
+	"exg_32_dd",
+	"exg_32_aa",
+	"and_16_re_ai",
+	"and_16_re_pi",
+	"and_16_re_pd",
+	"and_16_re_di",
+	"and_16_re_ix",
+	"and_16_re_aw",
+	"and_16_re_al",
+	"exg_32_da",
+	"and_32_re_ai",
+	"and_32_re_pi",
+	"and_32_re_pd",
+	"and_32_re_di",
+	"and_32_re_ix",
+	"and_32_re_aw",
+	"and_32_re_al",
+	"muls_16_d",
+	"muls_16_ai",
+	"muls_16_pi",
+	"muls_16_pd",
+	"muls_16_di",
+	"muls_16_ix",
+	"muls_16_aw",
+	"muls_16_al",
+	"muls_16_pcdi",
+	"muls_16_pcix",
+	"muls_16_i",
+	"abcd_8_mm_ax7",
+	"abcd_8_mm_axy7",
+	"add_8_er_d",
+	"add_8_er_ai",
+	"add_8_er_pi",
+	"add_8_er_pi7",
+	"add_8_er_pd",
+	"add_8_er_pd7",
+	"add_8_er_di",
+	"add_8_er_ix",
+	"add_8_er_aw",
+	"add_8_er_al",
+	"add_8_er_pcdi",
+	"add_8_er_pcix",
+	"add_8_er_i",
+	"add_16_er_d",
+	"add_16_er_a",
+	"add_16_er_ai",
+	"add_16_er_pi",
+	"add_16_er_pd",
+	"add_16_er_di",
+	"add_16_er_ix",
+	"add_16_er_aw",
+	"add_16_er_al",
+	"add_16_er_pcdi",
+	"add_16_er_pcix",
+	"add_16_er_i",
+	"add_32_er_d",
+	"add_32_er_a",
+	"add_32_er_ai",
+	"add_32_er_pi",
+	"add_32_er_pd",
+	"add_32_er_di",
+	"add_32_er_ix",
+	"add_32_er_aw",
+	"add_32_er_al",
+	"add_32_er_pcdi",
+	"add_32_er_pcix",
+	"add_32_er_i",
+	"adda_16_d",
+	"adda_16_a",
+	"adda_16_ai",
+	"adda_16_pi",
+	"adda_16_pd",
+	"adda_16_di",
+	"adda_16_ix",
+	"adda_16_aw",
+	"adda_16_al",
+	"adda_16_pcdi",
+	"adda_16_pcix",
+	"adda_16_i",
+	"addx_8_rr",
+	"addx_8_mm",
+	"addx_8_mm_ay7",
+	"add_8_re_ai",
+	"add_8_re_pi",
+	"add_8_re_pi7",
+	"add_8_re_pd",
+	"add_8_re_pd7",
+	"add_8_re_di",
+	"add_8_re_ix",
+	"add_8_re_aw",
+	"add_8_re_al",
+	"addx_16_rr",
+	"addx_16_mm",
+	"add_16_re_ai",
+	"add_16_re_pi",
+	"add_16_re_pd",
+	"add_16_re_di",
+	"add_16_re_ix",
+	"add_16_re_aw",
+	"add_16_re_al",
+	"addx_32_rr",
+	"addx_32_mm",
+	"add_32_re_ai",
+	"add_32_re_pi",
+	"add_32_re_pd",
+	"add_32_re_di",
+	"add_32_re_ix",
+	"add_32_re_aw",
+	"add_32_re_al",
+	"adda_32_d",
+	"adda_32_a",
+	"adda_32_ai",
+	"adda_32_pi",
+	"adda_32_pd",
+	"adda_32_di",
+	"adda_32_ix",
+	"adda_32_aw",
+	"adda_32_al",
+	"adda_32_pcdi",
+	"adda_32_pcix",
+	"adda_32_i",
+	"addx_8_mm_ax7",
+	"addx_8_mm_axy7",
+	"asr_8_s",
+	"lsr_8_s",
+	"roxr_8_s",
+	"ror_8_s",
+	"asr_8_r",
+	"lsr_8_r",
+	"roxr_8_r",
+	"ror_8_r",
+	"asr_16_s",
+	"lsr_16_s",
+	"roxr_16_s",
+	"ror_16_s",
+	"asr_16_r",
+	"lsr_16_r",
+	"roxr_16_r",
+	"ror_16_r",
+	"asr_32_s",
+	"lsr_32_s",
+	"roxr_32_s",
+	"ror_32_s",
+	"asr_32_r",
+	"lsr_32_r",
+	"roxr_32_r",
+	"ror_32_r",
+	"asr_16_ai",
+	"asr_16_pi",
+	"asr_16_pd",
+	"asr_16_di",
+	"asr_16_ix",
+	"asr_16_aw",
+	"asr_16_al",
+	"asl_8_s",
+	"lsl_8_s",
+	"roxl_8_s",
+	"rol_8_s",
+	"asl_8_r",
+	"lsl_8_r",
+	"roxl_8_r",
+	"rol_8_r",
+	"asl_16_s",
+	"lsl_16_s",
+	"roxl_16_s",
+	"rol_16_s",
+	"asl_16_r",
+	"lsl_16_r",
+	"roxl_16_r",
+	"rol_16_r",
+	"asl_32_s",
+	"lsl_32_s",
+	"roxl_32_s",
+	"rol_32_s",
+	"asl_32_r",
+	"lsl_32_r",
+	"roxl_32_r",
+	"rol_32_r",
+	"asl_16_ai",
+	"asl_16_pi",
+	"asl_16_pd",
+	"asl_16_di",
+	"asl_16_ix",
+	"asl_16_aw",
+	"asl_16_al",
+	"asr_8_s",
+	"lsr_8_s",
+	"roxr_8_s",
+	"ror_8_s",
+	"asr_16_s",
+	"lsr_16_s",
+	"roxr_16_s",
+	"ror_16_s",
+	"asr_32_s",
+	"lsr_32_s",
+	"roxr_32_s",
+	"ror_32_s",
+	"lsr_16_ai",
+	"lsr_16_pi",
+	"lsr_16_pd",
+	"lsr_16_di",
+	"lsr_16_ix",
+	"lsr_16_aw",
+	"lsr_16_al",
+	"asl_8_s",
+	"lsl_8_s",
+	"roxl_8_s",
+	"rol_8_s",
+	"asl_16_s",
+	"lsl_16_s",
+	"roxl_16_s",
+	"rol_16_s",
+	"asl_32_s",
+	"lsl_32_s",
+	"roxl_32_s",
+	"rol_32_s",
+	"lsl_16_ai",
+	"lsl_16_pi",
+	"lsl_16_pd",
+	"lsl_16_di",
+	"lsl_16_ix",
+	"lsl_16_aw",
+	"lsl_16_al",
+	"asr_8_s",
+	"lsr_8_s",
+	"roxr_8_s",
+	"ror_8_s",
+	"asr_16_s",
+	"lsr_16_s",
+	"roxr_16_s",
+	"ror_16_s",
+	"asr_32_s",
+	"lsr_32_s",
+	"roxr_32_s",
+	"ror_32_s",
+	"roxr_16_ai",
+	"roxr_16_pi",
+	"roxr_16_pd",
+	"roxr_16_di",
+	"roxr_16_ix",
+	"roxr_16_aw",
+	"roxr_16_al",
+	"asl_8_s",
+	"lsl_8_s",
+	"roxl_8_s",
+	"rol_8_s",
+	"asl_16_s",
+	"lsl_16_s",
+	"roxl_16_s",
+	"rol_16_s",
+	"asl_32_s",
+	"lsl_32_s",
+	"roxl_32_s",
+	"rol_32_s",
+	"roxl_16_ai",
+	"roxl_16_pi",
+	"roxl_16_pd",
+	"roxl_16_di",
+	"roxl_16_ix",
+	"roxl_16_aw",
+	"roxl_16_al",
+	"asr_8_s",
+	"lsr_8_s",
+	"roxr_8_s",
+	"ror_8_s",
+	"asr_16_s",
+	"lsr_16_s",
+	"roxr_16_s",
+	"ror_16_s",
+	"asr_32_s",
+	"lsr_32_s",
+	"roxr_32_s",
+	"ror_32_s",
+	"ror_16_ai",
+	"ror_16_pi",
+	"ror_16_pd",
+	"ror_16_di",
+	"ror_16_ix",
+	"ror_16_aw",
+	"ror_16_al",
+	"asl_8_s",
+	"lsl_8_s",
+	"roxl_8_s",
+	"rol_8_s",
+	"asl_16_s",
+	"lsl_16_s",
+	"roxl_16_s",
+	"rol_16_s",
+	"asl_32_s",
+	"lsl_32_s",
+	"roxl_32_s",
+	"rol_32_s",
+	"rol_16_ai",
+	"rol_16_pi",
+	"rol_16_pd",
+	"rol_16_di",
+	"rol_16_ix",
+	"rol_16_aw",
+	"rol_16_al",
+	"asr_8_s",
+	"lsr_8_s",
+	"roxr_8_s",
+	"ror_8_s",
+	"asr_16_s",
+	"lsr_16_s",
+	"roxr_16_s",
+	"ror_16_s",
+	"asr_32_s",
+	"lsr_32_s",
+	"roxr_32_s",
+	"ror_32_s",
+	"asl_8_s",
+	"lsl_8_s",
+	"roxl_8_s",
+	"rol_8_s",
+	"asl_16_s",
+	"lsl_16_s",
+	"roxl_16_s",
+	"rol_16_s",
+	"asl_32_s",
+	"lsl_32_s",
+	"roxl_32_s",
+	"rol_32_s",
+	"asr_8_s",
+	"lsr_8_s",
+	"roxr_8_s",
+	"ror_8_s",
+	"asr_16_s",
+	"lsr_16_s",
+	"roxr_16_s",
+	"ror_16_s",
+	"asr_32_s",
+	"lsr_32_s",
+	"roxr_32_s",
+	"ror_32_s",
+	"asl_8_s",
+	"lsl_8_s",
+	"roxl_8_s",
+	"rol_8_s",
+	"asl_16_s",
+	"lsl_16_s",
+	"roxl_16_s",
+	"rol_16_s",
+	"asl_32_s",
+	"lsl_32_s",
+	"roxl_32_s",
+	"rol_32_s",
+	"asr_8_s",
+	"lsr_8_s",
+	"roxr_8_s",
+	"ror_8_s",
+	"asr_16_s",
+	"lsr_16_s",
+	"roxr_16_s",
+	"ror_16_s",
+	"asr_32_s",
+	"lsr_32_s",
+	"roxr_32_s",
+	"ror_32_s",
+	"asl_8_s",
+	"lsl_8_s",
+	"roxl_8_s",
+	"rol_8_s",
+	"asl_16_s",
+	"lsl_16_s",
+	"roxl_16_s",
+	"rol_16_s",
+	"asl_32_s",
+	"lsl_32_s",
+	"roxl_32_s",
+	"rol_32_s",
+	"asr_8_s",
+	"lsr_8_s",
+	"roxr_8_s",
+	"ror_8_s",
+	"asr_16_s",
+	"lsr_16_s",
+	"roxr_16_s",
+	"ror_16_s",
+	"asr_32_s",
+	"lsr_32_s",
+	"roxr_32_s",
+	"ror_32_s",
+	"asl_8_s",
+	"lsl_8_s",
+	"roxl_8_s",
+	"rol_8_s",
+	"asl_16_s",
+	"lsl_16_s",
+	"roxl_16_s",
+	"rol_16_s",
+	"asl_32_s",
+	"lsl_32_s",
+	"roxl_32_s",
+	"rol_32_s",
+	"1111",
+	"1111",
+};
+#endif /* M68K_PROFILE_PAIRS */
+
+/* ======================================================================== */
+/* ============================== END OF FILE ============================= */
+/* ======================================================================== */
+
+
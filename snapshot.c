@@ -0,0 +1,152 @@
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "m68k.h"
+#include "v200.h"
+#include "flash.h"
+#include "snapshot.h"
+
+#define SNAPSHOT_MAGIC      "V200SNAP"
+#define SNAPSHOT_VERSION    2
+
+struct snapshot_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t context_size;
+};
+
+static uint64_t flash_hash(void)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int n = 0; n < FLASH_SECTORS; n++) {
+        const uint8_t *p = flash_sector(n);
+        for (int i = 0; i < FLASH_SECTOR_SIZE; i++)
+            hash = (hash ^ p[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static int make_dir(const char *dir)
+{
+    char path[strlen(dir) + 1];
+    strcpy(path, dir);
+
+    for (char *p = path + 1; ; p++) {
+        if (*p != '/' && *p != '\0')
+            continue;
+
+        char c = *p;
+        *p = '\0';
+        if (mkdir(path, 0755) < 0 && errno != EEXIST) {
+            perror(path);
+            return 0;
+        }
+        *p = c;
+        if (c == '\0')
+            return 1;
+    }
+}
+
+char *snapshot_path(const char *dir)
+{
+    char default_dir[PATH_MAX];
+    if (!dir) {
+        const char *cache = getenv("XDG_CACHE_HOME");
+        const char *home = getenv("HOME");
+        if (cache && *cache)
+            snprintf(default_dir, sizeof(default_dir), "%s/v200", cache);
+        else if (home && *home)
+            snprintf(default_dir, sizeof(default_dir), "%s/.cache/v200", home);
+        else
+            return NULL;
+        dir = default_dir;
+    }
+
+    if (!make_dir(dir))
+        return NULL;
+
+    char *path = malloc(strlen(dir) + 32);
+    if (!path)
+        return NULL;
+    sprintf(path, "%s/%016llx.snap", dir, (unsigned long long) flash_hash());
+    return path;
+}
+
+int snapshot_load(const char *path)
+{
+    FILE *fh = fopen(path, "rb");
+    if (!fh)
+        return 0;
+
+    struct snapshot_header header;
+    if (fread(&header, sizeof(header), 1, fh) != 1 ||
+            memcmp(header.magic, SNAPSHOT_MAGIC, 8) ||
+            header.version != SNAPSHOT_VERSION ||
+            header.context_size != m68k_context_size()) {
+        fprintf(stderr, "%s: stale snapshot, ignoring\n", path);
+        fclose(fh);
+        return 0;
+    }
+
+    // Nothing is touched until the parts that don't fit in place are read
+    uint8_t context[header.context_size];
+    uint8_t *ram = malloc(RAM_SIZE);
+    uint32_t frames;
+    if (!ram ||
+            fread(context, sizeof(context), 1, fh) != 1 ||
+            fread(ram, RAM_SIZE, 1, fh) != 1 ||
+            fread(io, sizeof(io), 1, fh) != 1 ||
+            fread(&frames, sizeof(frames), 1, fh) != 1 ||
+            !flash_restore(fh)) {
+        fprintf(stderr, "%s: truncated snapshot\n", path);
+        exit(1);
+    }
+    fclose(fh);
+
+    // The context carries pointers into this process; callers need to set
+    // the CPU type and callbacks up again
+    m68k_set_context(context);
+    memcpy(ti_ram, ram, RAM_SIZE);
+    free(ram);
+    frame_count = frames;
+    return 1;
+}
+
+void snapshot_save(const char *path)
+{
+    char tmp_path[strlen(path) + sizeof(".tmp")];
+    sprintf(tmp_path, "%s.tmp", path);
+
+    FILE *fh = fopen(tmp_path, "wb");
+    if (!fh) {
+        perror(tmp_path);
+        return;
+    }
+
+    struct snapshot_header header = {
+        .magic = SNAPSHOT_MAGIC,
+        .version = SNAPSHOT_VERSION,
+        .context_size = m68k_context_size(),
+    };
+    uint8_t context[header.context_size];
+    m68k_get_context(context);
+    uint32_t frames = frame_count;
+
+    fwrite(&header, sizeof(header), 1, fh);
+    fwrite(context, sizeof(context), 1, fh);
+    fwrite(ti_ram, RAM_SIZE, 1, fh);
+    fwrite(io, sizeof(io), 1, fh);
+    fwrite(&frames, sizeof(frames), 1, fh);
+    flash_save(fh);
+
+    int failed = ferror(fh);
+    if (fclose(fh) || failed || rename(tmp_path, path) < 0) {
+        perror(path);
+        remove(tmp_path);
+    }
+}
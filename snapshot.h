@@ -0,0 +1,13 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+// Machine snapshots, used to skip booting AMS. Snapshots are cached per
+// flash image: snapshot_path() hashes the flash as currently loaded and
+// returns the file a snapshot of it lives in, creating dir if need be. A
+// NULL dir means the user's cache directory.
+
+char *snapshot_path(const char *dir);
+int snapshot_load(const char *path);
+void snapshot_save(const char *path);
+
+#endif
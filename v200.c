@@ -1,40 +1,51 @@
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <getopt.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <SDL.h>
 #include <SDL_keycode.h>
 
 #include "m68k.h"
-
-#define RAM_SIZE    (256 * 1024)
-#define FLASH_SIZE  (4 * 1024 * 1024)
-
-#define RAM_BASE    0x000000
-#define FLASH_BASE  0x200000
-
-#define SCREEN_WIDTH    240
-#define SCREEN_HEIGHT   128
+#include "v200.h"
+#include "flash.h"
+#include "hle.h"
+#include "keys.h"
+#include "lcd.h"
+#include "link.h"
+#include "snapshot.h"
+#include "vars.h"
+
+#define SCREEN_WIDTH    LCD_WIDTH
+#define SCREEN_HEIGHT   LCD_HEIGHT
 
 #define SCREEN_PADDING  8
 #define SCREEN_SCALE    2
 
-/* 12 MHz = 12k cycles / 1 ms */
-#define CYCLES_PER_TICK 12000
-
 /* 40 Hz = 25 ms / frame */
 #define FRAME_TICKS     25
 
 #define FRAME_CYCLES    (FRAME_TICKS * CYCLES_PER_TICK)
 
 uint8_t io[32];
-void *ti_ram = NULL, *ti_flash = NULL;
+void *ti_ram = NULL;
+
+int frame_count = 0;
+uint64_t cycle_count = 0;
+
+// Set once AMS first asks for low-power mode, i.e. is sitting idle
+int os_idle = 0;
+
+// In low-power mode, waiting for an interrupt
+int cpu_halted = 0;
 
 uint8_t keyboard_state[81] = {0};
 uint8_t keyboard_touched = 0;
@@ -48,47 +59,6 @@ enum mem_bank {
     BANK_WTF
 };
 
-uint8_t flash_phase = 0x50;
-int flash_write = 0;
-int flash_ff = 0;
-
-void flash_write16(uint16_t value, uint32_t addr)
-{
-    addr = (addr - FLASH_BASE) & (FLASH_SIZE - 1);
-
-    if (flash_write > 0) {
-        uint16_t *rom = ti_flash + addr;
-        *rom &= value;
-        flash_write = 0;
-        flash_ff = 1;
-    } else switch(value & 0xff) {
-        case 0x10:
-            if (flash_phase == 0x50) flash_write = 1;
-            break;
-        case 0x20:
-            if (flash_phase == 0x50) flash_phase = 0x20;
-            break;
-        case 0x50:
-            flash_phase = 0x50;
-            break;
-        case 0x90:
-            flash_phase = 0x90;
-            break;
-        case 0xd0:
-            if (flash_phase == 0x20) {
-                memset(ti_flash + (addr & 0xff0000), 0xff, 65536);
-                flash_phase = 0xd0;
-                flash_ff = 1;
-            }
-            break;
-        case 0xff:
-            if (flash_phase == 0x50) {
-                flash_ff = 0;
-            }
-            break;
-    }
-}
-
 enum mem_bank mem_bank_for_addr(unsigned int addr)
 {
     if (addr < 0x200000) return BANK_RAM;
@@ -136,6 +106,67 @@ uint8_t io_getkbd(void)
     return ~result;
 }
 
+static uint8_t irq_lines = 0;   // held by devices until they're serviced
+static uint8_t irq_pulses = 0;  // held until the CPU takes the interrupt
+
+// The CPU sees the highest interrupt level anything is asserting
+static void irq_update(void)
+{
+    uint8_t pending = irq_lines | irq_pulses;
+
+    int highest = 0;
+    for (int i = 1; i < 8; i++) {
+        if (pending & (1 << i))
+            highest = i;
+    }
+    m68k_set_irq(highest);
+}
+
+void irq_set(int level, int active)
+{
+    if (active)
+        irq_lines |= 1 << level;
+    else
+        irq_lines &= ~(1 << level);
+    irq_update();
+}
+
+void irq_pulse(int level)
+{
+    irq_pulses |= 1 << level;
+    irq_update();
+}
+
+// Only unmasked interrupts get this far, and they end low-power mode
+static int irq_ack(int level)
+{
+    cpu_halted = 0;
+    irq_pulses &= ~(1 << level);
+    irq_update();
+    return M68K_INT_ACK_AUTOVECTOR;
+}
+
+// Auto-int 1 runs at 256 Hz
+#define TIMER1_CYCLES   (CYCLES_PER_TICK * 1000 / 256)
+
+static uint64_t next_timer1 = 0;
+
+// Raises timer interrupts due by now. Returns the cycles until the next.
+static uint64_t timers_apply(uint64_t now)
+{
+    // FIXME: AMS isn't ready for timer interrupts straight out of reset
+    if (frame_count <= 30)
+        return UINT64_MAX;
+
+    if (next_timer1 <= now) {
+        irq_pulse(1);
+        next_timer1 += TIMER1_CYCLES;
+        if (next_timer1 <= now)
+            next_timer1 = now + TIMER1_CYCLES;
+    }
+    return next_timer1 - now;
+}
+
 uint8_t io_read8(uint32_t addr)
 {
     addr &= 0x1f;
@@ -145,6 +176,11 @@ uint8_t io_read8(uint32_t addr)
         case 0x00:
             val |= 4;
             break;
+        case 0x0c:
+        case 0x0d:
+        case 0x0f:
+            val = link_read8(addr);
+            break;
         case 0x1b:
             val = io_getkbd();
             break;
@@ -156,6 +192,18 @@ void io_write8(uint32_t addr, uint8_t val)
 {
     addr &= 0x1f;
     io[addr] = val;
+
+    switch (addr) {
+        case 0x05:
+            os_idle = 1;
+            cpu_halted = 1;
+            m68k_end_timeslice();
+            break;
+        case 0x0c:
+        case 0x0f:
+            link_write8(addr, val);
+            break;
+    }
 }
 
 unsigned int m68k_read_memory_8(unsigned int addr)
@@ -164,10 +212,7 @@ unsigned int m68k_read_memory_8(unsigned int addr)
         case BANK_RAM:
             return read8(ti_ram, (addr - RAM_BASE) % RAM_SIZE);
         case BANK_FLASH:
-            if (flash_ff)
-                return 0xff;
-            else
-                return read8(ti_flash, (addr - FLASH_BASE) % FLASH_SIZE);
+            return flash_read8(addr);
         case BANK_IO:
             return io_read8(addr);
         case BANK_WTF:
@@ -181,10 +226,7 @@ unsigned int m68k_read_memory_16(unsigned int addr)
         case BANK_RAM:
             return read16(ti_ram, (addr - RAM_BASE) % RAM_SIZE);
         case BANK_FLASH:
-            if (flash_ff)
-                return 0xffff;
-            else
-                return read16(ti_flash, (addr - FLASH_BASE) % FLASH_SIZE);
+            return flash_read16(addr);
         case BANK_IO:
             return (io_read8(addr) << 16) | io_read8(addr + 1);
         case BANK_WTF:
@@ -241,6 +283,16 @@ void m68k_write_memory_32(unsigned int addr, unsigned int value)
     m68k_write_memory_16(addr + 2, (value >>  0) & 0xffff);
 }
 
+unsigned char *mem_pointer(unsigned int addr, unsigned int size)
+{
+    if (mem_bank_for_addr(addr) != BANK_RAM)
+        return NULL;
+    uint32_t offset = (addr - RAM_BASE) % RAM_SIZE;
+    if (size > RAM_SIZE - offset)
+        return NULL;
+    return ti_ram + offset;
+}
+
 unsigned int m68k_read_disassembler_16(unsigned int addr)
 {
     return m68k_read_memory_16(addr);
@@ -283,7 +335,8 @@ void dump_flash(void)
         perror("dump_flash");
         return;
     }
-    fwrite(ti_flash, 1, FLASH_SIZE, fh);
+    for (int n = 0; n < FLASH_SECTORS; n++)
+        fwrite(flash_sector(n), 1, FLASH_SECTOR_SIZE, fh);
     fclose(fh);
 }
 
@@ -316,41 +369,116 @@ void cpu_whereami(void)
 
 //////////////////////////////////////////////////////////////////////////////
 
+#define TIFL_HEADER_SIZE    78
+#define TIFL_TYPE_OS        0x23
+
+// Where the OS image from a .v2u/.89u/.9xu lands in flash
+#define OS_BASE             0x12000
+
+// Sectors that lie entirely inside the OS image point straight into it;
+// the few sectors it only partly covers get a buffer of their own.
+void load_os(const uint8_t *os, uint32_t os_len)
+{
+    flash_init();
+
+    for (int n = 0; n < FLASH_SECTORS; n++) {
+        uint32_t start = n * FLASH_SECTOR_SIZE;
+        uint32_t end = start + FLASH_SECTOR_SIZE;
+
+        if (start >= OS_BASE && end <= OS_BASE + os_len) {
+            flash_load_sector(n, os + start - OS_BASE);
+            continue;
+        }
+
+        if (n > 0 && (end <= OS_BASE || start >= OS_BASE + os_len))
+            continue;
+
+        uint8_t *sector = malloc(FLASH_SECTOR_SIZE);
+        if (!sector) {
+            perror("load_os");
+            exit(1);
+        }
+        memset(sector, 0xff, FLASH_SECTOR_SIZE);
+
+        uint32_t from = start > OS_BASE ? start : OS_BASE;
+        uint32_t to = end < OS_BASE + os_len ? end : OS_BASE + os_len;
+        if (from < to)
+            memcpy(sector + from - start, os + from - OS_BASE, to - from);
+
+        // Copy boot code
+        if (n == 0)
+            memcpy(sector, os + 0x88, 256);
+
+        flash_load_sector(n, sector);
+    }
+}
+
 void read_rom(const char *path)
 {
-    FILE *fh = fopen(path, "r");
-    if (!fh) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
         perror(path);
         exit(1);
     }
 
-    uint8_t header[78];
-    if (fread(header, sizeof(header), 1, fh) != 1) {
-        fprintf(stderr, "Couldn't read v2u header\n");
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        perror(path);
         exit(1);
     }
 
-    if (memcmp(&header[0], "**TIFL**", 8)) {
-        fprintf(stderr, "Invalid flash header\n");
+    // Flash sectors point into this mapping for as long as they're
+    // unmodified, so instances running the same OS share its page cache
+    size_t size = st.st_size;
+    const uint8_t *rom = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (rom == MAP_FAILED) {
+        perror(path);
         exit(1);
     }
+    close(fd);
+
+    if (size >= 8 && !memcmp(rom, "**TIFL**", 8)) {
+        // .v2u/.89u/.9xu: a series of TIFL blocks, one of which is the OS
+        size_t pos = 0;
+        while (pos + TIFL_HEADER_SIZE <= size) {
+            const uint8_t *header = rom + pos;
+            if (memcmp(&header[0], "**TIFL**", 8)) {
+                fprintf(stderr, "Invalid flash header\n");
+                exit(1);
+            }
 
-    uint32_t image_len = *((uint32_t *) &header[74]);
-    if ((image_len & 0xff000000) || (image_len + 0x12000 > FLASH_SIZE)) {
-        fprintf(stderr, "Unreasonable flash size (got %04x)\n", image_len);
-        exit(1);
-    }
+            uint32_t image_len = header[74] | (header[75] << 8) |
+                (header[76] << 16) | ((uint32_t) header[77] << 24);
+            if (image_len > size - pos - TIFL_HEADER_SIZE) {
+                fprintf(stderr, "Truncated flash image\n");
+                exit(1);
+            }
 
-    memset(ti_flash, 0xff, FLASH_SIZE);
+            if (header[0x31] == TIFL_TYPE_OS) {
+                if (image_len < 0x88 + 256 || image_len + OS_BASE > FLASH_SIZE) {
+                    fprintf(stderr, "Unreasonable flash size (got %04x)\n", image_len);
+                    exit(1);
+                }
+                load_os(header + TIFL_HEADER_SIZE, image_len);
+                break;
+            }
 
-    if (fread(ti_flash + 0x12000, image_len, 1, fh) != 1) {
-        fprintf(stderr, "Couldn't read flash image\n");
+            pos += TIFL_HEADER_SIZE + image_len;
+        }
+        if (pos + TIFL_HEADER_SIZE > size) {
+            fprintf(stderr, "No OS image in %s\n", path);
+            exit(1);
+        }
+    } else if (size == FLASH_SIZE) {
+        // Raw dump of the whole flash, boot sector included
+        flash_init();
+        for (int n = 0; n < FLASH_SECTORS; n++)
+            flash_load_sector(n, rom + n * FLASH_SECTOR_SIZE);
+    } else {
+        fprintf(stderr, "%s is neither a TIFL file nor a raw flash dump\n", path);
         exit(1);
     }
 
-    // Copy boot code
-    memcpy(ti_flash, ti_flash + 0x12088, 256);
-
     // FIXME: Set up hardware param block @ FLASH+0x100
     // The calculator seems to boot without, but it's probably not happy
 }
@@ -456,28 +584,250 @@ int sdl_to_ti_kbd(SDL_Keycode key)
     }
 }
 
+// Lowercase letters, digits and most punctuation are their own SDL keycodes
+static void type_keys(const char *text)
+{
+    int len = strlen(text);
+    int keys[len + 1];
+    int n = 0;
+
+    for (int i = 0; i < len; i++) {
+        if (text[i] == '\\' && text[i + 1] == 'n') {
+            keys[n++] = sdl_to_ti_kbd(SDLK_RETURN);
+            i++;
+            continue;
+        }
+
+        int key = sdl_to_ti_kbd(text[i] == '\n' ? SDLK_RETURN : text[i]);
+        if (key < 0)
+            fprintf(stderr, "Can't type '%c'\n", text[i]);
+        else
+            keys[n++] = key;
+    }
+
+    keys_script(keys, n);
+}
+
+static void cpu_setup(void)
+{
+    m68k_init();
+    m68k_set_cpu_type(M68K_CPU_TYPE_68000);
+    m68k_set_memory_pointer_callback(mem_pointer);
+    m68k_set_int_ack_callback(irq_ack);
+}
+
+// Everything the emulation thread needs from the command line
+struct emu_setup {
+    int use_hle;
+    char *snapshot;
+    const char **inject;
+    int num_inject;
+    const char *type_text;
+};
+
+// Set by the window thread to stop the emulation thread
+static atomic_int emu_quit = 0;
+
+// Wakes the window thread when a new LCD frame is published
+static uint32_t frame_event;
+
+static void *emu_main(void *arg)
+{
+    struct emu_setup *setup = arg;
+
+    uint8_t published_lcd[LCD_BYTES];
+    int published = 0;
+
+    uint32_t last_tick = SDL_GetTicks();
+
+    while (!atomic_load(&emu_quit)) {
+        uint32_t next_tick = last_tick + FRAME_TICKS;
+
+        if (setup->use_hle)
+            hle_resolve();
+
+        link_poll();
+
+        // Stop at each key and timer event so it lands at the right cycle
+        int left = FRAME_CYCLES;
+        while (left > 0) {
+            uint64_t until = keys_apply(cycle_count);
+            uint64_t until_timer = timers_apply(cycle_count);
+            if (until_timer < until)
+                until = until_timer;
+            int slice = until < (uint64_t) left ? (int) until : left;
+
+            // A halted CPU just waits for the next event that might wake it
+            if (cpu_halted) {
+                cycle_count += slice;
+                left -= slice;
+                continue;
+            }
+
+            int n = m68k_execute(slice);
+            if (n == 0)
+                break; // ???
+            cycle_count += n;
+            left -= n;
+        }
+
+        if (setup->snapshot && os_idle) {
+            snapshot_save(setup->snapshot);
+            free(setup->snapshot);
+            setup->snapshot = NULL;
+        }
+
+        if (setup->num_inject && os_idle) {
+            for (int i = 0; i < setup->num_inject; i++)
+                vars_inject(setup->inject[i]);
+            setup->num_inject = 0;
+        }
+
+        if (setup->type_text && os_idle) {
+            type_keys(setup->type_text);
+            setup->type_text = NULL;
+        }
+
+        // Only hand over frames that changed, and only wake the window if
+        // it isn't already due to pick one up
+        if (!published || memcmp(published_lcd, ti_ram + 0x4c00, LCD_BYTES)) {
+            memcpy(published_lcd, ti_ram + 0x4c00, LCD_BYTES);
+            published = 1;
+
+            if (lcd_publish(published_lcd)) {
+                SDL_Event ev = { .type = frame_event };
+                SDL_PushEvent(&ev);
+            }
+        }
+
+        uint32_t now_tick = SDL_GetTicks();
+
+        // Don't hold a link transfer or scripted typing to real time; just
+        // keep up with events
+        int fast = link_busy() || keys_scripted();
+        if (!fast && now_tick < next_tick)
+            SDL_Delay(next_tick - now_tick);
+
+        last_tick = SDL_GetTicks();
+
+        frame_count++;
+    }
+
+    return NULL;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "Usage (for now):\n"
+            "  v200 [options] <os.v2u|os.89u|os.9xu|flash.bin>\n"
+            "\n"
+            "Options:\n"
+            "  --no-hle        Run all ROM calls in the emulated CPU\n"
+            "  --flash FILE    Keep flash contents in FILE between runs\n"
+            "  --snapshot-cache DIR\n"
+            "                  Keep post-boot snapshots in DIR\n"
+            "                  (default: $XDG_CACHE_HOME/v200 or ~/.cache/v200)\n"
+            "  --no-snapshot   Always boot from reset\n"
+            "  --link PATH     Connect the link port to a Unix socket at PATH\n"
+            "  --inject FILE   Store the variables in FILE once AMS is idle\n"
+            "                  (may be given more than once)\n"
+            "  --type TEXT     Type TEXT once AMS is idle; \\n is ENTER\n"
+            "  --pair-profile FILE\n"
+            "                  Write the most frequent opcode pairs to FILE on exit\n"
+            "                  (needs M68K_PROFILE_PAIRS in m68kconf.h)\n"
+           );
+    exit(1);
+}
+
 int main(int argc, char **argv)
 {
-    if (argc != 2) {
-        fprintf(stderr,
-                "Usage (for now):\n"
-                "  v200 <os.v2u>\n"
-               );
-        return 1;
+    int use_hle = 1;
+    const char *flash_path = NULL;
+    const char *snapshot_dir = NULL;
+    int use_snapshot = 1;
+    const char *link_path = NULL;
+    const char *inject[argc];
+    int num_inject = 0;
+    const char *type_text = NULL;
+    const char *pair_profile = NULL;
+
+    static const struct option long_options[] = {
+        { "no-hle", no_argument, NULL, 'H' },
+        { "flash", required_argument, NULL, 'f' },
+        { "snapshot-cache", required_argument, NULL, 'c' },
+        { "no-snapshot", no_argument, NULL, 'S' },
+        { "link", required_argument, NULL, 'l' },
+        { "inject", required_argument, NULL, 'i' },
+        { "type", required_argument, NULL, 't' },
+        { "pair-profile", required_argument, NULL, 'P' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'H':
+                use_hle = 0;
+                break;
+            case 'f':
+                flash_path = optarg;
+                break;
+            case 'c':
+                snapshot_dir = optarg;
+                break;
+            case 'S':
+                use_snapshot = 0;
+                break;
+            case 'l':
+                link_path = optarg;
+                break;
+            case 'i':
+                inject[num_inject++] = optarg;
+                break;
+            case 't':
+                type_text = optarg;
+                break;
+            case 'P':
+                pair_profile = optarg;
+                break;
+            default:
+                usage();
+        }
     }
 
+    if (argc - optind != 1)
+        usage();
+
     ti_ram = malloc(RAM_SIZE);
-    ti_flash = malloc(FLASH_SIZE);
 
-    read_rom(argv[1]);
+    read_rom(argv[optind]);
+    if (flash_path)
+        flash_open(flash_path);
 
-    m68k_init();
-    m68k_set_cpu_type(M68K_CPU_TYPE_68000);
+    char *snapshot = NULL;
+    if (use_snapshot)
+        snapshot = snapshot_path(snapshot_dir);
+
+    cpu_setup();
     m68k_pulse_reset();
 
     m68k_set_reg(M68K_REG_SP, m68k_read_memory_32(FLASH_BASE + 0));
     m68k_set_reg(M68K_REG_PC, m68k_read_memory_32(FLASH_BASE + 4));
 
+    if (snapshot && snapshot_load(snapshot)) {
+        cpu_setup();
+        free(snapshot);
+        snapshot = NULL;
+        os_idle = 1;
+    }
+
+    if (use_hle)
+        hle_init();
+
+    if (link_path)
+        link_open(link_path);
+
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         fprintf(stderr, "Failed to initialize SDL: %s\n", SDL_GetError());
         return 1;
@@ -511,67 +861,80 @@ int main(int argc, char **argv)
     uint32_t black = SDL_MapRGBA(screen_surface->format, 0,   0,   0,   255);
     uint32_t gray  = SDL_MapRGBA(screen_surface->format, 128, 128, 128, 255);
 
-    uint32_t last_tick = SDL_GetTicks();
-
-    for (;;) {
-        uint32_t next_tick = last_tick + FRAME_TICKS;
+    frame_event = SDL_RegisterEvents(1);
 
-        int n = m68k_execute(FRAME_CYCLES);
-        if (n == 0)
-            break; // ???
+    struct emu_setup setup = {
+        .use_hle = use_hle,
+        .snapshot = snapshot,
+        .inject = inject,
+        .num_inject = num_inject,
+        .type_text = type_text,
+    };
 
-        SDL_LockSurface(screen_surface);
-        {
+    pthread_t emu_thread;
+    if (pthread_create(&emu_thread, NULL, emu_main, &setup)) {
+        fprintf(stderr, "Can't start the emulation thread\n");
+        return 1;
+    }
 
-            uint8_t  *src = ti_ram + 0x4c00;
-            uint32_t *dst = screen_surface->pixels;
+    // The window thread only draws and passes on keys, so a slow present or
+    // a window drag never holds up the emulated calculator
+    uint8_t shown_lcd[LCD_BYTES] = {0};
 
-            for (int i = 0; i < SCREEN_HEIGHT; i++) {
-                for (int j = 0; j < SCREEN_WIDTH; j += 8) {
-                    uint8_t b = *src++;
-                    for (int k = 0; k < 8; k++) {
-                        *dst++ = (b & 0x80) ? black : white;
-                        b <<= 1;
+    for (;;) {
+        int redraw = 0;
+
+        SDL_Event ev;
+        if (SDL_WaitEvent(&ev)) {
+            int key;
+            switch (ev.type) {
+                case SDL_QUIT:
+                    atomic_store(&emu_quit, 1);
+                    pthread_join(emu_thread, NULL);
+                    if (pair_profile && m68k_write_pair_profile(pair_profile) < 0)
+                        fprintf(stderr, "Can't write pair profile to %s\n", pair_profile);
+                    return 0;
+                case SDL_WINDOWEVENT:
+                    redraw = 1;
+                    break;
+                case SDL_KEYDOWN:
+                case SDL_KEYUP:
+                    key = sdl_to_ti_kbd(ev.key.keysym.sym);
+                    if (key >= 0 && !ev.key.repeat) {
+                        keys_event(key, ev.key.state == SDL_PRESSED);
                     }
-                }
+                    break;
             }
         }
-        SDL_UnlockSurface(screen_surface);
 
-        SDL_FillRect(window_surface, NULL, white);
-        SDL_BlitScaled(screen_surface, NULL, window_surface, &dstrect);
-        SDL_UpdateWindowSurface(window);
+        const uint8_t *frame = lcd_latest();
+        if (frame) {
+            memcpy(shown_lcd, frame, sizeof(shown_lcd));
+            redraw = 1;
+        }
 
-        uint32_t now_tick = SDL_GetTicks();
-        do {
-            uint32_t wait_ticks = next_tick - now_tick;
-            if (wait_ticks < 5) wait_ticks = 5;
-
-            SDL_Event ev;
-            if (SDL_WaitEventTimeout(&ev, wait_ticks)) {
-                int key;
-                switch (ev.type) {
-                    case SDL_QUIT:
-                        return 0;
-                    case SDL_KEYDOWN:
-                    case SDL_KEYUP:
-                        key = sdl_to_ti_kbd(ev.key.keysym.sym);
-                        if (key >= 0) {
-                            keyboard_state[key] = (ev.key.state == SDL_PRESSED);
+        if (redraw) {
+            SDL_LockSurface(screen_surface);
+            {
+
+                const uint8_t *src = shown_lcd;
+                uint32_t *dst = screen_surface->pixels;
+
+                for (int i = 0; i < SCREEN_HEIGHT; i++) {
+                    for (int j = 0; j < SCREEN_WIDTH; j += 8) {
+                        uint8_t b = *src++;
+                        for (int k = 0; k < 8; k++) {
+                            *dst++ = (b & 0x80) ? black : white;
+                            b <<= 1;
                         }
-                        break;
+                    }
                 }
             }
+            SDL_UnlockSurface(screen_surface);
 
-            now_tick = SDL_GetTicks();
-        } while (now_tick < next_tick);
-
-        last_tick = now_tick;
-
-        // FIXME: This is a hack. Need to implement real timers.
-        static int i = 0;
-        if (i++ > 30) {
-            m68k_set_irq(1);
+            SDL_FillRect(window_surface, NULL, white);
+            SDL_BlitScaled(screen_surface, NULL, window_surface, &dstrect);
+            SDL_UpdateWindowSurface(window);
         }
     }
 
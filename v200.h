@@ -0,0 +1,24 @@
+#ifndef V200_H
+#define V200_H
+
+#include <stdint.h>
+
+#define RAM_SIZE    (256 * 1024)
+#define FLASH_SIZE  (4 * 1024 * 1024)
+
+#define RAM_BASE    0x000000
+#define FLASH_BASE  0x200000
+
+/* 12 MHz = 12k cycles / 1 ms */
+#define CYCLES_PER_TICK 12000
+
+extern void *ti_ram;
+extern uint8_t io[32];
+extern int frame_count;
+extern uint64_t cycle_count;
+extern uint8_t keyboard_state[81];
+
+void irq_set(int level, int active);
+void irq_pulse(int level);
+
+#endif
@@ -0,0 +1,225 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "m68k.h"
+#include "v200.h"
+#include "vars.h"
+
+#define ROMCALL_TABLE_PTR   0xc8
+
+#define ROMCALL_SYMADD      0x5c
+#define ROMCALL_DEREFSYM    0x79
+#define ROMCALL_HEAPALLOC   0x90
+#define ROMCALL_HEAPDEREF   0x96
+#define ROMCALL_HEAPFREE    0x97
+
+// SYM_ENTRY.handle
+#define SYM_HANDLE          12
+
+#define VAR_HEADER_SIZE     0x3c
+#define VAR_ENTRY_SIZE      16
+#define VAR_TYPE_FOLDER     0x1f
+
+// Give up on a ROM call that hasn't returned after this long
+#define CALL_MAX_CYCLES     (50 * 1000 * 1000)
+#define CALL_SLICE          10000
+
+static uint32_t call_base, call_sp;
+
+static void push16(uint16_t value)
+{
+    call_sp -= 2;
+    m68k_write_memory_16(call_sp, value);
+}
+
+static void push32(uint32_t value)
+{
+    call_sp -= 4;
+    m68k_write_memory_32(call_sp, value);
+}
+
+// Returns the guest address of the copy
+static uint32_t push_bytes(const void *data, uint32_t len)
+{
+    call_sp = (call_sp - len) & ~1;
+    for (uint32_t i = 0; i < len; i++)
+        m68k_write_memory_8(call_sp + i, ((const uint8_t *) data)[i]);
+    return call_sp;
+}
+
+// Start a call: the guest returns into a "bra.s *" left on its stack.
+// Arguments are pushed after this, last argument first.
+static uint32_t call_begin(void)
+{
+    call_sp = call_base;
+    push16(0x60fe);
+    return call_sp;
+}
+
+// Runs the ROM call with the arguments pushed so far. Returns 0 if it
+// doesn't return.
+static int call_romcall(uint32_t trampoline, uint16_t romcall, uint32_t *d0, uint32_t *a0)
+{
+    uint32_t table = m68k_read_memory_32(ROMCALL_TABLE_PTR);
+    if (table - FLASH_BASE >= FLASH_SIZE || romcall >= m68k_read_memory_32(table - 4))
+        return 0;
+
+    push32(trampoline);
+    m68k_set_reg(M68K_REG_SP, call_sp);
+    m68k_set_reg(M68K_REG_PC, m68k_read_memory_32(table + romcall * 4));
+
+    for (int cycles = 0; cycles < CALL_MAX_CYCLES; cycles += CALL_SLICE) {
+        m68k_execute(CALL_SLICE);
+        if (m68k_get_reg(NULL, M68K_REG_PC) == trampoline) {
+            *d0 = m68k_get_reg(NULL, M68K_REG_D0);
+            *a0 = m68k_get_reg(NULL, M68K_REG_A0);
+            return 1;
+        }
+    }
+    fprintf(stderr, "ROM call %03x didn't return\n", romcall);
+    return 0;
+}
+
+// Stores one variable. data is the variable as it sits in the heap: a
+// big-endian length word followed by that many bytes.
+static int store_var(const char *folder, const char *name, const uint8_t *data, uint32_t len)
+{
+    uint32_t d0, a0, t;
+
+    t = call_begin();
+    push32(len);
+    if (!call_romcall(t, ROMCALL_HEAPALLOC, &d0, &a0) || !(d0 & 0xffff))
+        return 0;
+    uint16_t handle = d0;
+
+    // SymAdd takes a pointer to the NUL at the end of "\0folder\name"
+    char path[20];
+    int path_len = sprintf(path, "%c%.8s\\%.8s", 0, folder, name);
+    t = call_begin();
+    uint32_t sym_str = push_bytes(path, path_len + 1) + path_len;
+    push32(sym_str);
+    if (!call_romcall(t, ROMCALL_SYMADD, &d0, &a0) || !d0) {
+        t = call_begin();
+        push16(handle);
+        call_romcall(t, ROMCALL_HEAPFREE, &d0, &a0);
+        return 0;
+    }
+    uint32_t hsym = d0;
+
+    // Either call may have moved things around the heap, so dereference
+    // only now
+    t = call_begin();
+    push16(handle);
+    if (!call_romcall(t, ROMCALL_HEAPDEREF, &d0, &a0))
+        return 0;
+    for (uint32_t i = 0; i < len; i++)
+        m68k_write_memory_8(a0 + i, data[i]);
+
+    t = call_begin();
+    push32(hsym);
+    if (!call_romcall(t, ROMCALL_DEREFSYM, &d0, &a0))
+        return 0;
+    uint32_t entry = a0;
+
+    uint16_t old = m68k_read_memory_16(entry + SYM_HANDLE);
+    if (old) {
+        t = call_begin();
+        push16(old);
+        call_romcall(t, ROMCALL_HEAPFREE, &d0, &a0);
+    }
+    m68k_write_memory_16(entry + SYM_HANDLE, handle);
+    return 1;
+}
+
+static uint32_t get16le(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32le(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+int vars_inject(const char *path)
+{
+    FILE *fh = fopen(path, "rb");
+    if (!fh) {
+        perror(path);
+        return -1;
+    }
+    fseek(fh, 0, SEEK_END);
+    long size = ftell(fh);
+    rewind(fh);
+
+    uint8_t *file = malloc(size > 0 ? size : 1);
+    if (!file || fread(file, size, 1, fh) != 1 || size < VAR_HEADER_SIZE ||
+            (memcmp(file, "**TI89**", 8) && memcmp(file, "**TI92P*", 8))) {
+        fprintf(stderr, "%s: not a TI-89/92+/V200 variable file\n", path);
+        fclose(fh);
+        free(file);
+        return -1;
+    }
+    fclose(fh);
+
+    int entries = get16le(&file[0x3a]);
+    if (VAR_HEADER_SIZE + entries * VAR_ENTRY_SIZE > size) {
+        fprintf(stderr, "%s: truncated\n", path);
+        free(file);
+        return -1;
+    }
+
+    // Everything runs with interrupts masked, and the interrupted context
+    // is put back afterwards
+    unsigned int context_size = m68k_context_size();
+    uint8_t context[context_size];
+    m68k_get_context(context);
+    m68k_set_reg(M68K_REG_SR, 0x2700);
+    call_base = m68k_get_reg(NULL, M68K_REG_SP) & ~1;
+
+    char folder[9] = {0};
+    memcpy(folder, &file[0x0a], 8);
+
+    int stored = 0;
+    for (int i = 0; i < entries; i++) {
+        const uint8_t *entry = &file[VAR_HEADER_SIZE + i * VAR_ENTRY_SIZE];
+        char name[9] = {0};
+        memcpy(name, &entry[4], 8);
+
+        if (entry[12] == VAR_TYPE_FOLDER) {
+            strcpy(folder, name);
+            continue;
+        }
+
+        // The variable is stored as 4 zero bytes, then exactly what goes
+        // in the heap, then a checksum of that
+        uint32_t offset = get32le(&entry[0]);
+        if (offset + 6 > size ||
+                offset + 6 + ((file[offset + 4] << 8) | file[offset + 5]) + 2 > size) {
+            fprintf(stderr, "%s: %s is truncated\n", path, name);
+            continue;
+        }
+        const uint8_t *data = &file[offset + 4];
+        uint32_t len = 2 + ((data[0] << 8) | data[1]);
+
+        uint16_t sum = 0;
+        for (uint32_t j = 0; j < len; j++)
+            sum += data[j];
+        if (sum != get16le(&data[len])) {
+            fprintf(stderr, "%s: %s has a bad checksum\n", path, name);
+            continue;
+        }
+
+        const char *dest = folder[0] ? folder : "main";
+        if (store_var(dest, name, data, len))
+            stored++;
+        else
+            fprintf(stderr, "%s: couldn't store %s\\%s\n", path, dest, name);
+    }
+
+    m68k_set_context(context);
+    free(file);
+    return stored;
+}
@@ -0,0 +1,11 @@
+#ifndef VARS_H
+#define VARS_H
+
+// Loads the variables in a .89?/.9x?/.v2? file straight into the AMS heap
+// and VAT by calling the OS's own routines. Only call this while AMS is
+// idle. Returns the number of variables stored, or -1 if the file can't
+// be used.
+
+int vars_inject(const char *path);
+
+#endif